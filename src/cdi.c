@@ -0,0 +1,300 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "cdi.h"
+
+#include "output.h"
+#include "sector.h"
+
+// size of the chunks read from a data track when converting it
+#define CDI_CHUNK_SECTORS 2048
+
+// track modes and sector sizes as stored in the descriptors
+#define CDI_MODE_AUDIO 0
+#define CDI_MODE_MODE2 2
+#define CDI_SECTOR_SIZE_2336 1
+#define CDI_SECTOR_SIZE_2352 2
+
+// ADR/control of a data track
+#define CDI_CONTROL_DATA 4
+
+// DiscJuggler stores a maximal capacity of 74 minutes
+#define CDI_DISC_CAPACITY 333000
+
+static const unsigned char cdi_track_mark[10] = {
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff
+};
+
+/* Descriptors */
+
+static void
+cdi_zero(buffer_t *buf, size_t size)
+{
+  static const unsigned char zero[32];
+
+  while (size > 0) {
+    size_t length = (size < sizeof(zero)) ? size : sizeof(zero);
+    buffer_append(buf, zero, length);
+    size -= length;
+  }
+}
+
+static void
+cdi_le16(buffer_t *buf, uint16_t value)
+{
+  unsigned char p[2] = { value, value >> 8 };
+  buffer_append(buf, p, sizeof(p));
+}
+
+static void
+cdi_le32(buffer_t *buf, uint32_t value)
+{
+  unsigned char p[4] = { value, value >> 8, value >> 16, value >> 24 };
+  buffer_append(buf, p, sizeof(p));
+}
+
+static void
+cdi_track(cdi_image_t *cdi, int session, int track, int mode, uint32_t lba,
+  uint32_t length, int sector_size)
+{
+  buffer_t *buf = &cdi->header;
+  char *name = strrchr(cdi->filename, '/');
+  unsigned char name_length;
+
+  // the file name is stored with a single byte length
+  name = (name != NULL) ? name + 1 : cdi->filename;
+  name_length = (strlen(name) > 255) ? 255 : strlen(name);
+
+  cdi_le32(buf, 0);
+  buffer_append(buf, cdi_track_mark, sizeof(cdi_track_mark));
+  buffer_append(buf, cdi_track_mark, sizeof(cdi_track_mark));
+  cdi_zero(buf, 4);
+  buffer_append(buf, &name_length, 1);
+  buffer_append(buf, name, name_length);
+  cdi_zero(buf, 11 + 4 + 4);
+  cdi_le32(buf, CDI_DISC_CAPACITY);
+  cdi_zero(buf, 2);
+  cdi_le32(buf, CDI_PREGAP);
+  cdi_le32(buf, length);
+  cdi_zero(buf, 6);
+  cdi_le32(buf, mode);
+  cdi_zero(buf, 4);
+  cdi_le32(buf, session);
+  cdi_le32(buf, track);
+  cdi_le32(buf, lba);
+  cdi_le32(buf, CDI_PREGAP + length);
+  cdi_zero(buf, 16);
+  cdi_le32(buf, sector_size);
+  cdi_le32(buf, (mode == CDI_MODE_AUDIO) ? 0 : CDI_CONTROL_DATA);
+  cdi_zero(buf, 25 + 5 + 4);
+}
+
+static void
+cdi_session_end(cdi_image_t *cdi)
+{
+  cdi_zero(&cdi->header, 4 + 8 + 1);
+}
+
+/* Public interface */
+
+void
+cdi_prepare(cdi_image_t *cdi, char *filename, uint32_t lba, uint32_t sectors)
+{
+  cdi->filename = filename;
+  cdi->lba = lba;
+  cdi->sectors = sectors;
+
+  // the descriptors only depend on the layout, so they are built before
+  // the track data is written and simply appended at the end
+  buffer_init(&cdi->header);
+  cdi_le16(&cdi->header, 2);
+
+  cdi_le16(&cdi->header, 1);
+  cdi_track(cdi, 0, 0, CDI_MODE_AUDIO, 0, CDI_AUDIO_LENGTH, CDI_SECTOR_SIZE_2352);
+  cdi_session_end(cdi);
+
+  cdi_le16(&cdi->header, 1);
+  cdi_track(cdi, 1, 1, CDI_MODE_MODE2, lba, sectors, CDI_SECTOR_SIZE_2336);
+  cdi_session_end(cdi);
+}
+
+int
+cdi_write_lead(cdi_image_t *cdi, int fd)
+{
+  size_t audio_size = (CDI_PREGAP + CDI_AUDIO_LENGTH) * SECTOR_RAW_SIZE;
+  size_t pregap_size = CDI_PREGAP * SECTOR_MODE2_SIZE;
+  char *buffer = (char *) calloc(1, audio_size + pregap_size);
+  char *empty = (char *) calloc(CDI_PREGAP, SECTOR_USER_SIZE);
+  int result;
+
+  // first session: silence, then the pregap of the data track, made of
+  // empty Mode 2 sectors
+  sector_encode_range(SECTOR_FORMAT_MODE2_2336, cdi->lba - CDI_PREGAP, empty,
+    buffer + audio_size, CDI_PREGAP);
+
+  result = file_write_full(fd, buffer, audio_size + pregap_size);
+  if (!result) {
+    log_error("unable to write \"%s\": %s\n", cdi->filename, strerror(errno));
+  }
+
+  free(empty);
+  free(buffer);
+
+  return result;
+}
+
+int
+cdi_write_header(cdi_image_t *cdi, int fd)
+{
+  off_t position = lseek(fd, 0, SEEK_END);
+
+  if (position == -1) {
+    return 0;
+  }
+
+  // the trailer gives the version and the position of the descriptors
+  cdi_le32(&cdi->header, CDI_VERSION_3);
+  cdi_le32(&cdi->header, position);
+
+  if (!file_write_full(fd, cdi->header.data, cdi->header.size)) {
+    log_error("unable to write \"%s\": %s\n", cdi->filename, strerror(errno));
+    return 0;
+  }
+
+  return 1;
+}
+
+void
+cdi_release(cdi_image_t *cdi)
+{
+  buffer_free(&cdi->header);
+}
+
+int
+cdi_convert(const char *ip, char *fn_track, char *fn_cdi, uint32_t lba)
+{
+  struct stat stats;
+  cdi_image_t cdi;
+  int result = 1;
+
+  int in = open(fn_track, O_RDONLY);
+  if (in == -1 || fstat(in, &stats) == -1) {
+    log_error("can't open data track \"%s\": %s\n", fn_track, strerror(errno));
+    if (in != -1) {
+      close(in);
+    }
+    return 0;
+  }
+
+  uint32_t sectors = stats.st_size / SECTOR_USER_SIZE;
+  char *chunk = (char *) malloc(CDI_CHUNK_SECTORS * SECTOR_USER_SIZE);
+  char *raw = (char *) malloc(CDI_CHUNK_SECTORS * SECTOR_MODE2_SIZE);
+
+  // the data track must be an ISO9660 image built for this LBA
+  if (stats.st_size % SECTOR_USER_SIZE || sectors <= INITIAL_PROGRAM_SIZE / SECTOR_USER_SIZE ||
+      pread(in, chunk, SECTOR_USER_SIZE, INITIAL_PROGRAM_SIZE) != SECTOR_USER_SIZE ||
+      chunk[0] != 1 || memcmp(chunk + 1, "CD001", 5)) {
+    log_error("\"%s\" is not a valid ISO9660 data track\n", fn_track);
+    result = 0;
+  } else {
+    uint32_t volume_sectors = (unsigned char) chunk[80] |
+      ((unsigned char) chunk[81] << 8) | ((unsigned char) chunk[82] << 16) |
+      ((uint32_t) (unsigned char) chunk[83] << 24);
+    if (volume_sectors != lba + sectors) {
+      log_warn("data track \"%s\" doesn't seem to be built for LBA %u\n", fn_track, lba);
+    }
+  }
+
+  output_file_t output;
+  int out = -1;
+  if (result) {
+    result = output_open(&output, fn_cdi, 0);
+    out = output.fd;
+  }
+
+  if (result) {
+    log_notice("writing CDI image \"%s\" (%u sectors at LBA %u)\n", fn_cdi, sectors, lba);
+
+    cdi_prepare(&cdi, fn_cdi, lba, sectors);
+    result = cdi_write_lead(&cdi, out);
+
+    for (uint32_t done = 0; result && done < sectors; ) {
+      uint32_t count = sectors - done;
+      if (count > CDI_CHUNK_SECTORS) {
+        count = CDI_CHUNK_SECTORS;
+      }
+
+      size_t size = (size_t) count * SECTOR_USER_SIZE;
+      if (pread(in, chunk, size, (off_t) done * SECTOR_USER_SIZE) != (ssize_t) size) {
+        log_error("unable to read \"%s\"\n", fn_track);
+        result = 0;
+        break;
+      }
+
+      // the system area of the track is replaced by our bootstrap
+      if (done == 0) {
+        memcpy(chunk, ip, INITIAL_PROGRAM_SIZE);
+      }
+
+      sector_encode_range(SECTOR_FORMAT_MODE2_2336, lba + done, chunk, raw, count);
+      if (!file_write_full(out, raw, (size_t) count * SECTOR_MODE2_SIZE)) {
+        log_error("unable to write \"%s\": %s\n", fn_cdi, strerror(errno));
+        result = 0;
+      }
+
+      done += count;
+    }
+
+    result = result && cdi_write_header(&cdi, out);
+    cdi_release(&cdi);
+
+    if (result) {
+      result = output_commit(&output);
+    } else {
+      output_abort(&output);
+    }
+  }
+
+  close(in);
+  free(chunk);
+  free(raw);
+
+  if (result) {
+    log_notice("CDI image successfully written to \"%s\"\n", fn_cdi);
+  }
+
+  return result;
+}
@@ -0,0 +1,66 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CDI_H__
+#define __CDI_H__
+
+#include <stdint.h>
+
+#include "global.h"
+
+#include "utils.h"
+
+// DiscJuggler 3.0 image
+#define CDI_VERSION_3 0x80000005
+
+// first session: a single audio track, the shortest allowed (4 seconds)
+#define CDI_AUDIO_LENGTH 302
+
+// pregap of every track (2 seconds)
+#define CDI_PREGAP 150
+
+typedef struct cdi_image_t {
+  char *filename;
+  uint32_t lba;         // LBA of the data track (second session)
+  uint32_t sectors;     // length of the data track
+  buffer_t header;      // sessions and tracks descriptors
+} cdi_image_t;
+
+void cdi_prepare(cdi_image_t *cdi, char *filename, uint32_t lba, uint32_t sectors);
+int cdi_write_lead(cdi_image_t *cdi, int fd);
+int cdi_write_header(cdi_image_t *cdi, int fd);
+void cdi_release(cdi_image_t *cdi);
+
+int cdi_convert(const char *ip, char *fn_track, char *fn_cdi, uint32_t lba);
+
+#endif /* __CDI_H__ */
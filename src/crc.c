@@ -31,23 +31,226 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <pthread.h>
+#include <time.h>
+
 #include "crc.h"
+#include "stats.h"
+
+static uint16_t crc16_table[8][256];
+static uint32_t crc32_edc_table[8][256];
+
+static pthread_once_t crc_tables_once = PTHREAD_ONCE_INIT;
+
+static void
+crc_tables_initialize(void)
+{
+  for (int i = 0; i < 256; i++) {
+    uint16_t n = i << 8;
+    uint32_t e = i;
+    for (int c = 0; c < 8; c++) {
+      n = (n & 0x8000) ? (n << 1) ^ CRC16_POLYNOMIAL : (n << 1);
+      e = (e & 1) ? (e >> 1) ^ CRC32_EDC_POLYNOMIAL : (e >> 1);
+    }
+    crc16_table[0][i] = n;
+    crc32_edc_table[0][i] = e;
+  }
+
+  // table k gives the CRC of a byte followed by k zero bytes
+  for (int k = 1; k < 8; k++) {
+    for (int i = 0; i < 256; i++) {
+      uint16_t n = crc16_table[k - 1][i];
+      uint32_t e = crc32_edc_table[k - 1][i];
+      crc16_table[k][i] = (n << 8) ^ crc16_table[0][n >> 8];
+      crc32_edc_table[k][i] = (e >> 8) ^ crc32_edc_table[0][e & 0xff];
+    }
+  }
+}
+
+static uint16_t
+crc16_bitwise(uint16_t crc, const unsigned char *p, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    crc ^= p[i] << 8;
+    for (int c = 0; c < 8; c++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ CRC16_POLYNOMIAL : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+static uint16_t
+crc16_table_driven(uint16_t crc, const unsigned char *p, size_t size)
+{
+  while (size--) {
+    crc = (crc << 8) ^ crc16_table[0][(crc >> 8) ^ *p++];
+  }
+  return crc;
+}
+
+static uint16_t
+crc16_slice8(uint16_t crc, const unsigned char *p, size_t size)
+{
+  while (size >= 8) {
+    crc = crc16_table[7][p[0] ^ (crc >> 8)] ^ crc16_table[6][p[1] ^ (crc & 0xff)] ^
+          crc16_table[5][p[2]] ^ crc16_table[4][p[3]] ^
+          crc16_table[3][p[4]] ^ crc16_table[2][p[5]] ^
+          crc16_table[1][p[6]] ^ crc16_table[0][p[7]];
+    p += 8;
+    size -= 8;
+  }
+  return crc16_table_driven(crc, p, size);
+}
+
+static uint32_t
+crc32_edc_bitwise(uint32_t crc, const unsigned char *p, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    crc ^= p[i];
+    for (int c = 0; c < 8; c++) {
+      crc = (crc & 1) ? (crc >> 1) ^ CRC32_EDC_POLYNOMIAL : (crc >> 1);
+    }
+  }
+  return crc;
+}
+
+static uint32_t
+crc32_edc_table_driven(uint32_t crc, const unsigned char *p, size_t size)
+{
+  while (size--) {
+    crc = (crc >> 8) ^ crc32_edc_table[0][(crc ^ *p++) & 0xff];
+  }
+  return crc;
+}
+
+static uint32_t
+crc32_edc_slice8(uint32_t crc, const unsigned char *p, size_t size)
+{
+  while (size >= 8) {
+    crc ^= p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+    crc = crc32_edc_table[7][crc & 0xff] ^ crc32_edc_table[6][(crc >> 8) & 0xff] ^
+          crc32_edc_table[5][(crc >> 16) & 0xff] ^ crc32_edc_table[4][crc >> 24] ^
+          crc32_edc_table[3][p[4]] ^ crc32_edc_table[2][p[5]] ^
+          crc32_edc_table[1][p[6]] ^ crc32_edc_table[0][p[7]];
+    p += 8;
+    size -= 8;
+  }
+  return crc32_edc_table_driven(crc, p, size);
+}
 
+uint16_t
+crc16_ccitt_impl(crc_impl_t impl, uint16_t crc, const void *buf, size_t size)
+{
+  pthread_once(&crc_tables_once, crc_tables_initialize);
+
+  switch (impl) {
+    case CRC_IMPL_BITWISE:
+      return crc16_bitwise(crc, buf, size);
+    case CRC_IMPL_TABLE:
+      return crc16_table_driven(crc, buf, size);
+    default:
+      return crc16_slice8(crc, buf, size);
+  }
+}
+
+uint32_t
+crc32_edc_impl(crc_impl_t impl, uint32_t crc, const void *buf, size_t size)
+{
+  pthread_once(&crc_tables_once, crc_tables_initialize);
+
+  switch (impl) {
+    case CRC_IMPL_BITWISE:
+      return crc32_edc_bitwise(crc, buf, size);
+    case CRC_IMPL_TABLE:
+      return crc32_edc_table_driven(crc, buf, size);
+    default:
+      return crc32_edc_slice8(crc, buf, size);
+  }
+}
+
+uint16_t
+crc16_ccitt(uint16_t crc, const void *buf, size_t size)
+{
+  return crc16_ccitt_impl(CRC_IMPL_SLICE8, crc, buf, size);
+}
+
+uint32_t
+crc32_edc(uint32_t crc, const void *buf, size_t size)
+{
+  return crc32_edc_impl(CRC_IMPL_SLICE8, crc, buf, size);
+}
+
+static double
+crc_benchmark_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Cross-checks all the implementations against the bitwise reference then
+// prints their throughput; returns 0 if any result differs
 int
-calc_crc(const unsigned char *buf, int size)
+crc_benchmark(size_t size)
 {
-  int i, c, n = 0xffff;
-  for (i = 0; i < size; i++) {
-    n ^= (buf[i]<<8);
-    for (c = 0; c < 8; c++) {
-      if (n & INITIAL_PROGRAM_SIZE)
-        n = (n << 1) ^ 4129;
-      else
-        n = (n << 1);
+  static const char *names[] = { "bitwise", "table", "slice-by-8" };
+  unsigned char *buf = (unsigned char *) malloc(size);
+  int result = 1;
+
+  srand(time(NULL));
+  for (size_t i = 0; i < size; i++) {
+    buf[i] = rand();
+  }
+
+  // odd lengths and offsets exercise the tail handling
+  for (size_t length = 0; length < 64 && length < size; length++) {
+    uint16_t c16 = crc16_ccitt_impl(CRC_IMPL_BITWISE, CRC16_INIT, buf + 1, length);
+    uint32_t c32 = crc32_edc_impl(CRC_IMPL_BITWISE, CRC32_EDC_INIT, buf + 1, length);
+    for (int impl = CRC_IMPL_TABLE; impl <= CRC_IMPL_SLICE8; impl++) {
+      if (crc16_ccitt_impl(impl, CRC16_INIT, buf + 1, length) != c16 ||
+          crc32_edc_impl(impl, CRC32_EDC_INIT, buf + 1, length) != c32) {
+        printf("%s: mismatch for %d bytes\n", names[impl], (int) length);
+        result = 0;
+      }
+    }
+  }
+
+  uint16_t ref16 = 0;
+  uint32_t ref32 = 0;
+
+  printf("%-12s %12s %12s\n", "", "CRC-16 MB/s", "EDC MB/s");
+  for (int impl = CRC_IMPL_BITWISE; impl <= CRC_IMPL_SLICE8; impl++) {
+    double start = crc_benchmark_now();
+    uint16_t c16 = crc16_ccitt_impl(impl, CRC16_INIT, buf, size);
+    double middle = crc_benchmark_now();
+    uint32_t c32 = crc32_edc_impl(impl, CRC32_EDC_INIT, buf, size);
+    double end = crc_benchmark_now();
+
+    if (impl == CRC_IMPL_BITWISE) {
+      ref16 = c16;
+      ref32 = c32;
+    } else if (c16 != ref16 || c32 != ref32) {
+      result = 0;
     }
+
+    printf("%-12s %12.1f %12.1f%s\n", names[impl],
+      size / (middle - start) / 1e6, size / (end - middle) / 1e6,
+      (c16 != ref16 || c32 != ref32) ? "  MISMATCH" : "");
   }
 
-  return n & 0xffff;
+  free(buf);
+
+  return result;
+}
+
+int
+calc_crc(const unsigned char *buf, int size)
+{
+  uint64_t start = stats_start();
+  int crc = crc16_ccitt(CRC16_INIT, buf, size);
+  stats_stop(STATS_CRC, start);
+
+  return crc;
 }
 
 void
@@ -37,9 +37,33 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "global.h"
 
+// Device Info CRC: CRC-16/CCITT (polynomial 0x1021, MSB first)
+#define CRC16_POLYNOMIAL 0x1021
+#define CRC16_INIT 0xffff
+
+// CD-ROM EDC: CRC-32 (polynomial 0x8001801B, LSB first, no final xor)
+#define CRC32_EDC_POLYNOMIAL 0xd8018001
+#define CRC32_EDC_INIT 0
+
+typedef enum crc_impl_t {
+  CRC_IMPL_BITWISE = 0, // reference implementation, one bit at a time
+  CRC_IMPL_TABLE,       // one 256 entries table lookup per byte
+  CRC_IMPL_SLICE8       // eight tables, eight bytes per iteration (default)
+} crc_impl_t;
+
+uint16_t crc16_ccitt(uint16_t crc, const void *buf, size_t size);
+uint32_t crc32_edc(uint32_t crc, const void *buf, size_t size);
+
+uint16_t crc16_ccitt_impl(crc_impl_t impl, uint16_t crc, const void *buf, size_t size);
+uint32_t crc32_edc_impl(crc_impl_t impl, uint32_t crc, const void *buf, size_t size);
+
+int crc_benchmark(size_t size);
+
+int calc_crc(const unsigned char *buf, int size);
 void update_crc(char *ip);
 
 #endif /* __CRC_H__ */
@@ -0,0 +1,182 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "extract.h"
+
+#include "ip.h"
+#include "pool.h"
+
+typedef struct extract_context_t {
+  vector *files;
+  extract_format_t format;
+  FILE *out;
+  pthread_mutex_t lock;
+  int failed;
+} extract_context_t;
+
+int
+extract_format_parse(char *str, extract_format_t *format)
+{
+  if (!strcmp(str, "txt")) {
+    *format = EXTRACT_FORMAT_TXT;
+  } else if (!strcmp(str, "jsonl")) {
+    *format = EXTRACT_FORMAT_JSONL;
+  } else {
+    return 0;
+  }
+  return 1;
+}
+
+void
+extract_record_begin(buffer_t *out, char *filename, extract_format_t format)
+{
+  if (format == EXTRACT_FORMAT_JSONL) {
+    buffer_append(out, "{\"file\":", 8);
+    buffer_append_json_string(out, filename);
+  } else {
+    buffer_printf(out, "# %s\n", filename);
+  }
+}
+
+void
+extract_record_value(buffer_t *out, extract_format_t format, const char *name,
+  const char *value)
+{
+  if (format == EXTRACT_FORMAT_JSONL) {
+    buffer_append(out, ",", 1);
+    buffer_append_json_string(out, name);
+    buffer_append(out, ":", 1);
+    buffer_append_json_string(out, value);
+  } else {
+    buffer_printf(out, "%-13s : %s\n", name, value);
+  }
+}
+
+void
+extract_record_end(buffer_t *out, extract_format_t format)
+{
+  if (format == EXTRACT_FORMAT_JSONL) {
+    buffer_append(out, "}", 1);
+  }
+  buffer_append(out, "\n", 1);
+}
+
+void
+extract_record_fields(const char *ip, extract_format_t format, buffer_t *out)
+{
+  char value[0x100];
+
+  for (int i = 0; i < NUM_FIELDS; i++) {
+    field_read_value(ip, i, value);
+    extract_record_value(out, format, field_get_name(i), field_pretty(i, value));
+  }
+}
+
+void
+extract_fields(const char *ip, char *filename, extract_format_t format,
+  buffer_t *out)
+{
+  extract_record_begin(out, filename, format);
+  extract_record_fields(ip, format, out);
+  extract_record_end(out, format);
+}
+
+static void
+extract_error(buffer_t *out, char *filename, extract_format_t format,
+  const char *error)
+{
+  if (format == EXTRACT_FORMAT_JSONL) {
+    buffer_append(out, "{\"file\":", 8);
+    buffer_append_json_string(out, filename);
+    buffer_append(out, ",\"error\":", 9);
+    buffer_append_json_string(out, error);
+    buffer_append(out, "}\n", 2);
+  }
+  log_error("%s: %s\n", filename, error);
+}
+
+static void
+extract_job(int index, void *context)
+{
+  extract_context_t *ctx = (extract_context_t *) context;
+  char *filename = VECTOR_GET(*ctx->files, char*, index);
+  mapped_file_t map;
+  buffer_t out;
+  int result = 0;
+
+  buffer_init(&out);
+
+  // IP.BIN files and ISO images share the same layout for the system area
+  if (!file_map(filename, FILE_MAP_READ, &map)) {
+    extract_error(&out, filename, ctx->format, "can't map file");
+  } else if (map.size < IP_FIELDS_SIZE ||
+      memcmp(map.data, IP_HARDWARE_ID, strlen(IP_HARDWARE_ID))) {
+    extract_error(&out, filename, ctx->format, "not a valid bootstrap");
+  } else {
+    extract_fields(map.data, filename, ctx->format, &out);
+    result = 1;
+  }
+
+  file_unmap(&map);
+
+  // each record is written at once, so records never interleave
+  pthread_mutex_lock(&ctx->lock);
+  if (out.size) {
+    fwrite(out.data, 1, out.size, ctx->out);
+  }
+  if (!result) {
+    ctx->failed++;
+  }
+  pthread_mutex_unlock(&ctx->lock);
+
+  buffer_free(&out);
+}
+
+int
+extract_files(vector *files, extract_format_t format, FILE *out)
+{
+  extract_context_t ctx;
+
+  ctx.files = files;
+  ctx.format = format;
+  ctx.out = out;
+  ctx.failed = 0;
+  pthread_mutex_init(&ctx.lock, NULL);
+
+  pool_run(vector_total(files), extract_job, &ctx);
+
+  pthread_mutex_destroy(&ctx.lock);
+  fflush(out);
+
+  return ctx.failed;
+}
@@ -0,0 +1,60 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __EXTRACT_H__
+#define __EXTRACT_H__
+
+#include "global.h"
+
+#include "utils.h"
+#include "vector.h"
+#include "field.h"
+
+typedef enum extract_format_t {
+  EXTRACT_FORMAT_TXT = 0,
+  EXTRACT_FORMAT_JSONL
+} extract_format_t;
+
+int extract_format_parse(char *str, extract_format_t *format);
+
+void extract_record_begin(buffer_t *out, char *filename, extract_format_t format);
+void extract_record_value(buffer_t *out, extract_format_t format, const char *name,
+  const char *value);
+void extract_record_fields(const char *ip, extract_format_t format, buffer_t *out);
+void extract_record_end(buffer_t *out, extract_format_t format);
+
+void extract_fields(const char *ip, char *filename, extract_format_t format,
+  buffer_t *out);
+int extract_files(vector *files, extract_format_t format, FILE *out);
+
+#endif /* __EXTRACT_H__ */
@@ -51,17 +51,27 @@ int g_field_error = 0;
 
 char *field_values[NUM_FIELDS];
 
+// fields explicitly set after initialization (i.e. not using the default)
+int field_modified[NUM_FIELDS];
+
+// Default release date (today); value must hold at least 9 chars
 void
-init_release_date()
+field_release_date_today(char *value)
 {
   time_t now;
   struct tm ts;
-  char tmpbuf[0x10];
 
   time(&now);
-  ts = *localtime(&now);
-  strftime(tmpbuf, sizeof(tmpbuf), "%Y%m%d", &ts); // YYYYMMDD
+  localtime_r(&now, &ts);
+  strftime(value, 9, "%Y%m%d", &ts); // YYYYMMDD
+}
+
+void
+init_release_date()
+{
+  char tmpbuf[0x10];
 
+  field_release_date_today(tmpbuf);
   field_set_value(RELEASE_DATE, tmpbuf);
 }
 
@@ -77,6 +87,9 @@ field_initialize()
 
   // compute default release date
   init_release_date();
+
+  memset(field_modified, 0, sizeof(field_modified));
+  g_field_error = 0;
 }
 
 void
@@ -96,7 +109,26 @@ field_get_value(int index)
 char *
 field_get_pretty_value(int index)
 {
-  char *result = field_get_value(index);
+  return field_pretty(index, field_get_value(index));
+}
+
+char *
+field_get_name(int index)
+{
+  return fields[index].name;
+}
+
+int
+field_get_length(int index)
+{
+  return fields[index].length;
+}
+
+// Normalizes a field value for display (modifies the value)
+char *
+field_pretty(int index, char *value)
+{
+  char *result = value;
   char *deviceinfo = NULL;
 
   switch (index) {
@@ -105,13 +137,45 @@ field_get_pretty_value(int index)
       break;
     case DEVICE_INFO:
       deviceinfo = strchr(result, ' ');
-      result = deviceinfo + 1; // skip the space char
+      if (deviceinfo != NULL) {
+        result = deviceinfo + 1; // skip the space char
+      }
       break;
   }
 
   return result;
 }
 
+// Runs the validator of a field, without touching the stored values
+int
+field_check_value(int index, char *value)
+{
+  field_t *f = &fields[index];
+  return strlen(value) <= f->length &&
+    (f->extra_check == NULL || (*f->extra_check)(f, value));
+}
+
+// Decodes a field from a bootstrap; value must hold the field length + 1
+int
+field_read_value(const char *ip, int index, char *value)
+{
+  field_t *f = &fields[index];
+
+  memcpy(value, ip + f->position, f->length);
+  value[f->length] = '\0';
+
+  // strip the padding then check the value is printable
+  rtrim(value);
+
+  for (char *p = value; *p; p++) {
+    if (!isprint((unsigned char) *p)) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
 int
 field_set_value(int index, char *value)
 {
@@ -142,11 +206,19 @@ field_set_value(int index, char *value)
     return 0;
   }
 
+  field_modified[index] = 1;
+
   log_notice("setting field \"%s\" to \"%s\"\n", f->name, field_get_pretty_value(index));
 
   return 1;
 }
 
+int
+field_is_modified(int index)
+{
+  return field_modified[index];
+}
+
 int
 parse_file(FILE *fh)
 {
@@ -159,7 +231,7 @@ parse_file(FILE *fh)
     line++;
     trim(buf);
 
-    if(*buf) {
+    if(*buf && *buf != '#') {
       if((p = strchr(buf, ':'))) {
         *p++ = '\0';
         trim(buf);
@@ -190,13 +262,15 @@ parse_file(FILE *fh)
   return 1;
 }
 
-void
-field_load(char *in)
+// Reads the values of an ip.txt file, returns 0 on error
+int
+field_load_file(char *in)
 {
-  FILE *fh = fopen(in, "r");
+  FILE *fh = is_stdio(in) ? stdin : fopen(in, "r");
 
   if(fh == NULL) {
-    halt("can't open template: \"%s\"\n", in);
+    log_error("can't open template: \"%s\"\n", in);
+    return 0;
   }
 
   log_notice("loading template \"%s\"\n", in);
@@ -204,20 +278,40 @@ field_load(char *in)
   int result;
   result = parse_file(fh);
 
-  fclose(fh);
+  if (fh != stdin) {
+    fclose(fh);
+  }
 
-  if (!result) {
+  return result;
+}
+
+void
+field_load(char *in)
+{
+  if (!field_load_file(in)) {
     exit(EXIT_FAILURE);
   }
 }
 
+// Writes a checked value (see field_check_value) to a bootstrap
+void
+field_write_string(char *ip, int index, const char *value)
+{
+  memset(ip + fields[index].position, ' ', fields[index].length);
+  memcpy(ip + fields[index].position, value, strlen(value));
+}
+
+void
+field_write_value(char *ip, int index)
+{
+  field_write_string(ip, index, field_get_value(index));
+}
+
 void
 field_write(char *ip)
 {
   for (int i = 0; i < NUM_FIELDS; i++) {
-    memset(ip + fields[i].position, ' ', fields[i].length);
-    char *p = field_get_value(i);
-    memcpy(ip + fields[i].position, p, strlen(p));
+    field_write_value(ip, i);
   }
 }
 
@@ -337,10 +431,14 @@ _check_deviceinfo(field_t *f, char *value)
 
   if (strlen(deviceinfo) == 14) { // '0000 CD-ROMx/y'
     char *device = strchr(deviceinfo, ' ');
-    *device++ = '\0'; // deviceinfo = '0000'; device = 'CD-ROMx/y'
-    result = result && (strlen(deviceinfo) == 4) && is_valid_hex(deviceinfo);
-    memmove(deviceinfo, device, strlen(device)); // deviceinfo = 'CD-ROMx/y'
-    deviceinfo[strlen(device)] = '\0';
+    if (device == NULL) {
+      result = 0;
+    } else {
+      *device++ = '\0'; // deviceinfo = '0000'; device = 'CD-ROMx/y'
+      result = (strlen(deviceinfo) == 4) && is_valid_hex(deviceinfo);
+      memmove(deviceinfo, device, strlen(device)); // deviceinfo = 'CD-ROMx/y'
+      deviceinfo[strlen(device)] = '\0';
+    }
   }
 
   long dummy;
@@ -43,11 +43,22 @@ void field_initialize();
 void field_finalize();
 
 void field_load(char *in);
+int field_load_file(char *in);
 void field_write(char *ip);
+void field_write_value(char *ip, int index);
+void field_write_string(char *ip, int index, const char *value);
 
 char * field_get_value(int index);
 char * field_get_pretty_value(int index);
+char * field_get_name(int index);
+int field_get_length(int index);
+
+int field_read_value(const char *ip, int index, char *value);
+int field_check_value(int index, char *value);
+char * field_pretty(int index, char *value);
 int field_set_value(int index, char *value);
+int field_is_modified(int index);
+void field_release_date_today(char *value);
 
 int field_erroneous();
 
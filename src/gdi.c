@@ -0,0 +1,174 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gdi.h"
+
+#include "output.h"
+#include "pool.h"
+#include "sector.h"
+
+#define GDI_TRACKS 3
+
+// gap between two tracks of the low-density area
+#define GDI_PREGAP 150
+
+// track types as written in the descriptor
+#define GDI_TRACK_AUDIO 0
+#define GDI_TRACK_DATA 4
+
+typedef struct gdi_track_t {
+  int type;
+  uint32_t lba;
+  char *filename;   // full path of the track file
+  char *name;       // name written in the descriptor
+  int result;
+} gdi_track_t;
+
+typedef struct gdi_image_t {
+  iso_options_t *options;
+  const char *ip;
+  gdi_track_t tracks[GDI_TRACKS];
+} gdi_image_t;
+
+static int
+gdi_build_track(gdi_image_t *gdi, int index)
+{
+  gdi_track_t *track = &gdi->tracks[index];
+  iso_options_t options = *gdi->options;
+
+  options.lba = track->lba;
+  options.sector_format = SECTOR_FORMAT_MODE1;
+  options.cdi = 0;
+
+  switch (index) {
+    case 0:
+      {
+        // low-density data track: an empty volume, padded to the minimal
+        // length, which is read by standard CD-ROM drives
+        char *system_area = (char *) calloc(1, INITIAL_PROGRAM_SIZE);
+        options.root = NULL;
+        options.joliet = 0;
+        options.boot_filename = NULL;
+        options.layout = NULL;
+        options.pad_to = 0;
+        options.min_sectors = GDI_LD_TRACK_LENGTH;
+        int result = iso_build(&options, system_area, track->filename);
+        free(system_area);
+        return result;
+      }
+    case 1:
+      {
+        // low-density audio track: silence
+        size_t size = GDI_LD_TRACK_LENGTH * SECTOR_RAW_SIZE;
+        char *silence = (char *) calloc(1, size);
+        int result = output_write(track->filename, silence, size, 0);
+        free(silence);
+        return result;
+      }
+    default:
+      // high-density data track, holding the bootstrap and the game
+      options.capacity = GDI_HD_CAPACITY;
+      return iso_build(&options, gdi->ip, track->filename);
+  }
+}
+
+static void
+gdi_track_job(int index, void *context)
+{
+  gdi_image_t *gdi = (gdi_image_t *) context;
+  gdi->tracks[index].result = gdi_build_track(gdi, index);
+}
+
+int
+gdi_build(iso_options_t *options, const char *ip, char *fn_gdi)
+{
+  static const char *names[GDI_TRACKS] = { "track01.bin", "track02.raw", "track03.bin" };
+  gdi_image_t gdi;
+  int result = 1;
+
+  memset(&gdi, 0, sizeof(gdi));
+  gdi.options = options;
+  gdi.ip = ip;
+
+  // the track files are stored next to the descriptor
+  char *separator = strrchr(fn_gdi, '/');
+  size_t directory_length = (separator != NULL) ? separator - fn_gdi + 1 : 0;
+
+  for (int i = 0; i < GDI_TRACKS; i++) {
+    gdi_track_t *track = &gdi.tracks[i];
+    track->name = (char *) names[i];
+    track->filename = (char *) malloc(directory_length + strlen(names[i]) + 1);
+    memcpy(track->filename, fn_gdi, directory_length);
+    strcpy(track->filename + directory_length, names[i]);
+  }
+
+  gdi.tracks[0].type = GDI_TRACK_DATA;
+  gdi.tracks[0].lba = 0;
+  gdi.tracks[1].type = GDI_TRACK_AUDIO;
+  gdi.tracks[1].lba = GDI_LD_TRACK_LENGTH + GDI_PREGAP;
+  gdi.tracks[2].type = GDI_TRACK_DATA;
+  gdi.tracks[2].lba = GDI_HD_LBA;
+
+  log_notice("building GDI image \"%s\"\n", fn_gdi);
+
+  // the tracks don't depend on each other, and pool_run() may be nested in
+  // iso_build() as each call has its own threads
+  pool_run(GDI_TRACKS, gdi_track_job, &gdi);
+
+  for (int i = 0; i < GDI_TRACKS; i++) {
+    result = result && gdi.tracks[i].result;
+  }
+
+  if (result) {
+    buffer_t descriptor;
+    buffer_init(&descriptor);
+    buffer_printf(&descriptor, "%d\n", GDI_TRACKS);
+    for (int i = 0; i < GDI_TRACKS; i++) {
+      gdi_track_t *track = &gdi.tracks[i];
+      buffer_printf(&descriptor, "%d %u %d %d %s 0\n", i + 1, track->lba, track->type,
+        SECTOR_RAW_SIZE, track->name);
+    }
+    result = output_write(fn_gdi, descriptor.data, descriptor.size, 0);
+    buffer_free(&descriptor);
+  }
+
+  for (int i = 0; i < GDI_TRACKS; i++) {
+    free(gdi.tracks[i].filename);
+  }
+
+  if (result) {
+    log_notice("GDI image successfully written to \"%s\"\n", fn_gdi);
+  }
+
+  return result;
+}
@@ -33,33 +33,169 @@
 
 #include "ip.h"
 
+#include <zlib.h>
+
+#include "iptmpl.h"
+#include "output.h"
+#include "stats.h"
+#include "trace.h"
+
 void
-ip_read(char *ip, char *fn_iptmpl)
+ip_template_default(ip_template_t *tmpl)
 {
-  FILE *fh = fopen(fn_iptmpl, "rb");
+  if (!ip_template_embedded(tmpl, ip_templates[0].name)) {
+    exit(EXIT_FAILURE);
+  }
+}
+
+int
+ip_template_embedded(ip_template_t *tmpl, const char *name)
+{
+  const ip_template_entry_t *entry = NULL;
+  void *data = NULL;
+
+  for (int i = 0; i < IP_TEMPLATE_COUNT; i++) {
+    if (!strcmp(ip_templates[i].name, name)) {
+      entry = &ip_templates[i];
+      break;
+    }
+  }
+
+  if (entry == NULL) {
+    log_error("unknown embedded bootstrap template \"%s\" (available: %s)\n",
+      name, ip_template_get_names());
+    return 0;
+  }
+
+  uint64_t start = stats_start();
+
+  // templates are only decompressed when they are actually selected
+  if (posix_memalign(&data, page_size_get(), INITIAL_PROGRAM_SIZE)) {
+    halt("unable to allocate bootstrap template\n");
+  }
+
+  uLongf size = INITIAL_PROGRAM_SIZE;
+  int result = uncompress((Bytef *) data, &size, entry->compressed_data,
+    entry->compressed_size);
 
-  if(fh == NULL) {
-    halt("can't open bootstrap template: \"%s\"\n", fn_iptmpl);
+  stats_stop(STATS_TEMPLATE, start);
+
+  if (result != Z_OK || size != INITIAL_PROGRAM_SIZE ||
+      crc32(crc32(0L, Z_NULL, 0), (Bytef *) data, size) != entry->crc) {
+    free(data);
+    log_error("embedded bootstrap template \"%s\" is corrupted\n", name);
+    return 0;
   }
 
-  int success = 1;
-  if(fread(ip, 1, INITIAL_PROGRAM_SIZE, fh) != INITIAL_PROGRAM_SIZE) {
-    success = 0;
+  tmpl->name = entry->name;
+  tmpl->data = (char *) data;
+  tmpl->size = INITIAL_PROGRAM_SIZE;
+  tmpl->mapped = 0;
+
+  log_notice("using embedded bootstrap template \"%s\"\n", name);
+
+  return 1;
+}
+
+char *
+ip_template_get_names(void)
+{
+  static char names[256];
+
+  if (!*names) {
+    for (int i = 0; i < IP_TEMPLATE_COUNT; i++) {
+      if (i > 0) {
+        strcat(names, ", ");
+      }
+      strcat(names, ip_templates[i].name);
+    }
   }
 
-  fclose(fh);
+  return names;
+}
+
+// Maps an IP.TMPL file, returns 0 on error
+int
+ip_template_open(ip_template_t *tmpl, char *fn_iptmpl)
+{
+  mapped_file_t map;
+  uint64_t start = stats_start();
+  int mapped;
+
+  // the template is never written, a private mapping is shared with the
+  // page cache and only the pages actually copied are read from the disk
+  mapped = file_map(fn_iptmpl, FILE_MAP_READ, &map);
+  stats_stop(STATS_TEMPLATE, start);
 
-  if (!success) {
-    halt("bootstrap template: read error or wrong input file size\n");
+  if (!mapped) {
+    log_error("can't open bootstrap template: \"%s\"\n", fn_iptmpl);
+    return 0;
+  }
+
+  if (map.size != INITIAL_PROGRAM_SIZE) {
+    file_unmap(&map);
+    log_error("bootstrap template: read error or wrong input file size\n");
+    return 0;
+  }
+
+  tmpl->name = fn_iptmpl;
+  tmpl->data = map.data;
+  tmpl->size = map.size;
+  tmpl->mapped = 1;
+
+  log_notice("successfully replaced default bootstrap template with \"%s\"\n", fn_iptmpl);
+
+  return 1;
+}
+
+void
+ip_template_load(ip_template_t *tmpl, char *fn_iptmpl)
+{
+  if (!ip_template_open(tmpl, fn_iptmpl)) {
+    exit(EXIT_FAILURE);
+  }
+}
+
+void
+ip_template_release(ip_template_t *tmpl)
+{
+  if (tmpl->mapped) {
+    mapped_file_t map = { tmpl->data, tmpl->size };
+    file_unmap(&map);
   } else {
-    log_notice("successfully replaced default bootstrap template with \"%s\"\n", fn_iptmpl);
+    free(tmpl->data);
   }
+  tmpl->data = NULL;
+  tmpl->size = 0;
+  tmpl->mapped = 0;
+}
+
+char *
+ip_create(ip_template_t *tmpl)
+{
+  void *ip = NULL;
+
+  // private copy of the master image, page-aligned so it may be handed as-is
+  // to the output writers
+  if (posix_memalign(&ip, page_size_get(), INITIAL_PROGRAM_SIZE)) {
+    halt("unable to allocate bootstrap data\n");
+  }
+
+  memcpy(ip, tmpl->data, INITIAL_PROGRAM_SIZE);
+
+  return (char *) ip;
+}
+
+void
+ip_destroy(char *ip)
+{
+  free(ip);
 }
 
 void
 ip_write(char *ip, char *fn_ipout, char *fn_imgin, char *fn_imgout)
 {
-  FILE *fh;
+  uint64_t start = trace_start();
 
   update_crc(ip);
 
@@ -67,19 +203,10 @@ ip_write(char *ip, char *fn_ipout, char *fn_imgin, char *fn_imgout)
     mr_inject(ip, fn_imgin, fn_imgout);
   }
 
-  fh = fopen(fn_ipout, "wb");
-  if(fh == NULL) {
-    halt("can't open \"%s\" in write mode\n", fn_ipout);
-  }
-
-  int result = 1;
-  if(fwrite(ip, 1, INITIAL_PROGRAM_SIZE, fh) != INITIAL_PROGRAM_SIZE) {
-    result = 0;
+  // the bootstrap may only be needed in memory (e.g. for an image)
+  if (fn_ipout != NULL && !output_write(fn_ipout, ip, INITIAL_PROGRAM_SIZE, 0)) {
+    exit(EXIT_FAILURE);
   }
 
-  fclose(fh);
-
-  if (!result) {
-    halt("output write error: %s\n", strerror(errno));
-  }
+  trace_stop("ip_write", start);
 }
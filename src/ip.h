@@ -42,7 +42,37 @@
 #include "crc.h"
 #include "mr.h"
 
-void ip_read(char *ip, char *fn_iptmpl);
+// Area of the bootstrap holding the IP fields (see field.c)
+#define IP_FIELDS_SIZE 0x100
+
+// Hardware ID field value, present at the start of every valid bootstrap
+#define IP_HARDWARE_ID "SEGA SEGAKATANA "
+
+// Entry of the embedded templates registry (generated in iptmpl.h)
+typedef struct ip_template_entry_t {
+  const char *name;
+  unsigned long crc;  // CRC-32 of the uncompressed template
+  unsigned long compressed_size;
+  const unsigned char *compressed_data;
+} ip_template_entry_t;
+
+typedef struct ip_template_t {
+  const char *name;
+  char *data;  // read-only master image (INITIAL_PROGRAM_SIZE bytes)
+  size_t size;
+  int mapped;
+} ip_template_t;
+
+void ip_template_default(ip_template_t *tmpl);
+int ip_template_embedded(ip_template_t *tmpl, const char *name);
+void ip_template_load(ip_template_t *tmpl, char *fn_iptmpl);
+int ip_template_open(ip_template_t *tmpl, char *fn_iptmpl);
+char * ip_template_get_names(void);
+void ip_template_release(ip_template_t *tmpl);
+
+char * ip_create(ip_template_t *tmpl);
+void ip_destroy(char *ip);
+
 void ip_write(char *ip, char *fn_ipout, char *fn_imgin, char *fn_imgout);
 
 #endif /* __IP_H__ */
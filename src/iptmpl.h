@@ -1,2774 +1,1436 @@
-/* IP creator (makeip)
- *
- * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
- * All rights reserved.
- *
- * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
- * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
- * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
- * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
- * Alberty (LiENUS).
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- * 1. Redistributions of source code must retain the above copyright notice,
- *    this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in the
- *    documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
- * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
- * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
- * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
- * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
- * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
- * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
- * POSSIBILITY OF SUCH DAMAGE.
- */
+/* Generated by mktmpl, do not edit (see "make templates") */
 
 #ifndef __IPTMPL_H__
 #define __IPTMPL_H__
 
-#include "global.h"
+#include "ip.h"
 
-/* IP.BIN replacement by LiENUS */
-char default_ip_data[INITIAL_PROGRAM_SIZE] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xD0, 0x08, 0xD1, 0x17, 0x10, 0x05, 0xDF, 0x07, 0xD0, 0x08, 0xD1,
-  0x2A, 0x41, 0x2B, 0x40, 0x09, 0x00, 0x53, 0x43, 0x43, 0x38, 0x30, 0x38,
-  0x33, 0x31, 0x09, 0x00, 0x00, 0x10, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFF,
-  0x2B, 0x09, 0x00, 0x00, 0xA8, 0x83, 0x00, 0x8C, 0x00, 0xB7, 0x00, 0xAC,
-  0x0A, 0xD1, 0x0B, 0xD2, 0x0C, 0xD3, 0x0B, 0xD7, 0x23, 0x65, 0x08, 0x45,
-  0x2C, 0x35, 0x18, 0x45, 0x00, 0x45, 0x04, 0xD1, 0x5C, 0x31, 0x3C, 0x31,
-  0x46, 0x60, 0x06, 0x21, 0x10, 0x47, 0xFB, 0x8B, 0x0B, 0x00, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0xE0, 0x01, 0x00, 0x00, 0x00, 0xB0, 0x04, 0x00, 0x00, 0x00, 0x20, 0xA5,
-  0x5C, 0x34, 0x09, 0x45, 0x58, 0x25, 0x02, 0x89, 0x10, 0x45, 0xFD, 0x8F,
-  0x66, 0x24, 0x0B, 0x00, 0x09, 0x00, 0xFF, 0xFF, 0x06, 0xD3, 0x32, 0x85,
-  0x0F, 0x92, 0x09, 0x22, 0x05, 0xD4, 0x42, 0x60, 0x0A, 0x91, 0x09, 0x21,
-  0x2B, 0x21, 0x12, 0x24, 0x23, 0x60, 0x0B, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x2C, 0x00, 0x80, 0xFF, 0x00, 0x2C, 0x70, 0xA0, 0xFF, 0xFC, 0x00, 0x03,
-  0x22, 0x4F, 0x09, 0xB0, 0x09, 0x00, 0x00, 0xE2, 0x06, 0xD3, 0x22, 0x23,
-  0x06, 0xD1, 0x0B, 0x41, 0x09, 0x00, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0xF8, 0x7F, 0x04, 0xD0, 0x02, 0x61, 0x11, 0x1F, 0x0C, 0xA0, 0x09, 0x00,
-  0x9C, 0x3D, 0xED, 0x8C, 0xF8, 0x83, 0x00, 0x8C, 0x38, 0x9D, 0x00, 0x8C,
-  0xF1, 0x52, 0x00, 0xE3, 0x30, 0x22, 0xF1, 0x52, 0x01, 0x72, 0x21, 0x1F,
-  0x03, 0xD2, 0x22, 0x63, 0xF1, 0x51, 0x32, 0x31, 0xF4, 0x8B, 0x08, 0x7F,
-  0x0B, 0x00, 0x09, 0x00, 0x3C, 0x9D, 0x00, 0x8C, 0x22, 0x4F, 0xD8, 0x7F,
-  0x15, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x02, 0x00, 0x09, 0x40, 0x09, 0x40,
-  0x0F, 0xC9, 0x02, 0x2F, 0x02, 0x00, 0x20, 0x93, 0x39, 0x20, 0xF0, 0xCB,
-  0x0E, 0x40, 0x10, 0xD2, 0x0B, 0x42, 0x09, 0x00, 0x09, 0x1F, 0xF2, 0x60,
-  0x0F, 0xC9, 0x08, 0x40, 0x08, 0x40, 0x02, 0x03, 0x13, 0x92, 0x29, 0x23,
-  0x3B, 0x20, 0x0E, 0x40, 0xF9, 0x50, 0x04, 0x88, 0x03, 0x8B, 0x09, 0xE2,
-  0x28, 0x1F, 0x11, 0xA0, 0x09, 0x00, 0xF9, 0x50, 0x01, 0x88, 0x02, 0x89,
-  0xF9, 0x50, 0x03, 0x88, 0x08, 0x8B, 0x08, 0xE2, 0x28, 0x1F, 0x07, 0xA0,
-  0x09, 0x00, 0x0F, 0xFF, 0xEC, 0x9D, 0x00, 0x8C, 0x58, 0x98, 0x00, 0x8C,
-  0x06, 0xE1, 0x18, 0x1F, 0x02, 0x00, 0x09, 0x40, 0x09, 0x40, 0x0F, 0xC9,
-  0x02, 0x2F, 0x02, 0x00, 0x32, 0x93, 0x39, 0x20, 0xF0, 0xCB, 0x0E, 0x40,
-  0xF8, 0x54, 0x18, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF2, 0x60, 0x0F, 0xC9,
-  0x08, 0x40, 0x08, 0x40, 0x02, 0x02, 0x25, 0x93, 0x39, 0x22, 0x2B, 0x20,
-  0x0E, 0x40, 0xF8, 0x54, 0x12, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x01, 0xE4,
-  0x11, 0xD2, 0x0B, 0x42, 0x09, 0x00, 0x11, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0x07, 0x1F, 0x00, 0xE3, 0x31, 0x1F, 0x00, 0xE2, 0x23, 0x1F, 0x0D, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0x06, 0x1F, 0xF6, 0x55, 0xF7, 0x54, 0x0B, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0x05, 0x1F, 0xF5, 0x54, 0x09, 0xD3, 0x0B, 0x43,
-  0x09, 0x00, 0x04, 0x1F, 0x00, 0xE3, 0x32, 0x1F, 0x11, 0xA0, 0x09, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFF, 0x74, 0x90, 0x00, 0x8C, 0x3C, 0x85, 0x00, 0x8C,
-  0x8C, 0x90, 0x00, 0x8C, 0x12, 0x9E, 0x00, 0x8C, 0x1C, 0x9E, 0x00, 0x8C,
-  0x24, 0x9E, 0x00, 0x8C, 0xF2, 0x51, 0x01, 0x71, 0x12, 0x1F, 0x1B, 0x93,
-  0xF2, 0x52, 0x33, 0x32, 0xF8, 0x8B, 0xF1, 0x53, 0x01, 0x73, 0x31, 0x1F,
-  0x15, 0x92, 0xF1, 0x51, 0x23, 0x31, 0x01, 0x8B, 0x01, 0xE3, 0x33, 0x1F,
-  0x08, 0xD2, 0xF4, 0x51, 0x22, 0x31, 0x02, 0x89, 0xF3, 0x53, 0x38, 0x23,
-  0xC7, 0x89, 0x06, 0xD2, 0x22, 0x63, 0x00, 0xE4, 0x0B, 0x43, 0x09, 0x00,
-  0x28, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x10, 0x27, 0xA0, 0x0F,
-  0x80, 0x84, 0x1E, 0x00, 0xE0, 0x00, 0x00, 0xAC, 0x22, 0x4F, 0xF8, 0x7F,
-  0x41, 0x1F, 0x1B, 0xD5, 0xF1, 0x54, 0x1B, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0xB0, 0xB1, 0x09, 0x00, 0x02, 0x2F, 0x77, 0xB1, 0x09, 0x00, 0x18, 0xD6,
-  0x62, 0x66, 0x21, 0x95, 0x21, 0x94, 0x35, 0xB0, 0x09, 0x00, 0x16, 0xD6,
-  0x62, 0x66, 0x1D, 0x95, 0x1B, 0x94, 0x2F, 0xB0, 0x09, 0x00, 0x14, 0xD6,
-  0x62, 0x66, 0x18, 0x95, 0x15, 0x94, 0x29, 0xB0, 0x09, 0x00, 0x15, 0x97,
-  0x15, 0x96, 0x15, 0x95, 0x15, 0x94, 0x10, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0xF2, 0x64, 0xCF, 0xB1, 0x09, 0x00, 0x35, 0xB1, 0x09, 0x00, 0x0D, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0x08, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0xBD, 0x00, 0x54, 0x01, 0xD5, 0x00, 0xED, 0x00, 0x04, 0x01, 0x0C, 0x03,
-  0xBA, 0x00, 0x51, 0x01, 0xC0, 0xC0, 0xC0, 0x00, 0xA0, 0x8A, 0x00, 0x8C,
-  0x98, 0x9D, 0x00, 0x8C, 0x9C, 0x9D, 0x00, 0x8C, 0xA0, 0x9D, 0x00, 0x8C,
-  0x68, 0x8B, 0x00, 0x8C, 0x4C, 0x8B, 0x00, 0x8C, 0x22, 0x4F, 0xEC, 0x7F,
-  0xF3, 0x63, 0x12, 0x73, 0x41, 0x23, 0xF3, 0x62, 0x10, 0x72, 0x51, 0x22,
-  0x63, 0x1F, 0xF3, 0x54, 0x11, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x02, 0x1F,
-  0xF9, 0x85, 0xF1, 0x81, 0xF8, 0x85, 0x01, 0x2F, 0x00, 0xE3, 0x31, 0x1F,
-  0x25, 0xA0, 0x09, 0x00, 0xF3, 0x51, 0xF1, 0x50, 0x1C, 0x00, 0x0E, 0x60,
-  0x4C, 0x88, 0x13, 0x8B, 0xF1, 0x50, 0x01, 0x70, 0x1C, 0x00, 0x0E, 0x60,
-  0x54, 0x88, 0x0D, 0x8B, 0x1F, 0xE6, 0xF3, 0x65, 0xF3, 0x64, 0x02, 0x74,
-  0x1B, 0xB0, 0x09, 0x00, 0xF1, 0x53, 0x02, 0x73, 0x31, 0x1F, 0x0E, 0xA0,
-  0x09, 0x00, 0xFF, 0xFF, 0x60, 0x9C, 0x00, 0x8C, 0xF3, 0x51, 0xF1, 0x50,
-  0x1C, 0x06, 0xF3, 0x65, 0xF3, 0x64, 0x02, 0x74, 0x0B, 0xB0, 0x09, 0x00,
-  0xF1, 0x52, 0x01, 0x72, 0x21, 0x1F, 0xF2, 0x53, 0xF1, 0x51, 0x33, 0x31,
-  0xD6, 0x8B, 0x14, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x22, 0x4F,
-  0xC8, 0x7F, 0x4D, 0x1F, 0x5C, 0x1F, 0xF3, 0x62, 0x2F, 0x72, 0x60, 0x22,
-  0xF3, 0x61, 0x04, 0x71, 0x09, 0xD2, 0x08, 0xE0, 0x09, 0xD3, 0x0B, 0x43,
-  0x09, 0x00, 0x2F, 0xE0, 0xFC, 0x00, 0x20, 0x88, 0x01, 0x89, 0x0D, 0xA0,
-  0x09, 0x00, 0xFD, 0x53, 0x31, 0x61, 0x05, 0x71, 0x11, 0x23, 0x38, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xFF, 0xFF, 0x40, 0x9D, 0x00, 0x8C,
-  0xA8, 0x9B, 0x00, 0x8C, 0x3F, 0xE0, 0x09, 0x1F, 0x25, 0xD1, 0x18, 0x1F,
-  0x25, 0xD3, 0x32, 0x2F, 0x00, 0xE1, 0x1A, 0x1F, 0x15, 0xA0, 0x09, 0x00,
-  0xF2, 0x62, 0x20, 0x63, 0x3C, 0x63, 0x2F, 0xE0, 0xFC, 0x02, 0x20, 0x33,
-  0x01, 0x8B, 0x10, 0xA0, 0x09, 0x00, 0xF2, 0x63, 0x32, 0x84, 0x0C, 0x60,
-  0xF8, 0x52, 0x0C, 0x32, 0x28, 0x1F, 0xF2, 0x61, 0x03, 0x71, 0x12, 0x2F,
-  0xFA, 0x53, 0x01, 0x73, 0x3A, 0x1F, 0xF9, 0x52, 0xFA, 0x51, 0x23, 0x31,
-  0xE6, 0x8B, 0x00, 0xA0, 0x09, 0x00, 0xF3, 0x63, 0x10, 0x73, 0x33, 0x1F,
-  0xF8, 0x52, 0x22, 0x23, 0xF3, 0x53, 0xF2, 0x62, 0x21, 0x84, 0x0C, 0x60,
-  0x32, 0x81, 0xF3, 0x53, 0x14, 0xE0, 0x33, 0x81, 0xF3, 0x53, 0xF3, 0x62,
-  0x04, 0x72, 0x22, 0x13, 0xF3, 0x53, 0x04, 0xE0, 0x3C, 0x80, 0xF3, 0x66,
-  0x10, 0x76, 0xFC, 0x55, 0x51, 0x65, 0xFD, 0x54, 0x41, 0x64, 0x09, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0xFD, 0x52, 0xF2, 0x63, 0x31, 0x84, 0x0C, 0x60,
-  0x02, 0x70, 0x21, 0x61, 0x0C, 0x31, 0x11, 0x22, 0x38, 0x7F, 0x26, 0x4F,
-  0x0B, 0x00, 0x09, 0x00, 0x6E, 0xB4, 0x00, 0xAC, 0xA4, 0x9D, 0x00, 0x8C,
-  0x8C, 0x89, 0x00, 0x8C, 0x22, 0x4F, 0xE8, 0x7F, 0x45, 0x1F, 0xF5, 0x54,
-  0x1A, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x04, 0x1F, 0x00, 0xE3, 0x31, 0x2F,
-  0x00, 0xE2, 0x23, 0x1F, 0x41, 0xA0, 0x09, 0x00, 0x16, 0xD1, 0x11, 0x1F,
-  0xF1, 0x50, 0x00, 0x60, 0x0C, 0x60, 0x20, 0x88, 0x07, 0x8B, 0xF1, 0x62,
-  0x03, 0x72, 0x21, 0x2F, 0xF3, 0x53, 0x01, 0x73, 0x33, 0x1F, 0x2F, 0xA0,
-  0x09, 0x00, 0xF5, 0x52, 0xF3, 0x50, 0x2C, 0x00, 0x0E, 0x60, 0x4C, 0x88,
-  0x0C, 0x8B, 0xF3, 0x50, 0x01, 0x70, 0x2C, 0x00, 0x0E, 0x60, 0x54, 0x88,
-  0x06, 0x8B, 0x1F, 0xE0, 0xF3, 0x80, 0xF3, 0x53, 0x02, 0x73, 0x33, 0x1F,
-  0x07, 0xA0, 0x09, 0x00, 0xF5, 0x51, 0xF3, 0x50, 0x1C, 0x00, 0xF3, 0x80,
-  0xF3, 0x53, 0x01, 0x73, 0x33, 0x1F, 0x08, 0xA0, 0x09, 0x00, 0xFF, 0xFF,
-  0x60, 0x9C, 0x00, 0x8C, 0xA4, 0x9D, 0x00, 0x8C, 0xF1, 0x51, 0x03, 0x71,
-  0x11, 0x1F, 0xF1, 0x53, 0x30, 0x62, 0xF3, 0x84, 0x00, 0x32, 0xF7, 0x8B,
-  0xF1, 0x52, 0x21, 0x84, 0x0C, 0x60, 0xF1, 0x63, 0x0C, 0x33, 0x31, 0x2F,
-  0xF1, 0x62, 0x02, 0x72, 0x21, 0x2F, 0xF4, 0x53, 0xF3, 0x51, 0x33, 0x31,
-  0xBA, 0x8B, 0xF1, 0x63, 0xFE, 0x73, 0x31, 0x2F, 0x33, 0x60, 0x09, 0x00,
-  0x18, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x18, 0x7F, 0x26, 0x4F,
-  0x0B, 0x00, 0x09, 0x00, 0x22, 0x4F, 0xE4, 0x7F, 0x0D, 0xD2, 0x23, 0x1F,
-  0x0D, 0xD3, 0x34, 0x1F, 0x12, 0x92, 0x21, 0x2F, 0x11, 0x90, 0xF1, 0x81,
-  0x00, 0xE0, 0xF4, 0x80, 0x00, 0xE0, 0xF5, 0x80, 0x5A, 0xE7, 0x0B, 0x96,
-  0xF3, 0x65, 0xF3, 0x64, 0x08, 0x74, 0x07, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0x1C, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x2C, 0x01, 0x2A, 0x01,
-  0x40, 0x01, 0xFF, 0xFF, 0x00, 0x3E, 0xED, 0x8C, 0x20, 0xB8, 0x00, 0x8C,
-  0x74, 0x8D, 0x00, 0x8C, 0x22, 0x4F, 0xE4, 0x7F, 0x15, 0xD3, 0x33, 0x1F,
-  0x15, 0xD2, 0x24, 0x1F, 0x1E, 0xE3, 0x31, 0x2F, 0x21, 0x90, 0xF1, 0x81,
-  0x02, 0xE0, 0xF4, 0x80, 0x00, 0xE0, 0xF5, 0x80, 0x5A, 0xE7, 0x1B, 0x96,
-  0xF3, 0x65, 0xF3, 0x64, 0x08, 0x74, 0x0F, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0x0B, 0xD2, 0x23, 0x1F, 0x0D, 0xD3, 0x34, 0x1F, 0xFA, 0x85, 0x0E, 0x70,
-  0x01, 0x2F, 0x0C, 0x90, 0xF1, 0x81, 0x0E, 0xE7, 0x18, 0xE6, 0xF3, 0x65,
-  0xF3, 0x64, 0x08, 0x74, 0x06, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x1C, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xA5, 0x00, 0x40, 0x01, 0xFF, 0xFF,
-  0x00, 0x3E, 0xED, 0x8C, 0x97, 0xA3, 0x00, 0xAC, 0x74, 0x8D, 0x00, 0x8C,
-  0x6C, 0xA2, 0x00, 0xAC, 0x22, 0x4F, 0xE8, 0x7F, 0x00, 0xE3, 0x35, 0x1F,
-  0x19, 0xD5, 0xF3, 0x64, 0x08, 0x74, 0x19, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0x00, 0xE2, 0x21, 0x1F, 0x11, 0xA0, 0x09, 0x00, 0xF1, 0x51, 0x01, 0x71,
-  0xF3, 0x63, 0x08, 0x73, 0x3C, 0x31, 0x10, 0x62, 0xF1, 0x50, 0x3C, 0x01,
-  0x1E, 0x61, 0x1F, 0x22, 0x1A, 0x02, 0xF5, 0x50, 0x2C, 0x30, 0x05, 0x1F,
-  0xF1, 0x52, 0x02, 0x72, 0x21, 0x1F, 0x0C, 0xE3, 0xF1, 0x51, 0x33, 0x31,
-  0xEA, 0x8B, 0x0C, 0xD2, 0x22, 0x63, 0x32, 0x2F, 0x0F, 0x93, 0xF2, 0x61,
-  0x39, 0x21, 0x12, 0x2F, 0xF5, 0x52, 0x17, 0x02, 0x1A, 0x02, 0x25, 0x1F,
-  0xF5, 0x50, 0x18, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x18, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x3F, 0xFF, 0x48, 0x9D, 0x00, 0x8C,
-  0x4C, 0x9C, 0x00, 0x8C, 0xD0, 0x80, 0x5F, 0xA0, 0xEC, 0x7F, 0x44, 0x1F,
-  0x13, 0xD2, 0xF4, 0x53, 0x20, 0x33, 0x20, 0x89, 0x12, 0xD1, 0x12, 0x63,
-  0x31, 0x1F, 0x12, 0xD0, 0x02, 0x63, 0x32, 0x2F, 0x00, 0xE0, 0xF6, 0x81,
-  0x13, 0xA0, 0x09, 0x00, 0xF4, 0x84, 0xFF, 0x80, 0xF0, 0x60, 0xFE, 0x80,
-  0xF1, 0x53, 0x18, 0x43, 0xFE, 0x84, 0x0C, 0x60, 0x0C, 0x33, 0x31, 0x1F,
-  0xF2, 0x62, 0x18, 0x42, 0xFF, 0x84, 0x0C, 0x60, 0x0C, 0x32, 0x22, 0x2F,
-  0xF6, 0x85, 0x01, 0x70, 0xF6, 0x81, 0xF6, 0x85, 0x06, 0xE3, 0x33, 0x30,
-  0xE8, 0x8B, 0x14, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0x68, 0xB7, 0x67, 0x00,
-  0x54, 0x9D, 0x00, 0x8C, 0x58, 0x9D, 0x00, 0x8C, 0x22, 0x4F, 0xD8, 0x7F,
-  0xF3, 0x63, 0x26, 0x73, 0x41, 0x23, 0xF3, 0x62, 0x24, 0x72, 0x51, 0x22,
-  0x68, 0x1F, 0x00, 0xE2, 0x22, 0x2F, 0xF8, 0x50, 0x0C, 0x84, 0x0C, 0x60,
-  0x01, 0xC8, 0x05, 0x89, 0x03, 0xE0, 0xF7, 0x80, 0x02, 0xE3, 0x33, 0x1F,
-  0x04, 0xA0, 0x09, 0x00, 0x01, 0xE0, 0xF7, 0x80, 0x01, 0xE3, 0x33, 0x1F,
-  0xF8, 0x50, 0x0C, 0x84, 0x0C, 0x60, 0x04, 0xC8, 0x01, 0x89, 0x01, 0xE2,
-  0x22, 0x2F, 0xF8, 0x53, 0x32, 0x62, 0x26, 0x1F, 0x00, 0xE3, 0x32, 0x1F,
-  0x4D, 0xA0, 0x09, 0x00, 0xF6, 0x51, 0x01, 0x71, 0x16, 0x1F, 0xFF, 0x71,
-  0x10, 0x63, 0x1F, 0xE0, 0x34, 0x0F, 0xF3, 0x53, 0x08, 0xE2, 0x38, 0x32,
-  0x25, 0x1F, 0x3D, 0xA0, 0x09, 0x00, 0x1F, 0xE0, 0xFC, 0x03, 0x3C, 0x63,
-  0xF5, 0x52, 0x2B, 0x62, 0x2D, 0x43, 0xF7, 0x84, 0x0C, 0x60, 0x09, 0x23,
-  0x34, 0x1F, 0xF2, 0x60, 0x01, 0x88, 0x01, 0x8B, 0x38, 0x23, 0x1B, 0x89,
-  0xF8, 0x50, 0xF4, 0x56, 0x08, 0x46, 0x02, 0x50, 0x6E, 0x06, 0xF8, 0x50,
-  0x02, 0x85, 0xF2, 0x51, 0x1B, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF3, 0x62,
-  0x24, 0x72, 0x21, 0x65, 0x0C, 0x35, 0xF8, 0x50, 0x02, 0x85, 0xF2, 0x51,
-  0x17, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF3, 0x62, 0x26, 0x72, 0x21, 0x64,
-  0x0C, 0x34, 0x15, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF2, 0x52, 0x01, 0x72,
-  0x22, 0x1F, 0xF8, 0x53, 0x32, 0x85, 0x03, 0x63, 0xF8, 0x51, 0x13, 0x85,
-  0x0F, 0x23, 0x1A, 0x00, 0x03, 0x32, 0x01, 0x8B, 0x07, 0xA0, 0x09, 0x00,
-  0xF3, 0x53, 0xF5, 0x52, 0x38, 0x32, 0x25, 0x1F, 0xF5, 0x51, 0x11, 0x41,
-  0xBF, 0x89, 0xF8, 0x52, 0x22, 0x85, 0x03, 0x62, 0xF8, 0x53, 0x33, 0x85,
-  0x0F, 0x22, 0x1A, 0x00, 0xF2, 0x53, 0x03, 0x33, 0xA8, 0x8B, 0x28, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xFF, 0xFF, 0xCC, 0x98, 0x00, 0x8C,
-  0x28, 0x9A, 0x00, 0x8C, 0xD0, 0x8A, 0x00, 0x8C, 0x22, 0x4F, 0xF8, 0x7F,
-  0x41, 0x1F, 0x52, 0x2F, 0xF2, 0x66, 0x06, 0xD5, 0x06, 0xD4, 0x07, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0x08, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0x08, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x00, 0xC0, 0x12, 0x00,
-  0x00, 0x40, 0xED, 0x8C, 0x6C, 0x83, 0x00, 0x8C, 0xF0, 0x7F, 0x43, 0x1F,
-  0x52, 0x1F, 0x61, 0x1F, 0x0D, 0xD2, 0x22, 0x2F, 0xF2, 0x53, 0x14, 0x91,
-  0x38, 0x31, 0x13, 0x62, 0x08, 0x41, 0x2C, 0x31, 0x08, 0x41, 0x08, 0x41,
-  0x08, 0x41, 0x00, 0x41, 0xF3, 0x50, 0x08, 0x31, 0x0A, 0x92, 0x2C, 0x31,
-  0x08, 0x41, 0xF2, 0x63, 0x1C, 0x33, 0x32, 0x2F, 0xF1, 0x51, 0x12, 0x23,
-  0x10, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0xDF, 0x01, 0x7F, 0x02, 0xFF, 0xFF,
-  0x00, 0x40, 0xED, 0x8C, 0xF4, 0x7F, 0x42, 0x1F, 0x51, 0x1F, 0x0B, 0xD3,
-  0x32, 0x2F, 0xF1, 0x52, 0x23, 0x63, 0x08, 0x42, 0x3C, 0x32, 0x08, 0x42,
-  0x08, 0x42, 0x08, 0x42, 0x00, 0x42, 0xF2, 0x51, 0x1C, 0x32, 0x08, 0x42,
-  0xF2, 0x63, 0x2C, 0x33, 0x32, 0x2F, 0x32, 0x60, 0x0C, 0x7F, 0x0B, 0x00,
-  0x09, 0x00, 0x0C, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0x00, 0x40, 0xED, 0x8C,
-  0x22, 0x4F, 0xF8, 0x7F, 0x1A, 0xD2, 0x21, 0x1F, 0x00, 0xE3, 0x32, 0x2F,
-  0xF1, 0x54, 0x19, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x08, 0x7F, 0x26, 0x4F,
-  0x0B, 0x00, 0x09, 0x00, 0x86, 0x2F, 0x22, 0x4F, 0xF0, 0x7F, 0xF3, 0x63,
-  0x0E, 0x73, 0x41, 0x23, 0xF3, 0x62, 0x0C, 0x72, 0x51, 0x22, 0xF3, 0x63,
-  0x0A, 0x73, 0x61, 0x23, 0xF3, 0x62, 0x08, 0x72, 0x71, 0x22, 0x0D, 0xD3,
-  0x31, 0x1F, 0x00, 0xE2, 0x22, 0x2F, 0xF6, 0x85, 0x11, 0x93, 0x08, 0x33,
-  0x33, 0x62, 0x08, 0x43, 0x2C, 0x33, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43,
-  0x00, 0x43, 0xF7, 0x85, 0x08, 0x33, 0x07, 0x92, 0x2C, 0x33, 0x08, 0x43,
-  0xF1, 0x51, 0x3C, 0x31, 0x11, 0x1F, 0x2F, 0xA0, 0x09, 0x00, 0xDF, 0x01,
-  0x7F, 0x02, 0xFF, 0xFF, 0x00, 0x40, 0xED, 0x8C, 0x30, 0x83, 0x00, 0x8C,
-  0xF1, 0x52, 0x04, 0x72, 0x21, 0x1F, 0xFC, 0x72, 0x23, 0x68, 0xF1, 0x54,
-  0x40, 0xB0, 0x09, 0x00, 0x02, 0x28, 0xF5, 0x85, 0x03, 0x63, 0xF7, 0x85,
-  0x08, 0x33, 0x33, 0x60, 0x09, 0x00, 0x01, 0x70, 0xF2, 0x61, 0x19, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0x03, 0x62, 0xF5, 0x85, 0x03, 0x63, 0xF7, 0x85,
-  0x08, 0x33, 0x30, 0x32, 0x09, 0x8B, 0xF7, 0x85, 0x03, 0x63, 0xF5, 0x85,
-  0x08, 0x33, 0x20, 0x92, 0x2C, 0x33, 0x08, 0x43, 0xF1, 0x51, 0x3C, 0x31,
-  0x11, 0x1F, 0xF2, 0x63, 0x01, 0x73, 0x32, 0x2F, 0xF4, 0x85, 0x17, 0x93,
-  0x08, 0x33, 0x33, 0x62, 0x08, 0x43, 0x2C, 0x33, 0x08, 0x43, 0x08, 0x43,
-  0x08, 0x43, 0x00, 0x43, 0xF5, 0x85, 0x08, 0x33, 0x0B, 0x92, 0x2C, 0x33,
-  0x08, 0x43, 0x07, 0xD1, 0x1C, 0x33, 0xF1, 0x50, 0x32, 0x30, 0xC3, 0x8B,
-  0x10, 0x7F, 0x26, 0x4F, 0xF6, 0x68, 0x0B, 0x00, 0x09, 0x00, 0x7F, 0x02,
-  0xDF, 0x01, 0xFF, 0xFF, 0x28, 0x9A, 0x00, 0x8C, 0x00, 0x40, 0xED, 0x8C,
-  0x22, 0x4F, 0xEC, 0x7F, 0x44, 0x1F, 0xF3, 0x67, 0x0E, 0x77, 0xF3, 0x66,
-  0x0D, 0x76, 0xF3, 0x65, 0x0C, 0x75, 0xF4, 0x54, 0x42, 0x64, 0x6F, 0xB0,
-  0x09, 0x00, 0xF3, 0x67, 0x0A, 0x77, 0xF3, 0x66, 0x09, 0x76, 0xF3, 0x65,
-  0x08, 0x75, 0xF4, 0x52, 0x21, 0x54, 0x65, 0xB0, 0x09, 0x00, 0xF3, 0x67,
-  0x06, 0x77, 0xF3, 0x66, 0x05, 0x76, 0xF3, 0x65, 0x04, 0x75, 0xF4, 0x52,
-  0x51, 0x90, 0x2E, 0x04, 0x5A, 0xB0, 0x09, 0x00, 0xF3, 0x67, 0x02, 0x77,
-  0xF3, 0x66, 0x01, 0x76, 0xF3, 0x65, 0xF4, 0x52, 0x48, 0x90, 0x2E, 0x04,
-  0x50, 0xB0, 0x09, 0x00, 0xFC, 0x84, 0x0C, 0x60, 0x03, 0x63, 0x00, 0x40,
-  0x3C, 0x30, 0x03, 0x61, 0xF8, 0x84, 0x0C, 0x60, 0x0C, 0x31, 0xF4, 0x84,
-  0x0C, 0x60, 0x0C, 0x31, 0xF0, 0x63, 0x3C, 0x63, 0x3C, 0x31, 0x06, 0xE0,
-  0x1B, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x28, 0x40, 0x03, 0x62, 0xFD, 0x84,
-  0x0C, 0x60, 0x03, 0x63, 0x00, 0x40, 0x3C, 0x30, 0x03, 0x61, 0xF9, 0x84,
-  0x0C, 0x60, 0x0C, 0x31, 0xF5, 0x84, 0x0C, 0x60, 0x0C, 0x31, 0xF1, 0x84,
-  0x0C, 0x60, 0x0C, 0x31, 0x06, 0xE0, 0x11, 0xD3, 0x0B, 0x43, 0x09, 0x00,
-  0x18, 0x40, 0x2B, 0x20, 0x03, 0x62, 0xFE, 0x84, 0x0C, 0x60, 0x03, 0x63,
-  0x00, 0x40, 0x3C, 0x30, 0x03, 0x61, 0xFA, 0x84, 0x0C, 0x60, 0x0C, 0x31,
-  0xF6, 0x84, 0x0C, 0x60, 0x0C, 0x31, 0xF2, 0x84, 0x0C, 0x60, 0x0C, 0x31,
-  0x06, 0xE0, 0x06, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0x2B, 0x20, 0x05, 0xD3,
-  0x39, 0x20, 0x14, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x00, 0x0A,
-  0x04, 0x0A, 0xFF, 0xFF, 0xCC, 0x98, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0x00,
-  0x14, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xF0, 0x7F, 0x43, 0x1F,
-  0x52, 0x1F, 0x61, 0x1F, 0x72, 0x2F, 0xF2, 0x52, 0xF3, 0x53, 0x29, 0x43,
-  0x30, 0x22, 0xF1, 0x52, 0xF3, 0x53, 0x19, 0x43, 0x30, 0x22, 0xF2, 0x62,
-  0xF3, 0x53, 0x30, 0x22, 0x10, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0xFF, 0xFF,
-  0x22, 0x4F, 0xD0, 0x7F, 0x4B, 0x1F, 0x5A, 0x1F, 0xF3, 0x63, 0x26, 0x73,
-  0x61, 0x23, 0xF3, 0x62, 0x24, 0x72, 0x71, 0x22, 0xFB, 0x53, 0x32, 0x52,
-  0x28, 0x1F, 0xF8, 0x50, 0x00, 0x60, 0x0C, 0x60, 0x4D, 0x88, 0x04, 0x8B,
-  0xF8, 0x52, 0x21, 0x84, 0x0C, 0x60, 0x52, 0x88, 0x03, 0x89, 0x30, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xF8, 0x52, 0x02, 0x72, 0x28, 0x1F,
-  0x23, 0x64, 0x23, 0xB1, 0x09, 0x00, 0x06, 0x1F, 0xFB, 0x53, 0xF6, 0x52,
-  0x22, 0x23, 0xF8, 0x53, 0x08, 0x73, 0x38, 0x1F, 0x33, 0x64, 0x19, 0xB1,
-  0x09, 0x00, 0x06, 0x1F, 0xFB, 0x53, 0xF6, 0x52, 0x32, 0x51, 0x2C, 0x31,
-  0x15, 0x1F, 0xF8, 0x53, 0x04, 0x73, 0x38, 0x1F, 0x33, 0x64, 0x0D, 0xB1,
-  0x09, 0x00, 0x06, 0x1F, 0xFB, 0x53, 0xFC, 0x85, 0x36, 0x81, 0xF8, 0x53,
-  0x04, 0x73, 0x38, 0x1F, 0x33, 0x64, 0x03, 0xB1, 0x09, 0x00, 0x06, 0x1F,
-  0xFB, 0x53, 0xFC, 0x85, 0x37, 0x81, 0xF8, 0x53, 0x04, 0x73, 0x38, 0x1F,
-  0x33, 0x64, 0xF9, 0xB0, 0x09, 0x00, 0x06, 0x1F, 0xFB, 0x53, 0xFC, 0x85,
-  0x38, 0x81, 0xF8, 0x53, 0x04, 0x73, 0x38, 0x1F, 0x33, 0x64, 0xEF, 0xB0,
-  0x09, 0x00, 0x06, 0x1F, 0xFB, 0x53, 0xFC, 0x85, 0x39, 0x81, 0xF8, 0x53,
-  0x04, 0x73, 0x38, 0x1F, 0x00, 0xE2, 0x24, 0x1F, 0x10, 0xA0, 0x09, 0x00,
-  0xF8, 0x54, 0xE1, 0xB0, 0x09, 0x00, 0x06, 0x1F, 0xFB, 0x50, 0xF4, 0x53,
-  0x08, 0x43, 0x01, 0x50, 0xF6, 0x52, 0x26, 0x03, 0xF8, 0x53, 0x04, 0x73,
-  0x38, 0x1F, 0xF4, 0x52, 0x01, 0x72, 0x24, 0x1F, 0xFB, 0x53, 0x39, 0x85,
-  0xF4, 0x53, 0x02, 0x33, 0xEA, 0x8B, 0xF5, 0x50, 0x08, 0x1F, 0x00, 0xE0,
-  0xF1, 0x81, 0x00, 0xE3, 0x31, 0x2F, 0x00, 0xE2, 0x24, 0x1F, 0x6F, 0xA0,
-  0x09, 0x00, 0xF3, 0x66, 0x1F, 0x76, 0xF3, 0x65, 0x04, 0x75, 0xF8, 0x54,
-  0x78, 0xB0, 0x09, 0x00, 0x02, 0x1F, 0xF8, 0x53, 0x0C, 0x33, 0x38, 0x1F,
-  0xFA, 0x50, 0x04, 0x84, 0x0C, 0x60, 0x02, 0x88, 0x1F, 0x8B, 0x1F, 0xE0,
-  0xFC, 0x02, 0xFA, 0x53, 0x35, 0x84, 0x00, 0x32, 0x19, 0x8B, 0xF1, 0x53,
-  0xF4, 0x52, 0x3C, 0x32, 0x24, 0x1F, 0xF1, 0x85, 0x03, 0x61, 0x3C, 0x31,
-  0xFB, 0x50, 0x06, 0x85, 0x0A, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF1, 0x62,
-  0x0C, 0x32, 0x21, 0x2F, 0xF1, 0x85, 0xF1, 0x51, 0x0C, 0x31, 0xFB, 0x50,
-  0x06, 0x85, 0x06, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF1, 0x81, 0x3F, 0xA0,
-  0x09, 0x00, 0x00, 0xE2, 0x23, 0x1F, 0x37, 0xA0, 0x09, 0x00, 0xFF, 0xFF,
-  0x80, 0x99, 0x00, 0x8C, 0xF0, 0x9A, 0x00, 0x8C, 0xF1, 0x85, 0xF3, 0x61,
-  0x26, 0x71, 0x11, 0x63, 0x33, 0x30, 0x17, 0x89, 0xF1, 0x62, 0x24, 0xE0,
-  0xFD, 0x03, 0x33, 0x32, 0x12, 0x89, 0xFB, 0x50, 0xF3, 0x61, 0x1F, 0x71,
-  0x10, 0x66, 0x6C, 0x66, 0x08, 0x46, 0x01, 0x50, 0x6E, 0x06, 0xFA, 0x55,
-  0x51, 0x85, 0xF1, 0x65, 0x0C, 0x35, 0xFA, 0x54, 0x41, 0x64, 0xF1, 0x85,
-  0x0C, 0x34, 0x14, 0xD3, 0x0B, 0x43, 0x09, 0x00, 0xF4, 0x52, 0x01, 0x72,
-  0x24, 0x1F, 0xF1, 0x85, 0x01, 0x70, 0xF1, 0x81, 0x0F, 0x60, 0x03, 0x62,
-  0xFB, 0x53, 0x36, 0x85, 0x03, 0x32, 0x04, 0x8B, 0x00, 0xE0, 0xF1, 0x81,
-  0xF1, 0x63, 0x01, 0x73, 0x31, 0x2F, 0xF3, 0x52, 0x01, 0x72, 0x23, 0x1F,
-  0xF1, 0x53, 0xF3, 0x51, 0x32, 0x31, 0xC9, 0x8B, 0xFB, 0x53, 0x36, 0x85,
-  0x03, 0x63, 0xFB, 0x52, 0x27, 0x85, 0x0F, 0x23, 0x1A, 0x00, 0xF4, 0x53,
-  0x02, 0x33, 0x86, 0x8B, 0x30, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0xD0, 0x8A, 0x00, 0x8C, 0xF0, 0x7F, 0x43, 0x1F, 0x52, 0x1F, 0x61, 0x1F,
-  0xF2, 0x50, 0x00, 0xE3, 0x32, 0x20, 0x01, 0xE2, 0x22, 0x2F, 0xF3, 0x50,
-  0x00, 0x60, 0x0C, 0x60, 0x80, 0xC8, 0x08, 0x8B, 0xF2, 0x52, 0x01, 0xE3,
-  0x32, 0x22, 0xF1, 0x52, 0xF3, 0x53, 0x30, 0x61, 0x10, 0x22, 0x1E, 0xA0,
-  0x09, 0x00, 0x13, 0xA0, 0x09, 0x00, 0xF2, 0x53, 0x07, 0xE2, 0x32, 0x61,
-  0x2D, 0x41, 0x12, 0x23, 0xF2, 0x53, 0xF3, 0x50, 0x01, 0x70, 0x03, 0x1F,
-  0xFF, 0x70, 0x00, 0x60, 0x0C, 0x60, 0x7F, 0xC9, 0x32, 0x61, 0x0B, 0x21,
-  0x12, 0x23, 0xF2, 0x63, 0x01, 0x73, 0x32, 0x2F, 0xF3, 0x50, 0x00, 0x60,
-  0x0C, 0x60, 0x80, 0xC8, 0xE7, 0x8B, 0xF1, 0x52, 0xF3, 0x53, 0x30, 0x61,
-  0x10, 0x22, 0xF2, 0x60, 0x10, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0x10, 0x7F,
-  0x0B, 0x00, 0x09, 0x00, 0xFC, 0x7F, 0x42, 0x2F, 0xF2, 0x60, 0x00, 0x60,
-  0x04, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0x04, 0x7F, 0x0B, 0x00, 0x09, 0x00,
-  0x22, 0x4F, 0xF0, 0x7F, 0x43, 0x1F, 0x00, 0xE2, 0x22, 0x1F, 0x00, 0xE3,
-  0x31, 0x1F, 0x12, 0xA0, 0x09, 0x00, 0xF1, 0x53, 0xF3, 0x54, 0x3C, 0x34,
-  0xE8, 0xBF, 0x09, 0x00, 0xF3, 0x80, 0x0E, 0x60, 0x0C, 0x60, 0xF1, 0x53,
-  0x08, 0x43, 0x00, 0x43, 0x3D, 0x40, 0xF2, 0x53, 0x0C, 0x33, 0x32, 0x1F,
-  0xF1, 0x52, 0x01, 0x72, 0x21, 0x1F, 0x04, 0xE3, 0xF1, 0x51, 0x32, 0x31,
-  0xE9, 0x8B, 0xF2, 0x50, 0x10, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0x10, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xF4, 0x7F, 0x42, 0x1F,
-  0x51, 0x1F, 0x62, 0x2F, 0xF2, 0x52, 0x08, 0x42, 0xF1, 0x53, 0x33, 0x61,
-  0x08, 0x43, 0x1C, 0x33, 0x18, 0x43, 0x00, 0x43, 0x3C, 0x32, 0x08, 0xD3,
-  0x3C, 0x32, 0xF2, 0x61, 0x12, 0x22, 0x0C, 0x7F, 0x0B, 0x00, 0x09, 0x00,
-  0x22, 0x4F, 0xFC, 0x7F, 0x42, 0x2F, 0xF2, 0x64, 0xD8, 0xB3, 0x09, 0x00,
-  0x04, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0xA5,
-  0xFC, 0x7F, 0x42, 0x2F, 0x08, 0xE2, 0x15, 0xD3, 0x22, 0x23, 0x00, 0xA0,
-  0x09, 0x00, 0x13, 0xD3, 0x32, 0x60, 0x08, 0xC8, 0xFB, 0x89, 0xF2, 0x60,
-  0x01, 0x88, 0x0D, 0x8B, 0x10, 0xD3, 0x32, 0x62, 0x10, 0xD0, 0x02, 0x61,
-  0x44, 0xE0, 0x16, 0x02, 0x0D, 0xD2, 0x22, 0x63, 0x0E, 0xD0, 0x02, 0x61,
-  0x12, 0x90, 0x16, 0x03, 0x0D, 0xA0, 0x09, 0x00, 0x09, 0xD3, 0x32, 0x62,
-  0x0A, 0xD1, 0x12, 0x60, 0x08, 0xCB, 0x09, 0x93, 0x2C, 0x33, 0x02, 0x23,
-  0x05, 0xD3, 0x32, 0x62, 0x00, 0xE1, 0x44, 0xE0, 0x16, 0x02, 0x04, 0x7F,
-  0x0B, 0x00, 0x09, 0x00, 0xE8, 0x00, 0xFF, 0xFF, 0x00, 0x69, 0x5F, 0xA0,
-  0xE8, 0x9D, 0x00, 0x8C, 0x24, 0x3D, 0xED, 0x8C, 0x18, 0x3D, 0xED, 0x8C,
-  0x22, 0x4F, 0xE8, 0x7F, 0x45, 0x1F, 0x22, 0xD3, 0x32, 0x62, 0x22, 0x61,
-  0x14, 0x1F, 0x32, 0x62, 0x00, 0xE1, 0x12, 0x12, 0x1F, 0xD2, 0x20, 0x60,
-  0x0C, 0x60, 0x28, 0x40, 0x08, 0xCB, 0x1E, 0xD1, 0x02, 0x21, 0x0C, 0xE3,
-  0x1D, 0xD0, 0x32, 0x20, 0xF5, 0x50, 0x09, 0x88, 0x06, 0x8B, 0x1B, 0xD3,
-  0x1B, 0xD2, 0x32, 0x60, 0x2B, 0x20, 0x02, 0x23, 0x00, 0xA0, 0x09, 0x00,
-  0x14, 0xD3, 0x32, 0x61, 0x18, 0xD2, 0x40, 0xE0, 0x26, 0x01, 0x00, 0xE4,
-  0xA4, 0xBF, 0x09, 0x00, 0x1A, 0x92, 0x23, 0x1F, 0x0F, 0xD1, 0x12, 0x63,
-  0xF3, 0x52, 0x2C, 0x13, 0x12, 0x63, 0x13, 0xD2, 0x13, 0x90, 0x26, 0x03,
-  0x12, 0x63, 0x11, 0xD2, 0x10, 0x90, 0x26, 0x03, 0x12, 0x63, 0x10, 0xD2,
-  0x0D, 0x90, 0x26, 0x03, 0x0C, 0x93, 0x12, 0x62, 0x3C, 0x32, 0x21, 0x1F,
-  0x0D, 0xD3, 0x32, 0x2F, 0x00, 0xE2, 0x22, 0x1F, 0x25, 0xA0, 0x09, 0x00,
-  0x01, 0x01, 0xB0, 0x00, 0xB4, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-  0xE8, 0x9D, 0x00, 0x8C, 0x2C, 0x00, 0x00, 0xAC, 0x18, 0x3D, 0xED, 0x8C,
-  0x24, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0x80, 0x00, 0xC0, 0xC0, 0xC0, 0x00,
-  0x7F, 0x7F, 0x7F, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00,
-  0xF1, 0x51, 0x04, 0x71, 0x11, 0x1F, 0xFC, 0x71, 0xF2, 0x63, 0x32, 0x21,
-  0x23, 0x93, 0xF2, 0x62, 0x38, 0x32, 0x22, 0x2F, 0xF2, 0x51, 0x01, 0x71,
-  0x12, 0x1F, 0x1D, 0x93, 0xF2, 0x52, 0x33, 0x32, 0xEE, 0x8B, 0x0F, 0xD1,
-  0x12, 0x63, 0x01, 0xE2, 0x22, 0x13, 0x12, 0x63, 0x00, 0xE2, 0x22, 0x13,
-  0x0C, 0xD0, 0x02, 0x63, 0x00, 0xE2, 0x10, 0x90, 0x26, 0x03, 0x0A, 0xD1,
-  0x12, 0x63, 0x00, 0xE2, 0x0C, 0x90, 0x26, 0x03, 0xF4, 0x50, 0x18, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x18, 0x7F, 0x26, 0x4F, 0x0B, 0x00,
-  0x09, 0x00, 0x01, 0x01, 0x80, 0x00, 0x84, 0x08, 0x88, 0x08, 0xFF, 0xFF,
-  0xE8, 0x9D, 0x00, 0x8C, 0xE4, 0x9D, 0x00, 0x8C, 0xFC, 0x7F, 0x44, 0xD2,
-  0x22, 0x63, 0x44, 0xD1, 0x75, 0x90, 0x16, 0x03, 0x22, 0x63, 0x43, 0xD1,
-  0x72, 0x90, 0x16, 0x03, 0x22, 0x63, 0x00, 0xE1, 0x6F, 0x90, 0x16, 0x03,
-  0x22, 0x63, 0x40, 0xD1, 0x6C, 0x90, 0x16, 0x03, 0x22, 0x63, 0x3F, 0xD1,
-  0x69, 0x90, 0x16, 0x03, 0x22, 0x63, 0x3E, 0xD1, 0x66, 0x90, 0x16, 0x03,
-  0x22, 0x63, 0x38, 0xD1, 0x63, 0x90, 0x16, 0x03, 0x22, 0x63, 0x3B, 0xD1,
-  0x60, 0x90, 0x16, 0x03, 0x22, 0x63, 0x3A, 0xD0, 0x02, 0x61, 0xFF, 0x71,
-  0x28, 0x41, 0x39, 0xD0, 0x09, 0x21, 0x68, 0xE0, 0x16, 0x03, 0x22, 0x63,
-  0x37, 0xD0, 0x02, 0x61, 0xFF, 0x71, 0x28, 0x41, 0x34, 0xD0, 0x09, 0x21,
-  0x6C, 0xE0, 0x16, 0x03, 0x22, 0x63, 0x34, 0xD1, 0x4B, 0x90, 0x16, 0x03,
-  0x22, 0x63, 0x33, 0xD0, 0x02, 0x61, 0x47, 0x90, 0x16, 0x03, 0x22, 0x63,
-  0x31, 0xD0, 0x02, 0x61, 0x43, 0x90, 0x16, 0x03, 0x22, 0x63, 0x30, 0xD0,
-  0x02, 0x61, 0x3F, 0x90, 0x16, 0x03, 0x22, 0x63, 0x2E, 0xD0, 0x02, 0x61,
-  0x3B, 0x90, 0x16, 0x03, 0x22, 0x63, 0x2D, 0xD0, 0x02, 0x61, 0x37, 0x90,
-  0x16, 0x03, 0x22, 0x63, 0x2B, 0xD1, 0x12, 0x60, 0x60, 0xE1, 0x3C, 0x31,
-  0x02, 0x21, 0x22, 0x63, 0x29, 0xD1, 0x12, 0x60, 0x64, 0xE1, 0x3C, 0x31,
-  0x02, 0x21, 0x22, 0x63, 0x27, 0xD0, 0x02, 0x61, 0x48, 0xE0, 0x16, 0x03,
-  0x22, 0x63, 0x26, 0xD0, 0x02, 0x61, 0x4C, 0xE0, 0x16, 0x03, 0x22, 0x63,
-  0x24, 0xD1, 0x12, 0x60, 0x50, 0xE1, 0x3C, 0x31, 0x02, 0x21, 0x22, 0x63,
-  0x22, 0xD1, 0x12, 0x60, 0x54, 0xE1, 0x3C, 0x31, 0x02, 0x21, 0x22, 0x63,
-  0x20, 0xD0, 0x02, 0x61, 0x5C, 0xE0, 0x16, 0x03, 0x22, 0x63, 0x3D, 0xA0,
-  0x09, 0x00, 0x24, 0x01, 0x2C, 0x01, 0x28, 0x01, 0x30, 0x01, 0x3C, 0x01,
-  0x40, 0x01, 0x64, 0x01, 0x44, 0x01, 0x10, 0x01, 0xD0, 0x00, 0xD4, 0x00,
-  0xDC, 0x00, 0xD8, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xE8, 0x9D, 0x00, 0x8C,
-  0x80, 0x26, 0x0C, 0x00, 0x00, 0xE8, 0x09, 0x00, 0x40, 0xE7, 0x09, 0x00,
-  0x13, 0x00, 0x0E, 0x00, 0x03, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x00, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0xFF, 0x07, 0x04, 0x3D, 0xED, 0x8C,
-  0x39, 0x3F, 0x09, 0x00, 0x44, 0x3D, 0xED, 0x8C, 0x4C, 0x3D, 0xED, 0x8C,
-  0x50, 0x3D, 0xED, 0x8C, 0x54, 0x3D, 0xED, 0x8C, 0x58, 0x3D, 0xED, 0x8C,
-  0x38, 0x3D, 0xED, 0x8C, 0x40, 0x3D, 0xED, 0x8C, 0x28, 0x3D, 0xED, 0x8C,
-  0x2C, 0x3D, 0xED, 0x8C, 0x34, 0x3D, 0xED, 0x8C, 0x3C, 0x3D, 0xED, 0x8C,
-  0x30, 0x3D, 0xED, 0x8C, 0x2D, 0xD0, 0x02, 0x61, 0x4D, 0x90, 0x16, 0x03,
-  0x22, 0x63, 0x01, 0xE1, 0x74, 0xE0, 0x16, 0x03, 0x22, 0x63, 0x2A, 0xD1,
-  0x7C, 0xE0, 0x16, 0x03, 0x22, 0x63, 0x07, 0xE1, 0x42, 0x90, 0x16, 0x03,
-  0x22, 0x63, 0x27, 0xD1, 0x3F, 0x90, 0x16, 0x03, 0x26, 0xC7, 0x08, 0xF3,
-  0x3A, 0xFF, 0x22, 0x63, 0x25, 0xD1, 0x78, 0xE0, 0x16, 0x03, 0x22, 0x63,
-  0x00, 0xE1, 0x35, 0x90, 0x16, 0x03, 0x22, 0x63, 0xF3, 0x61, 0x12, 0x60,
-  0x31, 0x91, 0x3C, 0x31, 0x02, 0x21, 0x22, 0x63, 0x1F, 0xD1, 0x2D, 0x90,
-  0x16, 0x03, 0x22, 0x63, 0xFF, 0xE1, 0x2A, 0x90, 0x16, 0x03, 0x22, 0x63,
-  0x1C, 0xD1, 0x27, 0x90, 0x16, 0x03, 0x22, 0x63, 0x1B, 0xD0, 0x02, 0x61,
-  0x23, 0x90, 0x16, 0x03, 0x22, 0x63, 0x1A, 0xD0, 0x02, 0x61, 0x40, 0xE0,
-  0x16, 0x03, 0x22, 0x63, 0x18, 0xD0, 0x02, 0x61, 0x1A, 0x90, 0x16, 0x03,
-  0x04, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0xF8, 0x7F, 0x41, 0x1F, 0xF1, 0x50,
-  0x09, 0x88, 0x29, 0x8B, 0x13, 0xD3, 0x32, 0x62, 0x22, 0x2F, 0xF2, 0x60,
-  0x01, 0xC9, 0x02, 0x2F, 0x02, 0x23, 0x2B, 0xA0, 0x09, 0x00, 0xC8, 0x00,
-  0x80, 0x00, 0x18, 0x01, 0x84, 0x00, 0x88, 0x00, 0x8C, 0x00, 0xBC, 0x00,
-  0xC0, 0x00, 0xE4, 0x00, 0xF4, 0x00, 0xFF, 0xFF, 0x48, 0x3D, 0xED, 0x8C,
-  0x77, 0xDF, 0x27, 0x00, 0x40, 0x80, 0x00, 0x00, 0x17, 0xB7, 0xD1, 0x38,
-  0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF,
-  0x10, 0x3D, 0xED, 0x8C, 0x14, 0x3D, 0xED, 0x8C, 0x5C, 0x3D, 0xED, 0x8C,
-  0x00, 0x2C, 0x70, 0xA0, 0x1B, 0xD2, 0x22, 0x63, 0x32, 0x2F, 0xF2, 0x60,
-  0x01, 0xC9, 0x2E, 0x93, 0x3B, 0x20, 0x02, 0x2F, 0x17, 0xD2, 0x02, 0x22,
-  0x08, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0x08, 0x7F, 0x0B, 0x00, 0x09, 0x00,
-  0xF4, 0x7F, 0x42, 0x1F, 0x01, 0xE1, 0x13, 0xD3, 0x12, 0x23, 0x00, 0xE2,
-  0x12, 0xD0, 0x22, 0x20, 0x1C, 0x91, 0x12, 0xD2, 0x12, 0x22, 0x12, 0xD1,
-  0x10, 0x63, 0x3C, 0x63, 0x28, 0x43, 0x11, 0xD0, 0x32, 0x20, 0x0C, 0xD3,
-  0x32, 0x60, 0x0C, 0xCB, 0x02, 0x23, 0x0B, 0xD3, 0x32, 0x60, 0x06, 0xCB,
-  0x02, 0x23, 0x04, 0xE2, 0x21, 0x1F, 0xF2, 0x50, 0x0F, 0xC9, 0x01, 0x88,
-  0x14, 0x89, 0x02, 0x88, 0x42, 0x89, 0x04, 0x88, 0x2B, 0x89, 0x3F, 0xA0,
-  0x09, 0x00, 0x00, 0x03, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x2C, 0x70, 0xA0,
-  0x24, 0x3D, 0xED, 0x8C, 0x28, 0x3D, 0xED, 0x8C, 0x44, 0x3D, 0xED, 0x8C,
-  0x2C, 0x00, 0x00, 0xAC, 0x18, 0x3D, 0xED, 0x8C, 0x43, 0x93, 0xF2, 0x50,
-  0x39, 0x20, 0x10, 0xCB, 0x02, 0x1F, 0x20, 0xD2, 0x20, 0xD1, 0x22, 0x63,
-  0x1B, 0x23, 0x32, 0x22, 0x1F, 0xD2, 0x20, 0xD3, 0x22, 0x23, 0x20, 0xD0,
-  0x20, 0xD2, 0x02, 0x22, 0x20, 0xD1, 0x21, 0xD0, 0x12, 0x20, 0x21, 0xD3,
-  0x21, 0xD1, 0x32, 0x21, 0x21, 0xD2, 0x22, 0xD3, 0x22, 0x23, 0x53, 0xA0,
-  0x09, 0x00, 0x21, 0xD1, 0x17, 0xD0, 0x12, 0x20, 0x20, 0xD3, 0x18, 0xD2,
-  0x32, 0x22, 0x20, 0xD3, 0x32, 0x60, 0x90, 0xCB, 0x02, 0x23, 0x1F, 0xD1,
-  0x18, 0xD3, 0x12, 0x23, 0x1E, 0xD0, 0x15, 0xD1, 0x02, 0x21, 0x1E, 0xD2,
-  0x17, 0xD0, 0x22, 0x20, 0x3E, 0xA0, 0x09, 0x00, 0x0C, 0xD1, 0x0D, 0xD3,
-  0x12, 0x23, 0x0D, 0xD2, 0x0D, 0xD0, 0x22, 0x20, 0x15, 0xD2, 0x22, 0x60,
-  0x50, 0xCB, 0x02, 0x22, 0x0D, 0xD1, 0x0E, 0xD2, 0x12, 0x22, 0x16, 0xD0,
-  0x0A, 0xD1, 0x02, 0x21, 0x15, 0xD3, 0x0D, 0xD0, 0x32, 0x20, 0x29, 0xA0,
-  0x09, 0x00, 0x0F, 0xFF, 0x24, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0x80, 0x00,
-  0x00, 0x00, 0x45, 0x03, 0x48, 0x3D, 0xED, 0x8C, 0x45, 0x03, 0x7E, 0x00,
-  0x4C, 0x3D, 0xED, 0x8C, 0x08, 0x02, 0x28, 0x00, 0x50, 0x3D, 0xED, 0x8C,
-  0x59, 0x03, 0x0C, 0x02, 0x54, 0x3D, 0xED, 0x8C, 0x3F, 0x93, 0xF1, 0x03,
-  0x58, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0x4B, 0x03, 0x4B, 0x03, 0x8D, 0x00,
-  0x44, 0x3D, 0xED, 0x8C, 0x5F, 0x03, 0x70, 0x02, 0x6C, 0x02, 0x2C, 0x00,
-  0x3F, 0xA5, 0xD6, 0x07, 0x04, 0x02, 0x24, 0x00, 0x3F, 0xC6, 0xD6, 0x07,
-  0x52, 0x91, 0x2C, 0xD2, 0x12, 0x22, 0x50, 0x93, 0x2B, 0xD0, 0x32, 0x20,
-  0x4E, 0x93, 0xF2, 0x51, 0x38, 0x21, 0x69, 0x89, 0x29, 0xD2, 0x2A, 0xD1,
-  0x12, 0x22, 0x2A, 0xD0, 0xF1, 0x53, 0x33, 0x61, 0x08, 0x43, 0x1C, 0x33,
-  0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x00, 0x43, 0x24, 0xD1, 0x1C, 0x33,
-  0x32, 0x20, 0x25, 0xD2, 0x25, 0xD3, 0x32, 0x22, 0x25, 0xD1, 0xF1, 0x53,
-  0x33, 0x60, 0x09, 0x00, 0x08, 0x43, 0x0C, 0x33, 0x08, 0x43, 0x08, 0x43,
-  0x08, 0x43, 0x00, 0x43, 0x1F, 0xD0, 0x0C, 0x33, 0x32, 0x21, 0xF1, 0x52,
-  0x23, 0x63, 0x08, 0x42, 0x3C, 0x32, 0x08, 0x42, 0x08, 0x42, 0x00, 0x42,
-  0x01, 0x72, 0x28, 0x42, 0x08, 0x42, 0x08, 0x42, 0x1A, 0xD3, 0x39, 0x22,
-  0x12, 0xD1, 0x12, 0x60, 0x01, 0x40, 0xFF, 0x70, 0x18, 0x40, 0x08, 0x40,
-  0x17, 0xD3, 0x39, 0x20, 0x0B, 0x22, 0xF1, 0x50, 0x03, 0x63, 0x08, 0x40,
-  0x3C, 0x30, 0x08, 0x40, 0x08, 0x40, 0x00, 0x40, 0xFF, 0x70, 0x0E, 0x93,
-  0x39, 0x20, 0x0B, 0x22, 0x11, 0xD0, 0x22, 0x20, 0x0A, 0x93, 0x11, 0xD2,
-  0x32, 0x22, 0x00, 0xE1, 0x10, 0xD3, 0x12, 0x23, 0x48, 0xA0, 0x09, 0x00,
-  0x80, 0x02, 0xE0, 0x01, 0x00, 0x02, 0xFF, 0x03, 0x00, 0x04, 0xFF, 0xFF,
-  0x00, 0x3D, 0xED, 0x8C, 0x04, 0x3D, 0xED, 0x8C, 0x34, 0x3D, 0xED, 0x8C,
-  0x00, 0x00, 0x20, 0x00, 0x3C, 0x3D, 0xED, 0x8C, 0x38, 0x3D, 0xED, 0x8C,
-  0x00, 0x00, 0x60, 0x00, 0x40, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0xF0, 0x3F,
-  0x00, 0xFC, 0x0F, 0x00, 0x30, 0x3D, 0xED, 0x8C, 0x5C, 0x3D, 0xED, 0x8C,
-  0x8C, 0x3D, 0xED, 0x8C, 0x29, 0xD0, 0x02, 0x62, 0xFF, 0x72, 0x18, 0x42,
-  0x08, 0x42, 0x28, 0xD1, 0x19, 0x22, 0xF1, 0x53, 0x33, 0x61, 0x08, 0x43,
-  0x1C, 0x33, 0x08, 0x43, 0x08, 0x43, 0x00, 0x43, 0xFF, 0x73, 0x3E, 0x91,
-  0x19, 0x23, 0x3B, 0x22, 0x22, 0xD3, 0x3B, 0x22, 0x22, 0xD0, 0x22, 0x20,
-  0x38, 0x93, 0x22, 0xD2, 0x32, 0x22, 0x22, 0xD1, 0x22, 0xD3, 0x32, 0x21,
-  0x22, 0xD0, 0x21, 0xD3, 0x32, 0x20, 0x22, 0xD2, 0x22, 0xD3, 0x32, 0x22,
-  0x22, 0xD1, 0x21, 0xD3, 0x32, 0x21, 0x00, 0xE0, 0x21, 0xD3, 0x02, 0x23,
-  0x21, 0xD1, 0x12, 0x62, 0x21, 0xD3, 0x24, 0x90, 0x36, 0x02, 0x21, 0xD2,
-  0x22, 0x63, 0xF1, 0x52, 0x37, 0x02, 0x1A, 0x03, 0x09, 0x43, 0x01, 0x43,
-  0x1E, 0xD1, 0x32, 0x21, 0x0E, 0xD0, 0x02, 0x63, 0x1C, 0xD2, 0x22, 0x60,
-  0x37, 0x00, 0x1A, 0x03, 0x08, 0x43, 0x00, 0x43, 0x1A, 0xD0, 0x32, 0x20,
-  0x00, 0xE1, 0x1A, 0xD3, 0x12, 0x23, 0x1A, 0xD2, 0x1A, 0xD1, 0x22, 0x21,
-  0x0A, 0x90, 0x1A, 0xD2, 0x02, 0x22, 0x00, 0xE3, 0x19, 0xD0, 0x32, 0x20,
-  0x0C, 0x7F, 0x0B, 0x00, 0x09, 0x00, 0xFF, 0x03, 0x00, 0x04, 0xCC, 0x00,
-  0x80, 0x02, 0xFF, 0xFF, 0x04, 0x3D, 0xED, 0x8C, 0x00, 0xFC, 0x0F, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x30, 0x3D, 0xED, 0x8C, 0x5C, 0x3D, 0xED, 0x8C,
-  0x34, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0x20, 0x00, 0x3C, 0x3D, 0xED, 0x8C,
-  0x38, 0x3D, 0xED, 0x8C, 0x00, 0x00, 0x60, 0x00, 0x40, 0x3D, 0xED, 0x8C,
-  0x8C, 0x3D, 0xED, 0x8C, 0xE8, 0x9D, 0x00, 0x8C, 0x04, 0x01, 0x15, 0x00,
-  0x00, 0x3D, 0xED, 0x8C, 0x2C, 0x3D, 0xED, 0x8C, 0x08, 0x3D, 0xED, 0x8C,
-  0x78, 0x3D, 0xED, 0x8C, 0xC0, 0xC0, 0xC0, 0x00, 0x14, 0x3D, 0xED, 0x8C,
-  0x0C, 0x3D, 0xED, 0x8C, 0x10, 0x3D, 0xED, 0x8C, 0x22, 0x4F, 0xF4, 0x7F,
-  0x42, 0x1F, 0xF2, 0x54, 0x25, 0xBE, 0x09, 0x00, 0xF2, 0x50, 0x06, 0x88,
-  0x1B, 0x89, 0x08, 0x88, 0x03, 0x89, 0x09, 0x88, 0x0C, 0x89, 0x16, 0xA0,
-  0x09, 0x00, 0x23, 0x93, 0x31, 0x1F, 0x13, 0xD3, 0xF1, 0x52, 0x3B, 0x22,
-  0x21, 0x1F, 0x23, 0x64, 0x52, 0xBE, 0x09, 0x00, 0x16, 0xA0, 0x09, 0x00,
-  0x19, 0x91, 0x11, 0x1F, 0x0D, 0xD3, 0xF1, 0x52, 0x3B, 0x22, 0x21, 0x1F,
-  0x23, 0x64, 0x47, 0xBE, 0x09, 0x00, 0x0B, 0xA0, 0x09, 0x00, 0x0F, 0x91,
-  0x11, 0x1F, 0x08, 0xD3, 0xF1, 0x52, 0x3B, 0x22, 0x21, 0x1F, 0x23, 0x64,
-  0x3C, 0xBE, 0x09, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x0C, 0x7F, 0x26, 0x4F,
-  0x0B, 0x00, 0x09, 0x00, 0x14, 0x02, 0x11, 0x01, 0x12, 0x02, 0xFF, 0xFF,
-  0x00, 0x80, 0x00, 0x00, 0x0C, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0x22, 0x4F, 0xFC, 0x7F, 0x42, 0x2F, 0xF2, 0x64, 0x5E, 0xBC, 0x09, 0x00,
-  0xF2, 0x64, 0xB9, 0xBF, 0x09, 0x00, 0xE7, 0xBC, 0x09, 0x00, 0x04, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0x04, 0x7F, 0x26, 0x4F, 0x0B, 0x00,
-  0x09, 0x00, 0xFF, 0xFF, 0x22, 0x4F, 0xF8, 0x7F, 0x17, 0xD3, 0x0B, 0x43,
-  0x09, 0x00, 0xF3, 0x81, 0x16, 0xD3, 0x30, 0x60, 0xF5, 0x80, 0xF3, 0x85,
-  0x08, 0x20, 0x03, 0x8B, 0x04, 0xE1, 0x12, 0x2F, 0x1C, 0xA0, 0x09, 0x00,
-  0xF5, 0x84, 0x0C, 0x60, 0x30, 0x88, 0x13, 0x89, 0x31, 0x88, 0x05, 0x89,
-  0x32, 0x88, 0x07, 0x89, 0x33, 0x88, 0x09, 0x89, 0x0C, 0xA0, 0x09, 0x00,
-  0x01, 0xE2, 0x22, 0x2F, 0x0C, 0xA0, 0x09, 0x00, 0x02, 0xE2, 0x22, 0x2F,
-  0x08, 0xA0, 0x09, 0x00, 0x03, 0xE2, 0x22, 0x2F, 0x04, 0xA0, 0x09, 0x00,
-  0x00, 0xE3, 0x32, 0x2F, 0x00, 0xA0, 0x09, 0x00, 0xF2, 0x60, 0x08, 0x7F,
-  0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00, 0xFF, 0xFF, 0x80, 0x83, 0x00, 0x8C,
-  0x74, 0x00, 0x00, 0xAC, 0x08, 0x7F, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0x08, 0x20, 0x26, 0x2F, 0x4C, 0x8D, 0x09, 0x00, 0x36, 0x2F, 0x00, 0xE2,
-  0x27, 0x21, 0x3A, 0x33, 0x2A, 0x31, 0x07, 0x23, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x2E, 0x31, 0x13, 0x60, 0xF6, 0x63,
-  0x0B, 0x00, 0xF6, 0x62, 0x02, 0xD1, 0x03, 0xD2, 0x00, 0xE0, 0x22, 0x21,
-  0x0B, 0x00, 0xF6, 0x62, 0x9C, 0x3D, 0xED, 0x8C, 0x4E, 0x04, 0x00, 0x00,
-  0x08, 0x20, 0x26, 0x2F, 0x46, 0x8D, 0x09, 0x00, 0x00, 0xE2, 0x19, 0x00,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32,
-  0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x04, 0x32, 0x24, 0x41, 0x13, 0x60,
-  0x0B, 0x00, 0xF6, 0x62, 0x02, 0xD2, 0x03, 0xD1, 0x00, 0xE0, 0x12, 0x22,
-  0x0B, 0x00, 0xF6, 0x62, 0x9C, 0x3D, 0xED, 0x8C, 0x4E, 0x04, 0x00, 0x00,
-  0x08, 0x20, 0x26, 0x2F, 0x56, 0x8D, 0x09, 0x00, 0x36, 0x2F, 0x00, 0xE2,
-  0x46, 0x2F, 0x27, 0x21, 0x29, 0x04, 0x3A, 0x33, 0x2A, 0x31, 0x07, 0x23,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33,
-  0x24, 0x41, 0x04, 0x33, 0x24, 0x41, 0x04, 0x33, 0x27, 0x23, 0x29, 0x02,
-  0x4A, 0x22, 0x25, 0x42, 0x02, 0x8B, 0x07, 0x23, 0x21, 0x43, 0x04, 0x33,
-  0x4C, 0x33, 0x33, 0x60, 0xF6, 0x64, 0xF6, 0x63, 0x0B, 0x00, 0xF6, 0x62,
-  0x02, 0xD1, 0x03, 0xD2, 0x00, 0xE0, 0x22, 0x21, 0x0B, 0x00, 0xF6, 0x62,
-  0x9C, 0x3D, 0xED, 0x8C, 0x4E, 0x04, 0x00, 0x00, 0x08, 0x20, 0x4E, 0x8D,
-  0x09, 0x00, 0x36, 0x2F, 0x00, 0xE3, 0x46, 0x2F, 0x03, 0x64, 0x19, 0x00,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33,
-  0x24, 0x41, 0x44, 0x33, 0x24, 0x41, 0x44, 0x33, 0x03, 0x8B, 0x33, 0x60,
-  0xF6, 0x64, 0x0B, 0x00, 0xF6, 0x63, 0x3C, 0x30, 0xF6, 0x64, 0x0B, 0x00,
-  0xF6, 0x63, 0x26, 0x2F, 0x02, 0xD1, 0x03, 0xD2, 0x00, 0xE0, 0x22, 0x21,
-  0x0B, 0x00, 0xF6, 0x62, 0x9C, 0x3D, 0xED, 0x8C, 0x4E, 0x04, 0x00, 0x00,
-  0x36, 0x2F, 0x05, 0xD3, 0x3E, 0x03, 0xFC, 0x70, 0x2B, 0x43, 0x2E, 0x00,
-  0x36, 0x2F, 0x02, 0xD3, 0x3E, 0x03, 0xFC, 0x70, 0x2B, 0x43, 0x2E, 0x03,
-  0x08, 0x9C, 0x00, 0x8C, 0x09, 0x00, 0x2E, 0x53, 0x0F, 0x11, 0x2D, 0x50,
-  0x3E, 0x11, 0x2C, 0x53, 0x0D, 0x11, 0x2B, 0x50, 0x3C, 0x11, 0x2A, 0x53,
-  0x0B, 0x11, 0x29, 0x50, 0x3A, 0x11, 0x28, 0x53, 0x09, 0x11, 0x27, 0x50,
-  0x38, 0x11, 0x26, 0x53, 0x07, 0x11, 0x25, 0x50, 0x36, 0x11, 0x24, 0x53,
-  0x05, 0x11, 0x23, 0x50, 0x34, 0x11, 0x22, 0x53, 0x03, 0x11, 0x21, 0x50,
-  0x32, 0x11, 0x22, 0x63, 0x01, 0x11, 0x32, 0x21, 0x0B, 0x00, 0xF6, 0x63,
-  0x04, 0x9C, 0x00, 0x8C, 0x02, 0x9C, 0x00, 0x8C, 0xFE, 0x9B, 0x00, 0x8C,
-  0xFA, 0x9B, 0x00, 0x8C, 0xF6, 0x9B, 0x00, 0x8C, 0xF2, 0x9B, 0x00, 0x8C,
-  0xEE, 0x9B, 0x00, 0x8C, 0xEA, 0x9B, 0x00, 0x8C, 0xE6, 0x9B, 0x00, 0x8C,
-  0xE2, 0x9B, 0x00, 0x8C, 0xDE, 0x9B, 0x00, 0x8C, 0xDA, 0x9B, 0x00, 0x8C,
-  0xD6, 0x9B, 0x00, 0x8C, 0xD2, 0x9B, 0x00, 0x8C, 0xCE, 0x9B, 0x00, 0x8C,
-  0xCA, 0x9B, 0x00, 0x8C, 0xC6, 0x9B, 0x00, 0x8C, 0x22, 0x4F, 0x53, 0x61,
-  0x02, 0xD3, 0x0B, 0x43, 0x43, 0x60, 0x26, 0x4F, 0x0B, 0x00, 0x09, 0x00,
-  0x74, 0x9C, 0x00, 0x8C, 0x01, 0xA0, 0x00, 0xE5, 0x01, 0x75, 0x44, 0x63,
-  0x38, 0x23, 0xFB, 0x8F, 0x09, 0x00, 0x0B, 0x00, 0x53, 0x60, 0xFF, 0xFF,
-  0x36, 0x2F, 0x46, 0x2F, 0x03, 0xE3, 0x03, 0x64, 0x39, 0x24, 0x19, 0x23,
-  0x4B, 0x23, 0x38, 0x23, 0x18, 0x89, 0x03, 0x64, 0x14, 0x60, 0x43, 0x63,
-  0x00, 0x88, 0x00, 0x23, 0x0E, 0x89, 0x14, 0x60, 0x00, 0x88, 0x31, 0x80,
-  0x0A, 0x89, 0x14, 0x60, 0x00, 0x88, 0x32, 0x80, 0x06, 0x89, 0x14, 0x60,
-  0x00, 0x88, 0x33, 0x80, 0x02, 0x89, 0x14, 0x60, 0xEE, 0xAF, 0x04, 0x73,
-  0x43, 0x60, 0xF6, 0x64, 0x0B, 0x00, 0xF6, 0x63, 0x01, 0xD3, 0x2B, 0x43,
-  0x09, 0x00, 0x09, 0x00, 0xC8, 0x9C, 0x00, 0x8C, 0x36, 0x2F, 0x46, 0x2F,
-  0x56, 0x2F, 0x66, 0x2F, 0x03, 0x63, 0x16, 0x64, 0x00, 0xE6, 0x4C, 0x26,
-  0x14, 0x89, 0x16, 0x65, 0x42, 0x20, 0x5C, 0x26, 0x0B, 0x89, 0x16, 0x64,
-  0x51, 0x10, 0x4C, 0x26, 0x09, 0x89, 0x16, 0x65, 0x42, 0x10, 0x5C, 0x26,
-  0x07, 0x89, 0x16, 0x64, 0x53, 0x10, 0xEE, 0xAF, 0x10, 0x70, 0x03, 0xA0,
-  0x04, 0x70, 0x01, 0xA0, 0x08, 0x70, 0x0C, 0x70, 0xFC, 0x71, 0x03, 0x66,
-  0x14, 0x60, 0x00, 0x88, 0x00, 0x26, 0x09, 0x89, 0x14, 0x60, 0x00, 0x88,
-  0x61, 0x80, 0x05, 0x89, 0x14, 0x60, 0x00, 0x88, 0x62, 0x80, 0x01, 0x89,
-  0x14, 0x60, 0x63, 0x80, 0xF6, 0x66, 0x33, 0x60, 0xF6, 0x65, 0xF6, 0x64,
-  0x0B, 0x00, 0xF6, 0x63, 0x98, 0x9D, 0x00, 0x8C, 0x00, 0x3D, 0xED, 0x8C,
-  0x00, 0x3D, 0xED, 0x8C, 0x00, 0x3D, 0xED, 0x8C, 0xA0, 0x3D, 0xED, 0x8C,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x45, 0x47, 0x41,
-  0x4B, 0x41, 0x54, 0x41, 0x4E, 0x41, 0x00, 0xFF, 0x67, 0x45, 0x23, 0x01,
-  0xEF, 0xCD, 0xAB, 0x89, 0x50, 0x52, 0x4F, 0x44, 0x55, 0x43, 0x45, 0x44,
-  0x20, 0x42, 0x59, 0x20, 0x4F, 0x52, 0x00, 0xFF, 0x55, 0x4E, 0x44, 0x45,
-  0x52, 0x20, 0x4C, 0x49, 0x43, 0x45, 0x4E, 0x53, 0x45, 0x20, 0x46, 0x52,
-  0x4F, 0x4D, 0x00, 0xFF, 0x53, 0x45, 0x47, 0x41, 0x20, 0x45, 0x4E, 0x54,
-  0x45, 0x52, 0x50, 0x52, 0x49, 0x53, 0x45, 0x53, 0x2C, 0x20, 0x4C, 0x54,
-  0x44, 0x2E, 0x00, 0xFF, 0x5C, 0x9D, 0x00, 0x8C, 0x6C, 0x9D, 0x00, 0x8C,
-  0x80, 0x9D, 0x00, 0x8C, 0x41, 0x11, 0x2B, 0x42, 0x0D, 0x21, 0x43, 0x0E,
-  0x23, 0x2C, 0x02, 0x05, 0x44, 0x0D, 0x21, 0x2E, 0x02, 0x05, 0x45, 0x0C,
-  0x1E, 0x46, 0x0C, 0x1E, 0x47, 0x0E, 0x23, 0x49, 0x03, 0x08, 0x4C, 0x0B,
-  0x1C, 0x1F, 0x16, 0x37, 0x4D, 0x12, 0x2D, 0x4E, 0x0E, 0x23, 0x4F, 0x0F,
-  0x26, 0x50, 0x0C, 0x1E, 0x52, 0x0D, 0x21, 0x53, 0x0D, 0x21, 0x54, 0x0D,
-  0x21, 0x55, 0x0D, 0x21, 0x59, 0x0F, 0x26, 0xFF, 0x00, 0x60, 0x5F, 0xA0,
-  0x00, 0x80, 0x5F, 0xA0, 0x49, 0xD2, 0x00, 0xE3, 0x30, 0x22, 0x49, 0xD4,
-  0x40, 0x60, 0xFE, 0xC9, 0x00, 0x24, 0x02, 0xE3, 0x47, 0xD1, 0x31, 0x21,
-  0x47, 0xD3, 0xFF, 0xE5, 0x52, 0x23, 0x0C, 0x72, 0x52, 0x22, 0x40, 0x60,
-  0x01, 0xCB, 0x0B, 0x00, 0x00, 0x24, 0xFF, 0xE0, 0x43, 0xD2, 0x22, 0x63,
-  0x0B, 0x00, 0x38, 0x30, 0x53, 0x60, 0x09, 0x00, 0x0B, 0x00, 0x48, 0x30,
-  0x22, 0x4F, 0x64, 0xE5, 0x3F, 0xD3, 0x43, 0x61, 0x0B, 0x43, 0x53, 0x60,
-  0x3E, 0xD3, 0x03, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x41,
-  0x0B, 0x43, 0x53, 0x60, 0x3A, 0xD2, 0x03, 0x63, 0x43, 0x61, 0x0B, 0x42,
-  0x53, 0x60, 0x08, 0x40, 0x26, 0x4F, 0x08, 0x40, 0x08, 0x40, 0x00, 0x40,
-  0x0B, 0x00, 0x3C, 0x30, 0x64, 0xE5, 0x7F, 0xE0, 0x49, 0x20, 0xF9, 0xE3,
-  0x57, 0x00, 0x43, 0x62, 0x1A, 0x00, 0x3D, 0x40, 0x3D, 0x42, 0x57, 0x02,
-  0x1A, 0x02, 0x0B, 0x00, 0x2C, 0x30, 0x00, 0xA0, 0x02, 0xE7, 0xE6, 0x2F,
-  0xD6, 0x2F, 0x27, 0xDD, 0xD0, 0x60, 0x02, 0xC8, 0x01, 0x89, 0x34, 0xA0,
-  0xFF, 0xE0, 0x00, 0xE2, 0x22, 0xD3, 0x20, 0x23, 0xD0, 0x60, 0xFD, 0xC9,
-  0x00, 0x2D, 0x27, 0xDE, 0x71, 0x2E, 0x58, 0x25, 0x36, 0x97, 0x14, 0x89,
-  0x25, 0xD2, 0x22, 0x01, 0x33, 0x90, 0x26, 0x01, 0x24, 0xD3, 0x52, 0x23,
-  0x24, 0xD2, 0x62, 0x22, 0xE1, 0x60, 0x20, 0xCB, 0x01, 0x2E, 0x23, 0xD6,
-  0x2A, 0x91, 0x61, 0x60, 0x19, 0x20, 0x28, 0x93, 0x3B, 0x20, 0x01, 0x26,
-  0xE1, 0x62, 0x79, 0x22, 0x21, 0x2E, 0x1F, 0xD3, 0x42, 0x23, 0x1F, 0xD2,
-  0x42, 0x22, 0xD0, 0x60, 0x02, 0xCB, 0x58, 0x25, 0x0A, 0x8F, 0x00, 0x2D,
-  0x1A, 0x94, 0xE1, 0x63, 0x48, 0x23, 0xFC, 0x89, 0xD0, 0x60, 0xFD, 0xC9,
-  0x00, 0x2D, 0xE1, 0x63, 0x79, 0x23, 0x31, 0x2E, 0x00, 0xE0, 0xF6, 0x6D,
-  0x0B, 0x00, 0xF6, 0x6E, 0x08, 0xD3, 0x30, 0x60, 0xFD, 0xC9, 0x00, 0x23,
-  0x18, 0x73, 0xDF, 0xE2, 0x31, 0x61, 0x29, 0x21, 0x0B, 0x00, 0x11, 0x23,
-  0xFF, 0xFE, 0x44, 0x02, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xFF, 0xFF,
-  0x00, 0x00, 0xD8, 0xFF, 0x04, 0x00, 0xD8, 0xFF, 0x10, 0x00, 0xD8, 0xFF,
-  0x08, 0x00, 0xD8, 0xFF, 0x0C, 0x00, 0xD8, 0xFF, 0xF0, 0x9A, 0x00, 0x8C,
-  0x80, 0x99, 0x00, 0x8C, 0x1C, 0x00, 0xD8, 0xFF, 0x4C, 0x9F, 0x00, 0x8C,
-  0xA0, 0x3D, 0xED, 0x8C, 0xA4, 0x3D, 0xED, 0x8C, 0x04, 0x00, 0xD0, 0xFF,
-  0x14, 0x00, 0xD8, 0xFF, 0x18, 0x00, 0xD8, 0xFF, 0x3B, 0xD3, 0x30, 0x60,
-  0xFD, 0xC9, 0x00, 0x23, 0x3A, 0xD4, 0xDF, 0xE3, 0x41, 0x62, 0x39, 0x22,
-  0x21, 0x24, 0x68, 0x92, 0x41, 0x61, 0x29, 0x21, 0x11, 0x24, 0x37, 0xD1,
-  0x37, 0xD3, 0x12, 0x60, 0x2B, 0x40, 0x32, 0x64, 0x32, 0xD3, 0x30, 0x60,
-  0xFB, 0xC9, 0x00, 0x23, 0x34, 0xD4, 0xDF, 0xE3, 0x41, 0x62, 0x39, 0x22,
-  0x21, 0x24, 0x56, 0x92, 0x41, 0x61, 0x29, 0x21, 0x11, 0x24, 0x31, 0xD1,
-  0x31, 0xD3, 0x12, 0x60, 0x2B, 0x40, 0x32, 0x64, 0x30, 0xD1, 0x00, 0xE2,
-  0x20, 0x21, 0x28, 0xD3, 0x30, 0x60, 0x04, 0xCB, 0x0B, 0x00, 0x00, 0x23,
-  0x25, 0xD3, 0x30, 0x60, 0xFB, 0xC9, 0x0B, 0x00, 0x00, 0x23, 0xFC, 0x7F,
-  0x22, 0xD7, 0x70, 0x63, 0x30, 0x2F, 0x70, 0x60, 0xFB, 0xC9, 0x48, 0x24,
-  0x23, 0xD6, 0x15, 0x8D, 0x00, 0x27, 0x22, 0x02, 0x25, 0xD3, 0x35, 0x90,
-  0x36, 0x02, 0x21, 0xD2, 0x21, 0xD3, 0x42, 0x22, 0x52, 0x23, 0x61, 0x60,
-  0x20, 0xCB, 0x01, 0x26, 0x21, 0xD5, 0x2C, 0x91, 0x51, 0x60, 0x19, 0x20,
-  0xF0, 0xCB, 0x01, 0x25, 0x25, 0x92, 0x61, 0x60, 0x29, 0x20, 0x01, 0x26,
-  0xF0, 0x63, 0x48, 0x24, 0x11, 0x8F, 0x30, 0x27, 0x18, 0xD2, 0x00, 0xE1,
-  0x10, 0x22, 0x70, 0x60, 0x04, 0xCB, 0x00, 0x27, 0x1A, 0x94, 0x61, 0x62,
-  0x48, 0x22, 0xFC, 0x89, 0x70, 0x60, 0xFB, 0xC9, 0x00, 0x27, 0x10, 0x93,
-  0x61, 0x62, 0x39, 0x22, 0x21, 0x26, 0x0B, 0x00, 0x04, 0x7F, 0x08, 0xD4,
-  0x40, 0x65, 0x40, 0x60, 0xFB, 0xC9, 0x00, 0x24, 0x09, 0xD3, 0xDF, 0xE2,
-  0x31, 0x61, 0x29, 0x21, 0x11, 0x23, 0x0B, 0x00, 0x50, 0x24, 0xFF, 0xFE,
-  0x48, 0x02, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x04, 0x00, 0xD8, 0xFF,
-  0x1C, 0x00, 0xD8, 0xFF, 0xA0, 0x3D, 0xED, 0x8C, 0xA4, 0x3D, 0xED, 0x8C,
-  0x28, 0x00, 0xD8, 0xFF, 0xA8, 0x3D, 0xED, 0x8C, 0xAC, 0x3D, 0xED, 0x8C,
-  0x00, 0x00, 0xD8, 0xFF, 0x70, 0x9F, 0x00, 0x8C, 0x04, 0x00, 0xD0, 0xFF,
-  0x4D, 0x65, 0x58, 0x25, 0x10, 0x89, 0x53, 0x60, 0x09, 0x00, 0x01, 0x88,
-  0x0C, 0x89, 0x53, 0x60, 0x09, 0x00, 0x02, 0x88, 0x08, 0x89, 0x53, 0x60,
-  0x09, 0x00, 0x03, 0x88, 0x04, 0x89, 0x53, 0x60, 0x09, 0x00, 0x04, 0x88,
-  0x00, 0x89, 0x02, 0xE4, 0x2F, 0xD5, 0x50, 0x66, 0x50, 0x60, 0xFB, 0xC9,
-  0x00, 0x25, 0xF8, 0xE3, 0x2D, 0xD7, 0x71, 0x62, 0x39, 0x22, 0x4B, 0x22,
-  0x21, 0x27, 0x0B, 0x00, 0x60, 0x25, 0x29, 0xD5, 0x50, 0x66, 0x50, 0x60,
-  0xFB, 0xC9, 0x00, 0x25, 0x28, 0xD2, 0xFF, 0xE3, 0x32, 0x22, 0x4B, 0x64,
-  0x27, 0xD3, 0x42, 0x23, 0x0B, 0x00, 0x60, 0x25, 0x25, 0xD2, 0xFF, 0xE0,
-  0x22, 0x63, 0x0B, 0x00, 0x38, 0x30, 0x5D, 0x60, 0x22, 0x4F, 0x00, 0x88,
-  0x07, 0x89, 0x01, 0x88, 0x07, 0x89, 0x03, 0x88, 0x07, 0x89, 0x04, 0x88,
-  0x08, 0x89, 0x0A, 0xA0, 0x09, 0x00, 0x09, 0xA0, 0x08, 0xE5, 0x07, 0xA0,
-  0x20, 0xE5, 0x2C, 0x95, 0x04, 0xA0, 0x09, 0x00, 0x2A, 0x95, 0x01, 0xA0,
-  0x09, 0x00, 0x28, 0x95, 0x18, 0xD2, 0x64, 0xE6, 0x43, 0x61, 0x0B, 0x42,
-  0x63, 0x60, 0x57, 0x00, 0x16, 0xD3, 0x1A, 0x01, 0x0B, 0x43, 0x63, 0x60,
-  0x14, 0xD2, 0x03, 0x63, 0x43, 0x61, 0x0B, 0x42, 0x63, 0x60, 0x57, 0x00,
-  0x26, 0x4F, 0x1A, 0x00, 0x0B, 0x00, 0x3C, 0x30, 0x22, 0x4F, 0x5D, 0x60,
-  0x00, 0x88, 0x07, 0x89, 0x01, 0x88, 0x07, 0x89, 0x03, 0x88, 0x07, 0x89,
-  0x04, 0x88, 0x17, 0x89, 0x19, 0xA0, 0x09, 0x00, 0x18, 0xA0, 0x08, 0xE5,
-  0x16, 0xA0, 0x20, 0xE5, 0x01, 0x95, 0x13, 0xA0, 0x09, 0x00, 0x00, 0x02,
-  0x00, 0x08, 0x80, 0x00, 0x04, 0x00, 0xD8, 0xFF, 0x28, 0x00, 0xD8, 0xFF,
-  0x20, 0x00, 0xD8, 0xFF, 0x24, 0x00, 0xD8, 0xFF, 0xF0, 0x9A, 0x00, 0x8C,
-  0x80, 0x99, 0x00, 0x8C, 0x18, 0x95, 0x01, 0xA0, 0x09, 0x00, 0x16, 0x95,
-  0x0B, 0xD2, 0x64, 0xE6, 0x43, 0x61, 0x0B, 0x42, 0x53, 0x60, 0x67, 0x00,
-  0x09, 0xD3, 0x1A, 0x01, 0x0B, 0x43, 0x53, 0x60, 0x07, 0xD2, 0x03, 0x63,
-  0x43, 0x61, 0x0B, 0x42, 0x53, 0x60, 0x67, 0x00, 0x26, 0x4F, 0x1A, 0x00,
-  0x0B, 0x00, 0x3C, 0x30, 0x42, 0xAE, 0x09, 0x00, 0x00, 0x08, 0x80, 0x00,
-  0xF0, 0x9A, 0x00, 0x8C, 0x80, 0x99, 0x00, 0x8C, 0x73, 0x79, 0x54, 0x6D,
-  0x72, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x30,
-  0x2E, 0x35, 0x31, 0x00, 0x73, 0x79, 0x54, 0x6D, 0x72, 0x20, 0x42, 0x75,
-  0x69, 0x6C, 0x64, 0x3A, 0x4A, 0x75, 0x6E, 0x20, 0x32, 0x33, 0x20, 0x31,
-  0x39, 0x39, 0x38, 0x31, 0x34, 0x3A, 0x35, 0x32, 0x3A, 0x35, 0x37, 0x00,
-  0xA4, 0xA1, 0x00, 0x8C, 0xB8, 0xA1, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4D, 0x52, 0x2B, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0C, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xC0, 0xC0,
-  0xC0, 0x00, 0x18, 0x18, 0x18, 0x00, 0x29, 0x29, 0x29, 0x00, 0x52, 0x52,
-  0x52, 0x00, 0x63, 0x63, 0x63, 0x00, 0x73, 0x73, 0x73, 0x00, 0x84, 0x84,
-  0x84, 0x00, 0x8C, 0x8C, 0x8C, 0x00, 0x9C, 0x9C, 0x9C, 0x00, 0xAD, 0xAD,
-  0xAD, 0x00, 0xBD, 0xBD, 0xBD, 0x00, 0xCE, 0xCE, 0xCE, 0x00, 0xD6, 0xD6,
-  0xD6, 0x00, 0xE7, 0xE7, 0xE7, 0x00, 0xF7, 0xF7, 0xF7, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x89, 0x03, 0x00, 0x06, 0x83, 0x03, 0x84, 0x00, 0x83, 0x03,
-  0x00, 0x89, 0x0F, 0x00, 0x03, 0x83, 0x0F, 0x0A, 0x82, 0x00, 0x07, 0x83,
-  0x0F, 0x00, 0x83, 0x07, 0x03, 0x82, 0x0F, 0x83, 0x07, 0x00, 0x03, 0x83,
-  0x0F, 0x07, 0x82, 0x00, 0x03, 0x83, 0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F,
-  0x84, 0x00, 0x03, 0x0F, 0x01, 0x0F, 0x03, 0x82, 0x00, 0x0F, 0x01, 0x82,
-  0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F, 0x84, 0x00, 0x03, 0x0F, 0x03, 0x82,
-  0x0F, 0x00, 0x08, 0x0F, 0x04, 0x82, 0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F,
-  0x84, 0x00, 0x03, 0x0F, 0x82, 0x03, 0x0F, 0x09, 0x08, 0x0F, 0x07, 0x82,
-  0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F, 0x84, 0x00, 0x03, 0x0F, 0x03, 0x06,
-  0x0F, 0x08, 0x04, 0x0F, 0x00, 0x82, 0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F,
-  0x84, 0x00, 0x03, 0x0F, 0x03, 0x08, 0x0F, 0x82, 0x02, 0x0F, 0x00, 0x82,
-  0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F, 0x84, 0x00, 0x03, 0x0F, 0x03, 0x00,
-  0x0F, 0x02, 0x0F, 0x03, 0x00, 0x82, 0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F,
-  0x84, 0x00, 0x03, 0x0F, 0x03, 0x00, 0x02, 0x82, 0x0F, 0x06, 0x00, 0x82,
-  0x0F, 0x84, 0x00, 0x07, 0x82, 0x0F, 0x84, 0x00, 0x03, 0x0F, 0x03, 0x00,
-  0x04, 0x82, 0x0F, 0x0A, 0x00, 0x82, 0x0F, 0x84, 0x00, 0x08, 0x82, 0x07,
-  0x84, 0x00, 0x09, 0x07, 0x09, 0x00, 0x09, 0x82, 0x07, 0x82, 0x00, 0x82,
-  0x07, 0x00, 0x7D, 0x4D, 0x52, 0xD7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0x59, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xC0, 0xC0, 0xC0, 0x00, 0xBD, 0x8C, 0x31, 0x00, 0xBD, 0x84, 0x18,
-  0x00, 0xBD, 0x7B, 0x00, 0x00, 0xBD, 0x9C, 0x63, 0x00, 0xBD, 0xAD, 0x94,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xF1, 0x01, 0x06, 0x05, 0x82, 0x02,
-  0x03, 0x82, 0x04, 0x03, 0x82, 0x02, 0x05, 0x06, 0xBD, 0x01, 0x82, 0x06,
-  0xAA, 0x05, 0x99, 0x01, 0x06, 0xAC, 0x05, 0x06, 0x97, 0x01, 0x82, 0x06,
-  0xAB, 0x05, 0xA0, 0x01, 0x06, 0x02, 0x8D, 0x04, 0x03, 0x05, 0xB7, 0x01,
-  0x06, 0x05, 0x02, 0xAC, 0x04, 0x02, 0x95, 0x01, 0x06, 0x05, 0x03, 0xAE,
-  0x04, 0x05, 0x94, 0x01, 0x05, 0x02, 0xAE, 0x04, 0x9E, 0x01, 0x06, 0x02,
-  0x92, 0x04, 0x05, 0xB3, 0x01, 0x05, 0x03, 0xAF, 0x04, 0x02, 0x93, 0x01,
-  0x05, 0x03, 0xB1, 0x04, 0x05, 0x91, 0x01, 0x06, 0x02, 0xB1, 0x04, 0x9D,
-  0x01, 0x05, 0x96, 0x04, 0x06, 0xAE, 0x01, 0x06, 0x02, 0xB2, 0x04, 0x02,
-  0x91, 0x01, 0x05, 0xB4, 0x04, 0x05, 0x8F, 0x01, 0x06, 0x02, 0xB3, 0x04,
-  0x9C, 0x01, 0x02, 0x98, 0x04, 0x05, 0xAC, 0x01, 0x05, 0xB4, 0x04, 0x02,
-  0x8F, 0x01, 0x06, 0x03, 0xB5, 0x04, 0x05, 0x8E, 0x01, 0x05, 0xB5, 0x04,
-  0x9B, 0x01, 0x03, 0x9A, 0x04, 0x02, 0xA9, 0x01, 0x06, 0x03, 0xB5, 0x04,
-  0x02, 0x8E, 0x01, 0x05, 0xB7, 0x04, 0x05, 0x8D, 0x01, 0x02, 0xB6, 0x04,
-  0x9A, 0x01, 0x03, 0x9C, 0x04, 0x02, 0xA7, 0x01, 0x05, 0xB7, 0x04, 0x02,
-  0x8D, 0x01, 0x02, 0xB8, 0x04, 0x05, 0x8B, 0x01, 0x06, 0x03, 0xB7, 0x04,
-  0x99, 0x01, 0x02, 0x9E, 0x04, 0x05, 0xA5, 0x01, 0x02, 0xB8, 0x04, 0x02,
-  0x8C, 0x01, 0x02, 0xB9, 0x04, 0x05, 0x8A, 0x01, 0x06, 0xB9, 0x04, 0x98,
-  0x01, 0x05, 0xA0, 0x04, 0x06, 0xA3, 0x01, 0x02, 0xB9, 0x04, 0x02, 0x8B,
-  0x01, 0x02, 0xBA, 0x04, 0x05, 0x89, 0x01, 0x06, 0xBA, 0x04, 0x97, 0x01,
-  0x06, 0xA1, 0x04, 0x03, 0xA2, 0x01, 0x02, 0xBA, 0x04, 0x02, 0x8A, 0x01,
-  0x05, 0xBB, 0x04, 0x05, 0x89, 0x01, 0x03, 0xBA, 0x04, 0x97, 0x01, 0x02,
-  0xA2, 0x04, 0x05, 0xA0, 0x01, 0x02, 0xBB, 0x04, 0x02, 0x89, 0x01, 0x06,
-  0xBC, 0x04, 0x05, 0x88, 0x01, 0x02, 0xBB, 0x04, 0x97, 0x01, 0x8F, 0x04,
-  0x05, 0x06, 0x82, 0x01, 0x06, 0x02, 0x8E, 0x04, 0x02, 0x9F, 0x01, 0x05,
-  0xBC, 0x04, 0x02, 0x89, 0x01, 0x03, 0xBC, 0x04, 0x05, 0x87, 0x01, 0x06,
-  0xBC, 0x04, 0x96, 0x01, 0x05, 0x8D, 0x04, 0x02, 0x87, 0x01, 0x06, 0x8E,
-  0x04, 0x06, 0x9D, 0x01, 0x06, 0x97, 0x04, 0xA6, 0x02, 0x05, 0x88, 0x01,
-  0x05, 0x93, 0x04, 0x03, 0xA9, 0x02, 0x05, 0x87, 0x01, 0x94, 0x04, 0x03,
-  0xA8, 0x02, 0x96, 0x01, 0x02, 0x8C, 0x04, 0x03, 0x83, 0x01, 0x06, 0x82,
-  0x05, 0x06, 0x82, 0x01, 0x06, 0x8D, 0x04, 0x05, 0x9D, 0x01, 0x03, 0x92,
-  0x04, 0x02, 0x82, 0x06, 0xB0, 0x01, 0x06, 0x90, 0x04, 0x03, 0x05, 0x06,
-  0xB2, 0x01, 0x05, 0x90, 0x04, 0x03, 0x05, 0x06, 0xC0, 0x01, 0x8D, 0x04,
-  0x06, 0x82, 0x01, 0x02, 0x84, 0x04, 0x05, 0x82, 0x01, 0x05, 0x8C, 0x04,
-  0x03, 0x9C, 0x01, 0x05, 0x90, 0x04, 0x03, 0x05, 0xB4, 0x01, 0x02, 0x8F,
-  0x04, 0x05, 0xB5, 0x01, 0x8F, 0x04, 0x03, 0x06, 0xC2, 0x01, 0x05, 0x8C,
-  0x04, 0x02, 0x82, 0x01, 0x05, 0x86, 0x04, 0x05, 0x82, 0x01, 0x8D, 0x04,
-  0x06, 0x9B, 0x01, 0x90, 0x04, 0x05, 0x85, 0x01, 0x06, 0xA9, 0x05, 0x87,
-  0x01, 0x8E, 0x04, 0x03, 0x06, 0x83, 0x01, 0x06, 0xAB, 0x05, 0x06, 0x85,
-  0x01, 0x05, 0x8E, 0x04, 0x02, 0x84, 0x01, 0x06, 0xAA, 0x05, 0x95, 0x01,
-  0x02, 0x8C, 0x04, 0x06, 0x82, 0x01, 0x87, 0x04, 0x03, 0x82, 0x01, 0x02,
-  0x8C, 0x04, 0x05, 0x9A, 0x01, 0x05, 0x8F, 0x04, 0x06, 0x83, 0x01, 0x05,
-  0x02, 0xAA, 0x04, 0x02, 0x86, 0x01, 0x05, 0x8D, 0x04, 0x03, 0x83, 0x01,
-  0x06, 0x02, 0xAC, 0x04, 0x05, 0x85, 0x01, 0x03, 0x8D, 0x04, 0x02, 0x83,
-  0x01, 0x05, 0x03, 0xAB, 0x04, 0x95, 0x01, 0x8D, 0x04, 0x82, 0x01, 0x05,
-  0x88, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x03, 0x9A, 0x01, 0x8E, 0x04,
-  0x03, 0x83, 0x01, 0x06, 0x03, 0xAC, 0x04, 0x02, 0x86, 0x01, 0x03, 0x8D,
-  0x04, 0x83, 0x01, 0x05, 0xAE, 0x04, 0x05, 0x84, 0x01, 0x06, 0x8D, 0x04,
-  0x02, 0x83, 0x01, 0x02, 0xAD, 0x04, 0x94, 0x01, 0x05, 0x8C, 0x04, 0x02,
-  0x82, 0x01, 0x02, 0x88, 0x04, 0x05, 0x82, 0x01, 0x8D, 0x04, 0x06, 0x98,
-  0x01, 0x05, 0x8E, 0x04, 0x06, 0x82, 0x01, 0x05, 0xAE, 0x04, 0x02, 0x86,
-  0x01, 0x8D, 0x04, 0x06, 0x82, 0x01, 0x05, 0xAF, 0x04, 0x05, 0x84, 0x01,
-  0x05, 0x8D, 0x04, 0x06, 0x82, 0x01, 0x03, 0xAE, 0x04, 0x94, 0x01, 0x03,
-  0x8C, 0x04, 0x06, 0x82, 0x01, 0x89, 0x04, 0x03, 0x82, 0x01, 0x02, 0x8C,
-  0x04, 0x05, 0x98, 0x01, 0x02, 0x8D, 0x04, 0x06, 0x82, 0x01, 0x05, 0xAF,
-  0x04, 0x02, 0x85, 0x01, 0x06, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x06, 0xB0,
-  0x04, 0x05, 0x84, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x05, 0xAF,
-  0x04, 0x93, 0x01, 0x06, 0x8D, 0x04, 0x82, 0x01, 0x05, 0x8A, 0x04, 0x06,
-  0x01, 0x06, 0x8C, 0x04, 0x03, 0x98, 0x01, 0x8D, 0x04, 0x05, 0x82, 0x01,
-  0x05, 0xB0, 0x04, 0x02, 0x85, 0x01, 0x05, 0x8C, 0x04, 0x06, 0x82, 0x01,
-  0x03, 0xB0, 0x04, 0x05, 0x84, 0x01, 0x03, 0x8C, 0x04, 0x82, 0x01, 0x06,
-  0xB0, 0x04, 0x93, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8A,
-  0x04, 0x05, 0x82, 0x01, 0x8D, 0x04, 0x06, 0x96, 0x01, 0x05, 0x8D, 0x04,
-  0x82, 0x01, 0x06, 0xB1, 0x04, 0x02, 0x85, 0x01, 0x02, 0x8C, 0x04, 0x82,
-  0x01, 0x06, 0xB1, 0x04, 0x05, 0x84, 0x01, 0x8C, 0x04, 0x02, 0x82, 0x01,
-  0x02, 0xB0, 0x04, 0x93, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8B,
-  0x04, 0x03, 0x82, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x96, 0x01, 0x02, 0x8C,
-  0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x02, 0x85, 0x01, 0x02, 0x8B,
-  0x04, 0x02, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x05, 0x83, 0x01, 0x06, 0x8C,
-  0x04, 0x05, 0x82, 0x01, 0xB1, 0x04, 0x92, 0x01, 0x06, 0x8D, 0x04, 0x82,
-  0x01, 0x05, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x03, 0x96, 0x01,
-  0x03, 0x8C, 0x04, 0x82, 0x01, 0x06, 0xB2, 0x04, 0x02, 0x85, 0x01, 0x02,
-  0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x05, 0x83, 0x01, 0x06,
-  0x8C, 0x04, 0x06, 0x01, 0x06, 0xB1, 0x04, 0x92, 0x01, 0x05, 0x8C, 0x04,
-  0x02, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8C, 0x04,
-  0x06, 0x95, 0x01, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02, 0xB2, 0x04, 0x02,
-  0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x05,
-  0x83, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0xB1, 0x04, 0x92, 0x01,
-  0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8D, 0x04, 0x03, 0x82, 0x01, 0x05,
-  0x8C, 0x04, 0x05, 0x95, 0x01, 0x8C, 0x04, 0x05, 0x82, 0x01, 0xB3, 0x04,
-  0x02, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04,
-  0x05, 0x83, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0xB1, 0x04, 0x91,
-  0x01, 0x06, 0x8D, 0x04, 0x82, 0x01, 0x05, 0x8E, 0x04, 0x06, 0x01, 0x06,
-  0x8C, 0x04, 0x03, 0x95, 0x01, 0x8C, 0x04, 0x06, 0x01, 0x06, 0xB3, 0x04,
-  0x02, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04,
-  0x05, 0x83, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0xB1, 0x04, 0x91,
-  0x01, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x03, 0x8E, 0x04, 0x05, 0x82,
-  0x01, 0x03, 0x8C, 0x04, 0x06, 0x94, 0x01, 0x8C, 0x04, 0x06, 0x01, 0x06,
-  0x8D, 0x04, 0xA6, 0x02, 0x05, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82,
-  0x01, 0x02, 0x8D, 0x04, 0x03, 0xA3, 0x02, 0x05, 0x83, 0x01, 0x06, 0x8C,
-  0x04, 0x06, 0x01, 0x06, 0x8E, 0x04, 0xA3, 0x02, 0x91, 0x01, 0x03, 0x8C,
-  0x04, 0x06, 0x01, 0x06, 0x8F, 0x04, 0x03, 0x82, 0x01, 0x05, 0x8C, 0x04,
-  0x05, 0x94, 0x01, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x06, 0xAC,
-  0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0x8C, 0x04, 0x06, 0xA8,
-  0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x03, 0xB4, 0x01,
-  0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x90, 0x04, 0x06, 0x01, 0x06,
-  0x8C, 0x04, 0x03, 0x94, 0x01, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04,
-  0xAD, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0x8B, 0x04, 0x02,
-  0xA9, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x06, 0xB4,
-  0x01, 0x05, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x03, 0x90, 0x04, 0x05, 0x82,
-  0x01, 0x03, 0x8C, 0x04, 0x06, 0x93, 0x01, 0x8C, 0x04, 0x06, 0x01, 0x06,
-  0x8C, 0x04, 0x03, 0x8C, 0x02, 0x83, 0x05, 0x06, 0x9C, 0x01, 0x02, 0x8B,
-  0x04, 0x05, 0x82, 0x01, 0x02, 0x8B, 0x04, 0x03, 0x9C, 0x02, 0x05, 0x8C,
-  0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x05,
-  0xA2, 0x02, 0x90, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x91, 0x04,
-  0x03, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x93, 0x01, 0x8C, 0x04, 0x06,
-  0x01, 0x06, 0x9E, 0x04, 0x02, 0x05, 0x06, 0x98, 0x01, 0x02, 0x8B, 0x04,
-  0x05, 0x82, 0x01, 0x02, 0xA8, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04,
-  0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0xA2, 0x04, 0x8F, 0x01,
-  0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x92, 0x04, 0x06, 0x01, 0x06,
-  0x8C, 0x04, 0x03, 0x93, 0x01, 0x8C, 0x04, 0x05, 0x82, 0x01, 0xA1, 0x04,
-  0x03, 0x05, 0x96, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xA8,
-  0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04,
-  0x82, 0x01, 0x05, 0xA2, 0x04, 0x8F, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x82,
-  0x01, 0x03, 0x92, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x92,
-  0x01, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02, 0xA3, 0x04, 0x05, 0x94, 0x01,
-  0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xA8, 0x04, 0x02, 0x8C, 0x01,
-  0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0xA2,
-  0x04, 0x8F, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x93, 0x04, 0x03,
-  0x82, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x92, 0x01, 0x03, 0x8C, 0x04, 0x82,
-  0x01, 0x06, 0xA4, 0x04, 0x03, 0x06, 0x92, 0x01, 0x02, 0x8B, 0x04, 0x05,
-  0x82, 0x01, 0x02, 0xA8, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06,
-  0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0xA2, 0x04, 0x8E, 0x01, 0x06,
-  0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x94, 0x04, 0x06, 0x01, 0x06, 0x8C,
-  0x04, 0x03, 0x92, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x02, 0xA5,
-  0x04, 0x02, 0x91, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xA8,
-  0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04,
-  0x82, 0x01, 0x05, 0xA2, 0x04, 0x8E, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x82,
-  0x01, 0x03, 0x94, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x91,
-  0x01, 0x05, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x06, 0xA6, 0x04, 0x03, 0x06,
-  0x8F, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x03, 0xA8, 0x04, 0x02,
-  0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01,
-  0x05, 0xA2, 0x04, 0x8E, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x95,
-  0x04, 0x03, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x91, 0x01, 0x06, 0x8D,
-  0x04, 0x05, 0x82, 0x01, 0x05, 0xA7, 0x04, 0x06, 0x8E, 0x01, 0x02, 0x8B,
-  0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04,
-  0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0xA2, 0x04, 0x8D, 0x01,
-  0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x96, 0x04, 0x06, 0x01, 0x06,
-  0x8C, 0x04, 0x03, 0x92, 0x01, 0x03, 0x8D, 0x04, 0x06, 0x82, 0x01, 0x02,
-  0xA7, 0x04, 0x05, 0x8D, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9,
-  0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04,
-  0x82, 0x01, 0x05, 0xA2, 0x04, 0x8D, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x82,
-  0x01, 0x03, 0x96, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x91,
-  0x01, 0x05, 0x8D, 0x04, 0x03, 0x83, 0x01, 0x05, 0xA7, 0x04, 0x06, 0x8C,
-  0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01,
-  0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0xA2,
-  0x04, 0x8D, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x97, 0x04, 0x03,
-  0x82, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x92, 0x01, 0x8E, 0x04, 0x03, 0x83,
-  0x01, 0x06, 0x03, 0xA6, 0x04, 0x06, 0x8B, 0x01, 0x02, 0x8B, 0x04, 0x05,
-  0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01,
-  0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0xA2, 0x04, 0x8C, 0x01, 0x06, 0x8C,
-  0x04, 0x03, 0x82, 0x01, 0x05, 0x98, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04,
-  0x03, 0x92, 0x01, 0x05, 0x8E, 0x04, 0x03, 0x06, 0x83, 0x01, 0x05, 0x03,
-  0xA4, 0x04, 0x03, 0x8B, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9,
-  0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04,
-  0x82, 0x01, 0x05, 0xA2, 0x04, 0x8C, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x82,
-  0x01, 0x03, 0x98, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x92,
-  0x01, 0x90, 0x04, 0x05, 0x84, 0x01, 0x06, 0x83, 0x05, 0x8C, 0x02, 0x95,
-  0x04, 0x02, 0x8A, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x02,
-  0x05, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82,
-  0x01, 0x05, 0x95, 0x02, 0x03, 0x8C, 0x04, 0x8C, 0x01, 0x03, 0x8C, 0x04,
-  0x06, 0x01, 0x06, 0x99, 0x04, 0x03, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x05,
-  0x92, 0x01, 0x05, 0x90, 0x04, 0x02, 0x06, 0x94, 0x01, 0x06, 0x02, 0x92,
-  0x04, 0x06, 0x89, 0x01, 0x02, 0x8B, 0x04, 0x05, 0xB8, 0x01, 0x06, 0x8C,
-  0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x98, 0x01, 0x06, 0x8C, 0x04, 0x8B,
-  0x01, 0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x9A, 0x04, 0x06, 0x01,
-  0x06, 0x8C, 0x04, 0x03, 0x93, 0x01, 0x03, 0x91, 0x04, 0x03, 0x05, 0x06,
-  0x94, 0x01, 0x05, 0x90, 0x04, 0x03, 0x89, 0x01, 0x02, 0x8B, 0x04, 0x05,
-  0xB8, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x98, 0x01,
-  0x06, 0x8C, 0x04, 0x8B, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x03,
-  0x9A, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x92, 0x01, 0x06,
-  0x96, 0x04, 0x8D, 0x02, 0x05, 0x06, 0x84, 0x01, 0x06, 0x02, 0x8F, 0x04,
-  0x05, 0x88, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x02, 0x05,
-  0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01,
-  0x06, 0x93, 0x02, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x8B, 0x01, 0x8D, 0x04,
-  0x06, 0x01, 0x06, 0x9C, 0x04, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x05, 0x93,
-  0x01, 0x05, 0xA5, 0x04, 0x02, 0x06, 0x83, 0x01, 0x05, 0x8F, 0x04, 0x88,
-  0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01,
-  0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x93,
-  0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x8A, 0x01, 0x06, 0x8C, 0x04, 0x03,
-  0x82, 0x01, 0x05, 0x9C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x03, 0x94,
-  0x01, 0x02, 0xA6, 0x04, 0x02, 0x83, 0x01, 0x05, 0x8E, 0x04, 0x05, 0x87,
-  0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01,
-  0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x93,
-  0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x8A, 0x01, 0x02, 0x8C, 0x04, 0x05,
-  0x82, 0x01, 0x03, 0x8D, 0x04, 0x02, 0x8E, 0x04, 0x02, 0x82, 0x01, 0x03,
-  0x8C, 0x04, 0x06, 0x94, 0x01, 0x03, 0xA6, 0x04, 0x03, 0x06, 0x82, 0x01,
-  0x05, 0x8D, 0x04, 0x03, 0x87, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01,
-  0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C,
-  0x04, 0x82, 0x01, 0x06, 0x93, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x8A,
-  0x01, 0x8D, 0x04, 0x06, 0x01, 0x06, 0x8E, 0x04, 0x06, 0x02, 0x8E, 0x04,
-  0x82, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x95, 0x01, 0x03, 0xA7, 0x04, 0x06,
-  0x82, 0x01, 0x02, 0x8D, 0x04, 0x06, 0x86, 0x01, 0x02, 0x8B, 0x04, 0x05,
-  0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01,
-  0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x93, 0x04, 0x82, 0x01, 0x06, 0x8C,
-  0x04, 0x89, 0x01, 0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x8E, 0x04,
-  0x01, 0x06, 0x8E, 0x04, 0x06, 0x01, 0x06, 0x8D, 0x04, 0x96, 0x01, 0x02,
-  0xA7, 0x04, 0x83, 0x01, 0x8D, 0x04, 0x05, 0x86, 0x01, 0x02, 0x8B, 0x04,
-  0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06,
-  0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x93, 0x04, 0x82, 0x01, 0x06,
-  0x8C, 0x04, 0x89, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x03, 0x8D,
-  0x04, 0x02, 0x82, 0x01, 0x8E, 0x04, 0x02, 0x82, 0x01, 0x03, 0x8C, 0x04,
-  0x06, 0x96, 0x01, 0x05, 0xA6, 0x04, 0x02, 0x82, 0x01, 0x05, 0x8C, 0x04,
-  0x03, 0x86, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02,
-  0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01,
-  0x06, 0x93, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x89, 0x01, 0x8D, 0x04,
-  0x06, 0x01, 0x06, 0x8E, 0x04, 0x06, 0x82, 0x01, 0x02, 0x8E, 0x04, 0x82,
-  0x01, 0x05, 0x8C, 0x04, 0x02, 0x97, 0x01, 0x06, 0xA6, 0x04, 0x06, 0x82,
-  0x01, 0x8D, 0x04, 0x86, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9,
-  0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04,
-  0x82, 0x01, 0x06, 0x93, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x88, 0x01,
-  0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x05, 0x8E, 0x04, 0x83, 0x01, 0x06,
-  0x8E, 0x04, 0x06, 0x01, 0x06, 0x8D, 0x04, 0x99, 0x01, 0x02, 0xA4, 0x04,
-  0x02, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x06, 0x85, 0x01, 0x02, 0x8B, 0x04,
-  0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06,
-  0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x93, 0x04, 0x82, 0x01, 0x06,
-  0x8C, 0x04, 0x88, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x8E, 0x04,
-  0x02, 0x84, 0x01, 0x8E, 0x04, 0x02, 0x82, 0x01, 0x03, 0x8C, 0x04, 0x06,
-  0x99, 0x01, 0x06, 0x02, 0xA3, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x05,
-  0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C,
-  0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06,
-  0x93, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x88, 0x01, 0x8D, 0x04, 0x06,
-  0x01, 0x06, 0x8E, 0x04, 0x06, 0x84, 0x01, 0x02, 0x8E, 0x04, 0x82, 0x01,
-  0x05, 0x8C, 0x04, 0x02, 0x9B, 0x01, 0x06, 0x02, 0xA1, 0x04, 0x05, 0x82,
-  0x01, 0x8C, 0x04, 0x05, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01,
-  0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C,
-  0x04, 0x82, 0x01, 0x06, 0x93, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x87,
-  0x01, 0x06, 0x8C, 0x04, 0x03, 0x82, 0x01, 0x02, 0x8E, 0x04, 0x85, 0x01,
-  0x06, 0x8E, 0x04, 0x06, 0x01, 0x06, 0x8D, 0x04, 0x9E, 0x01, 0x06, 0x02,
-  0x03, 0x9D, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8B, 0x04, 0x02, 0x85, 0x01,
-  0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0xA9, 0x04, 0x02, 0x8C, 0x01, 0x06,
-  0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x93, 0x04,
-  0x82, 0x01, 0x06, 0x8C, 0x04, 0x87, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82,
-  0x01, 0x8E, 0x04, 0x02, 0x86, 0x01, 0x8E, 0x04, 0x02, 0x82, 0x01, 0x03,
-  0x8C, 0x04, 0x06, 0xA0, 0x01, 0x82, 0x06, 0x83, 0x05, 0x8B, 0x02, 0x03,
-  0x8C, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8B, 0x04, 0x02, 0x85, 0x01, 0x02,
-  0x8B, 0x04, 0x05, 0x82, 0x01, 0x8C, 0x04, 0x02, 0x9D, 0x05, 0x8C, 0x01,
-  0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x86,
-  0x05, 0x02, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x87, 0x01, 0x8D,
-  0x04, 0x82, 0x01, 0x06, 0x8E, 0x04, 0x06, 0x86, 0x01, 0x05, 0x8E, 0x04,
-  0x82, 0x01, 0x05, 0x8C, 0x04, 0x02, 0xB1, 0x01, 0x02, 0x8B, 0x04, 0x02,
-  0x82, 0x01, 0x05, 0x8B, 0x04, 0x02, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05,
-  0x82, 0x01, 0x02, 0x8B, 0x04, 0x02, 0xA9, 0x01, 0x06, 0x8C, 0x04, 0x06,
-  0x01, 0x06, 0x8C, 0x04, 0x05, 0x88, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01,
-  0x06, 0x8C, 0x04, 0x86, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02,
-  0x8E, 0x04, 0x87, 0x01, 0x06, 0x8E, 0x04, 0x06, 0x01, 0x06, 0x8D, 0x04,
-  0xB1, 0x01, 0x02, 0x8B, 0x04, 0x02, 0x82, 0x01, 0x05, 0x8B, 0x04, 0x02,
-  0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0x8C, 0x04, 0x05,
-  0xA8, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0x8D, 0x04, 0x06, 0x87,
-  0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x86, 0x01, 0x02,
-  0x8C, 0x04, 0x05, 0x82, 0x01, 0xA5, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8C,
-  0x04, 0x06, 0x89, 0x01, 0xA6, 0x02, 0x03, 0x8C, 0x04, 0x02, 0x82, 0x01,
-  0x02, 0x8B, 0x04, 0x02, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01,
-  0x02, 0x8E, 0x04, 0xA3, 0x02, 0x05, 0x83, 0x01, 0x06, 0x8C, 0x04, 0x06,
-  0x01, 0x06, 0x8E, 0x04, 0x03, 0x86, 0x02, 0x03, 0x8C, 0x04, 0x82, 0x01,
-  0x06, 0x8C, 0x04, 0x86, 0x01, 0x8D, 0x04, 0x82, 0x01, 0x06, 0xA6, 0x04,
-  0x82, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x89, 0x01, 0xB3, 0x04, 0x02, 0x82,
-  0x01, 0x02, 0x8B, 0x04, 0x02, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82,
-  0x01, 0x02, 0xB1, 0x04, 0x05, 0x83, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01,
-  0x06, 0xA2, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x85, 0x01, 0x05, 0x8C,
-  0x04, 0x02, 0x82, 0x01, 0x02, 0xA6, 0x04, 0x06, 0x82, 0x01, 0x8D, 0x04,
-  0x89, 0x01, 0xB3, 0x04, 0x05, 0x82, 0x01, 0x8C, 0x04, 0x05, 0x85, 0x01,
-  0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x05, 0x83, 0x01,
-  0x06, 0x8C, 0x04, 0x06, 0x01, 0x06, 0xA2, 0x04, 0x82, 0x01, 0x06, 0x8C,
-  0x04, 0x85, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0xA7, 0x04, 0x02,
-  0x82, 0x01, 0x02, 0x8C, 0x04, 0x06, 0x88, 0x01, 0xB3, 0x04, 0x82, 0x01,
-  0x06, 0x8C, 0x04, 0x05, 0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01,
-  0x02, 0xB1, 0x04, 0x05, 0x83, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x01, 0x06,
-  0xA2, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x85, 0x01, 0x8D, 0x04, 0x82,
-  0x01, 0x06, 0x8E, 0x04, 0x03, 0x99, 0x04, 0x82, 0x01, 0x05, 0x8C, 0x04,
-  0x02, 0x88, 0x01, 0xB2, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8C, 0x04, 0x06,
-  0x85, 0x01, 0x02, 0x8B, 0x04, 0x05, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x05,
-  0x83, 0x01, 0x06, 0x8C, 0x04, 0x06, 0x82, 0x01, 0xA2, 0x04, 0x82, 0x01,
-  0x06, 0x8C, 0x04, 0x84, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02,
-  0x8E, 0x04, 0x05, 0x99, 0x04, 0x06, 0x82, 0x01, 0x8D, 0x04, 0x88, 0x01,
-  0xB2, 0x04, 0x06, 0x82, 0x01, 0x8D, 0x04, 0x86, 0x01, 0x02, 0x8B, 0x04,
-  0x02, 0x82, 0x01, 0x02, 0xB1, 0x04, 0x05, 0x84, 0x01, 0x8C, 0x04, 0x05,
-  0x82, 0x01, 0xA2, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x84, 0x01, 0x02,
-  0x8C, 0x04, 0x05, 0x82, 0x01, 0x8E, 0x04, 0x82, 0x05, 0x99, 0x04, 0x02,
-  0x82, 0x01, 0x02, 0x8C, 0x04, 0x06, 0x87, 0x01, 0xB1, 0x04, 0x05, 0x82,
-  0x01, 0x05, 0x8C, 0x04, 0x03, 0x86, 0x01, 0x02, 0x8C, 0x04, 0x82, 0x01,
-  0x06, 0xB1, 0x04, 0x05, 0x84, 0x01, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02,
-  0xA1, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x84, 0x01, 0x8D, 0x04, 0x82,
-  0x01, 0x06, 0x8E, 0x04, 0x06, 0x05, 0x9A, 0x04, 0x82, 0x01, 0x05, 0x8C,
-  0x04, 0x02, 0x87, 0x01, 0xB0, 0x04, 0x03, 0x82, 0x01, 0x06, 0x8D, 0x04,
-  0x05, 0x86, 0x01, 0x05, 0x8C, 0x04, 0x06, 0x82, 0x01, 0x03, 0xB0, 0x04,
-  0x05, 0x84, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x01, 0x06, 0xA1, 0x04, 0x82,
-  0x01, 0x06, 0x8C, 0x04, 0x83, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01,
-  0x02, 0x8D, 0x04, 0x03, 0x01, 0x05, 0x9A, 0x04, 0x06, 0x82, 0x01, 0x8D,
-  0x04, 0x87, 0x01, 0xAF, 0x04, 0x03, 0x83, 0x01, 0x03, 0x8D, 0x04, 0x06,
-  0x86, 0x01, 0x06, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x06, 0xB0, 0x04, 0x05,
-  0x84, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01, 0x05, 0xA0, 0x04, 0x82,
-  0x01, 0x06, 0x8C, 0x04, 0x83, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x82, 0x01,
-  0x8E, 0x04, 0x05, 0x01, 0x05, 0x9A, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8C,
-  0x04, 0x06, 0x86, 0x01, 0xAE, 0x04, 0x02, 0x83, 0x01, 0x02, 0x8D, 0x04,
-  0x03, 0x88, 0x01, 0x8D, 0x04, 0x06, 0x82, 0x01, 0x05, 0xAF, 0x04, 0x05,
-  0x84, 0x01, 0x05, 0x8D, 0x04, 0x06, 0x82, 0x01, 0x03, 0x9F, 0x04, 0x82,
-  0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x06, 0x8D, 0x04, 0x82, 0x01, 0x05,
-  0x8E, 0x04, 0x06, 0x01, 0x05, 0x9B, 0x04, 0x82, 0x01, 0x05, 0x8C, 0x04,
-  0x02, 0x86, 0x01, 0xAD, 0x04, 0x05, 0x83, 0x01, 0x02, 0x8E, 0x04, 0x05,
-  0x88, 0x01, 0x02, 0x8D, 0x04, 0x83, 0x01, 0x05, 0xAE, 0x04, 0x05, 0x84,
-  0x01, 0x06, 0x8D, 0x04, 0x03, 0x83, 0x01, 0x02, 0x9E, 0x04, 0x82, 0x01,
-  0x06, 0x8C, 0x04, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02,
-  0x8D, 0x04, 0x03, 0x82, 0x01, 0x05, 0x9B, 0x04, 0x05, 0x82, 0x01, 0x8D,
-  0x04, 0x86, 0x01, 0xAA, 0x04, 0x03, 0x05, 0x84, 0x01, 0x02, 0x8E, 0x04,
-  0x03, 0x89, 0x01, 0x05, 0x8D, 0x04, 0x03, 0x83, 0x01, 0x06, 0x02, 0xAC,
-  0x04, 0x05, 0x85, 0x01, 0x03, 0x8D, 0x04, 0x02, 0x83, 0x01, 0x05, 0x03,
-  0x9C, 0x04, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x82, 0x01, 0x03, 0x8C, 0x04,
-  0x05, 0x82, 0x01, 0x8E, 0x04, 0x05, 0x82, 0x01, 0x05, 0x9B, 0x04, 0x02,
-  0x82, 0x01, 0x02, 0x8C, 0x04, 0x06, 0x85, 0x01, 0xA8, 0x05, 0x82, 0x06,
-  0x84, 0x01, 0x06, 0x03, 0x8F, 0x04, 0x05, 0x8A, 0x01, 0x8E, 0x04, 0x03,
-  0x06, 0x84, 0x01, 0x06, 0xAA, 0x05, 0x06, 0x85, 0x01, 0x05, 0x8E, 0x04,
-  0x02, 0x84, 0x01, 0x06, 0x9B, 0x05, 0x82, 0x01, 0x06, 0x8C, 0x04, 0x01,
-  0x06, 0x8D, 0x04, 0x82, 0x01, 0x05, 0x8E, 0x04, 0x06, 0x82, 0x01, 0x05,
-  0x9C, 0x02, 0x82, 0x01, 0x05, 0x8C, 0x04, 0x02, 0xB1, 0x01, 0x06, 0x02,
-  0x90, 0x04, 0x03, 0x8B, 0x01, 0x02, 0x8F, 0x04, 0x05, 0xB5, 0x01, 0x90,
-  0x04, 0x05, 0xA0, 0x01, 0x06, 0x8C, 0x04, 0x01, 0x05, 0x8C, 0x04, 0x02,
-  0x82, 0x01, 0x02, 0x8D, 0x04, 0x03, 0xA3, 0x01, 0x8D, 0x04, 0xAE, 0x01,
-  0x06, 0x05, 0x03, 0x92, 0x04, 0x06, 0x8B, 0x01, 0x06, 0x90, 0x04, 0x03,
-  0x05, 0x06, 0xB2, 0x01, 0x05, 0x90, 0x04, 0x03, 0x05, 0x06, 0x9D, 0x01,
-  0x06, 0x8C, 0x04, 0x01, 0x03, 0x8C, 0x04, 0x06, 0x82, 0x01, 0x8E, 0x04,
-  0x05, 0xA3, 0x01, 0x02, 0x8C, 0x04, 0x05, 0x84, 0x01, 0xBD, 0x04, 0x05,
-  0x8D, 0x01, 0x05, 0x93, 0x04, 0x03, 0xA9, 0x02, 0x05, 0x87, 0x01, 0x03,
-  0x94, 0x04, 0x9B, 0x02, 0x03, 0x8C, 0x04, 0x06, 0x8D, 0x04, 0x82, 0x01,
-  0x05, 0x8E, 0x04, 0x06, 0x83, 0x01, 0x05, 0x9F, 0x02, 0x03, 0x8C, 0x04,
-  0x02, 0x84, 0x01, 0xBC, 0x04, 0x03, 0x8F, 0x01, 0x03, 0xBC, 0x04, 0x05,
-  0x87, 0x01, 0x06, 0xBC, 0x04, 0x05, 0x8C, 0x04, 0x02, 0x82, 0x01, 0x02,
-  0x8D, 0x04, 0x03, 0x84, 0x01, 0x05, 0xAD, 0x04, 0x84, 0x01, 0xBC, 0x04,
-  0x90, 0x01, 0x06, 0xBC, 0x04, 0x05, 0x88, 0x01, 0x05, 0xBB, 0x04, 0x03,
-  0x8C, 0x04, 0x06, 0x82, 0x01, 0x8E, 0x04, 0x05, 0x84, 0x01, 0x05, 0xAD,
-  0x04, 0x05, 0x83, 0x01, 0xBB, 0x04, 0x06, 0x91, 0x01, 0x05, 0xBB, 0x04,
-  0x05, 0x89, 0x01, 0x03, 0xC7, 0x04, 0x82, 0x01, 0x05, 0x8E, 0x04, 0x06,
-  0x84, 0x01, 0x05, 0xAD, 0x04, 0x02, 0x83, 0x01, 0xBA, 0x04, 0x06, 0x93,
-  0x01, 0x02, 0xBA, 0x04, 0x05, 0x8A, 0x01, 0x03, 0xC5, 0x04, 0x02, 0x82,
-  0x01, 0x02, 0x8D, 0x04, 0x03, 0x85, 0x01, 0x05, 0xAE, 0x04, 0x83, 0x01,
-  0xB8, 0x04, 0x03, 0x06, 0x95, 0x01, 0x02, 0xB9, 0x04, 0x05, 0x8B, 0x01,
-  0x03, 0xC4, 0x04, 0x06, 0x82, 0x01, 0x8E, 0x04, 0x05, 0x85, 0x01, 0x05,
-  0xAE, 0x04, 0x05, 0x82, 0x01, 0xB7, 0x04, 0x02, 0x98, 0x01, 0x05, 0xB8,
-  0x04, 0x05, 0x8C, 0x01, 0x03, 0xC3, 0x04, 0x82, 0x01, 0x05, 0x8E, 0x04,
-  0x06, 0x85, 0x01, 0x05, 0xAE, 0x04, 0x02, 0x82, 0x01, 0xB6, 0x04, 0x05,
-  0x9A, 0x01, 0x05, 0xB7, 0x04, 0x05, 0x8D, 0x01, 0x02, 0xC1, 0x04, 0x02,
-  0x82, 0x01, 0x02, 0x8D, 0x04, 0x03, 0x86, 0x01, 0x05, 0xAF, 0x04, 0x82,
-  0x01, 0xB4, 0x04, 0x02, 0x06, 0x9C, 0x01, 0x06, 0x02, 0xB5, 0x04, 0x05,
-  0x8E, 0x01, 0x06, 0xC0, 0x04, 0x06, 0x82, 0x01, 0x8E, 0x04, 0x05, 0x86,
-  0x01, 0x05, 0xAF, 0x04, 0x05, 0x01, 0xB2, 0x04, 0x02, 0x06, 0xA0, 0x01,
-  0x05, 0x03, 0xB3, 0x04, 0x05, 0x90, 0x01, 0x05, 0xBE, 0x04, 0x82, 0x01,
-  0x05, 0x8E, 0x04, 0x06, 0x86, 0x01, 0x05, 0xAF, 0x04, 0x02, 0x01, 0xB0,
-  0x04, 0x02, 0x06, 0xA4, 0x01, 0x05, 0x03, 0xB1, 0x04, 0x05, 0x92, 0x01,
-  0x05, 0x03, 0xBA, 0x04, 0x02, 0x82, 0x01, 0x02, 0x8D, 0x04, 0x03, 0x87,
-  0x01, 0x05, 0xB0, 0x04, 0x01, 0xAC, 0x04, 0x03, 0x02, 0x06, 0xA9, 0x01,
-  0x06, 0x05, 0x02, 0xAE, 0x04, 0x05, 0x94, 0x01, 0x06, 0x05, 0x03, 0xB7,
-  0x04, 0x06, 0x01, 0x06, 0x8E, 0x04, 0x05, 0x87, 0x01, 0x05, 0xB0, 0x04,
-  0xAA, 0x05, 0x82, 0x06, 0xB1, 0x01, 0x82, 0x06, 0xAB, 0x05, 0x06, 0x98,
-  0x01, 0x82, 0x06, 0xB4, 0x05, 0x82, 0x01, 0x06, 0x8E, 0x05, 0x06, 0x87,
-  0x01, 0x06, 0xB0, 0x05, 0x06, 0xFA, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xF8,
-  0x00, 0x7C, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x38, 0xE0, 0x1C, 0x70, 0x1C,
-  0x1C, 0x0E, 0x0E, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0x00, 0x73, 0x80, 0x3B,
-  0x80, 0x0F, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xE7, 0xFF, 0xB8, 0x1F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x81,
-  0xDF, 0xFC, 0xFF, 0xF7, 0x03, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x3F,
-  0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-  0xFF, 0xE7, 0x81, 0xDC, 0x03, 0xE0, 0x0F, 0x80, 0x0E, 0x00, 0x38, 0x00,
-  0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x03, 0x70, 0x0D, 0xE0, 0x73, 0xFF,
-  0x87, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0x60, 0xFF, 0xE7, 0xFF, 0xB8, 0x1F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F,
-  0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0,
-  0x3F, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-  0x00, 0xE0, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFE, 0xFF, 0xEE,
-  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xE7, 0x81, 0xDC, 0x03, 0xE0,
-  0x0F, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0xFF, 0x83, 0xFE, 0x00, 0xF8,
-  0x03, 0x70, 0x0D, 0xE0, 0x73, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0,
-  0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C,
-  0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0C, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0x38, 0x38,
-  0x00, 0xE0, 0xE0, 0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0x38, 0x38, 0x00,
-  0xE0, 0xE0, 0x03, 0x83, 0x80, 0x0E, 0x0E, 0x00, 0x38, 0x38, 0x00, 0xE0,
-  0xE0, 0x03, 0x83, 0x80, 0x0E, 0x0F, 0xFE, 0x38, 0x3F, 0xF8, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01,
-  0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xFC, 0x0F, 0xFF, 0x03, 0xFE,
-  0xE1, 0xDF, 0xB8, 0x77, 0xE7, 0x39, 0xF9, 0xCE, 0x7E, 0x3F, 0x1F, 0x8F,
-  0xC7, 0xE1, 0xE1, 0xF8, 0x78, 0x7E, 0x0C, 0x1F, 0x80, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0xC0, 0x7F, 0x81,
-  0xFF, 0x07, 0xFC, 0x1F, 0xF8, 0x7E, 0xF1, 0xF9, 0xC7, 0xE3, 0x9F, 0x8F,
-  0x7E, 0x1F, 0xF8, 0x3F, 0xE0, 0xFF, 0x81, 0xFE, 0x03, 0xF8, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xF1, 0xE0, 0xF3,
-  0x80, 0xEE, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
-  0x1F, 0x80, 0x3F, 0x00, 0x77, 0x01, 0xCF, 0x07, 0x8F, 0xFE, 0x0F, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0xE0,
-  0xFE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x0F, 0xFF, 0xEF, 0xFC, 0xE0,
-  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xB8, 0x1F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F,
-  0x80, 0xFC, 0x0F, 0xFF, 0xF7, 0xFF, 0x38, 0x39, 0xC1, 0xEE, 0x07, 0x70,
-  0x3F, 0x80, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xE3, 0xFF, 0xBC, 0x1F, 0xC0, 0x7E, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0xFC,
-  0x3F, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x7E, 0x03, 0xF8, 0x3D, 0xFF, 0xC7,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC1,
-  0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
-  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E,
-  0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0,
-  0x7E, 0x03, 0xF8, 0x3D, 0xFF, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xE0, 0x0F, 0xE0, 0x3D, 0xC0, 0x73, 0xC1, 0xE3, 0xC7, 0x83,
-  0x8E, 0x07, 0xBC, 0x07, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x0E, 0x00, 0x1C,
-  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x09, 0x00, 0x46, 0x6F, 0x72, 0x20,
-  0x4A, 0x41, 0x50, 0x41, 0x4E, 0x2C, 0x54, 0x41, 0x49, 0x57, 0x41, 0x4E,
-  0x2C, 0x50, 0x48, 0x49, 0x4C, 0x49, 0x50, 0x49, 0x4E, 0x45, 0x53, 0x2E,
-  0x0E, 0xA0, 0x09, 0x00, 0x46, 0x6F, 0x72, 0x20, 0x55, 0x53, 0x41, 0x20,
-  0x61, 0x6E, 0x64, 0x20, 0x43, 0x41, 0x4E, 0x41, 0x44, 0x41, 0x2E, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0E, 0xA0, 0x09, 0x00,
-  0x46, 0x6F, 0x72, 0x20, 0x45, 0x55, 0x52, 0x4F, 0x50, 0x45, 0x2E, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x0E, 0xA0, 0x09, 0x00, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x0E, 0xA0, 0x09, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0E, 0xA0, 0x09, 0x00,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x0E, 0xA0, 0x09, 0x00, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x0E, 0xA0, 0x09, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x06, 0xD0, 0x2B, 0x40,
-  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x20, 0xD8, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0xD0, 0x00, 0xE1, 0x0B, 0x40, 0x09, 0x00, 0x05, 0xD0, 0x0B, 0x40,
-  0x09, 0x00, 0x05, 0xD0, 0x0B, 0x40, 0x09, 0x00, 0x04, 0xD0, 0x2B, 0x40,
-  0x09, 0x00, 0x09, 0x00, 0x28, 0xD9, 0x00, 0x8C, 0xE8, 0xD8, 0x00, 0x8C,
-  0x70, 0xD8, 0x00, 0x8C, 0x54, 0xD8, 0x00, 0x8C, 0x49, 0x4E, 0x49, 0x38,
-  0x31, 0x32, 0x30, 0x37, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x01, 0xD0,
-  0x2B, 0x40, 0x09, 0x00, 0x00, 0xE0, 0x00, 0x8C, 0x22, 0x4F, 0x06, 0xD0,
-  0x02, 0x60, 0x06, 0x88, 0x05, 0x89, 0x07, 0x88, 0x03, 0x89, 0x09, 0x88,
-  0x01, 0x89, 0x0B, 0x00, 0x26, 0x4F, 0x02, 0xD1, 0x2B, 0x41, 0x09, 0x00,
-  0x48, 0x00, 0x00, 0x8C, 0x94, 0xD8, 0x00, 0x8C, 0x01, 0xD0, 0x02, 0x60,
-  0x2B, 0x40, 0x01, 0xE4, 0xE0, 0x00, 0x00, 0x8C, 0x4E, 0x60, 0x39, 0xE1,
-  0x17, 0x30, 0x00, 0x8B, 0xF9, 0x70, 0x0B, 0x00, 0xD0, 0x70, 0x2A, 0x22,
-  0x22, 0x4F, 0x40, 0x64, 0x43, 0x60, 0x20, 0x88, 0x06, 0x89, 0xF1, 0xBF,
-  0x09, 0x00, 0x01, 0xE1, 0x18, 0x20, 0x01, 0x8D, 0x2A, 0x22, 0x01, 0xE2,
-  0x26, 0x4F, 0x0B, 0x00, 0x23, 0x60, 0xFF, 0xFF, 0x04, 0xD1, 0x03, 0xD3,
-  0x12, 0x62, 0x30, 0x32, 0x29, 0x00, 0x0B, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x20, 0x4D, 0x49, 0x4C, 0x24, 0x80, 0x00, 0x8C, 0x22, 0x4F, 0x0A, 0xD3,
-  0x0D, 0xD4, 0x0B, 0x43, 0x3E, 0x74, 0x08, 0x20, 0x0B, 0x8B, 0x08, 0xD3,
-  0x0B, 0x43, 0x09, 0x00, 0x08, 0x20, 0x06, 0x8B, 0x07, 0xD3, 0x31, 0x60,
-  0x22, 0x88, 0x02, 0x8B, 0x04, 0xD1, 0x2B, 0x41, 0x26, 0x4F, 0x26, 0x4F,
-  0x0B, 0x00, 0x09, 0x00, 0xAE, 0xD8, 0x00, 0x8C, 0xD0, 0xD8, 0x00, 0x8C,
-  0x94, 0xD8, 0x00, 0x8C, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x80, 0x00, 0x8C,
-  0x26, 0x2F, 0x36, 0x2F, 0x46, 0x2F, 0x56, 0x2F, 0x22, 0x4F, 0x4E, 0xC7,
-  0x1D, 0x01, 0x1C, 0x30, 0x03, 0x70, 0x09, 0x40, 0x08, 0x40, 0x05, 0x64,
-  0x48, 0x24, 0x0A, 0x8B, 0x05, 0x64, 0x48, 0x24, 0xF6, 0x8F, 0x4C, 0x30,
-  0x26, 0x4F, 0xF6, 0x65, 0xF6, 0x64, 0xF6, 0x63, 0xF6, 0x62, 0x0B, 0x00,
-  0x18, 0x00, 0x05, 0x63, 0x40, 0xD1, 0x39, 0x21, 0x18, 0x21, 0x01, 0x89,
-  0x1A, 0x23, 0x00, 0x8B, 0x06, 0x62, 0x3E, 0xD1, 0x39, 0x21, 0x18, 0x21,
-  0x0A, 0x89, 0x1A, 0x23, 0x0C, 0x73, 0x06, 0x61, 0x03, 0x65, 0x1C, 0x30,
-  0x03, 0x03, 0x10, 0x44, 0xFC, 0x8F, 0x04, 0x72, 0xD8, 0xAF, 0x53, 0x60,
-  0x03, 0x03, 0x10, 0x44, 0xFC, 0x8F, 0x04, 0x72, 0xD2, 0x89, 0x00, 0xE1,
-  0x0B, 0x00, 0x12, 0x22, 0x00, 0xE1, 0x0B, 0x00, 0x11, 0x22, 0x00, 0xE1,
-  0x0B, 0x00, 0x10, 0x22, 0x06, 0x61, 0x0B, 0x00, 0x12, 0x22, 0x05, 0x61,
-  0x0B, 0x00, 0x12, 0x22, 0x06, 0x61, 0x0B, 0x00, 0x10, 0x22, 0xFF, 0xE1,
-  0x0B, 0x00, 0x12, 0x22, 0x05, 0x61, 0x0B, 0x00, 0x11, 0x22, 0x06, 0x61,
-  0x0B, 0x00, 0x11, 0x22, 0x09, 0x00, 0x0B, 0x00, 0x22, 0x61, 0x1F, 0xA0,
-  0x09, 0x00, 0x09, 0x00, 0x1A, 0x21, 0x22, 0x4F, 0x36, 0x2F, 0x08, 0xE3,
-  0x12, 0x22, 0x10, 0x43, 0xFC, 0x8F, 0x04, 0x72, 0x29, 0xB0, 0x09, 0x00,
-  0x10, 0x44, 0xF6, 0x8B, 0x01, 0x74, 0xFC, 0x72, 0xF6, 0x63, 0x26, 0x4F,
-  0x0B, 0x00, 0x18, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x22, 0x4F, 0x06, 0x2F, 0x16, 0x2F, 0x26, 0x2F,
-  0x36, 0x2F, 0x46, 0x2F, 0x56, 0x2F, 0x66, 0x2F, 0x0B, 0x42, 0x76, 0x2F,
-  0xF6, 0x67, 0xF6, 0x66, 0xF6, 0x65, 0xF6, 0x64, 0xF6, 0x63, 0xF6, 0x62,
-  0xF6, 0x61, 0xF6, 0x60, 0x26, 0x4F, 0x0B, 0x00, 0x18, 0x00, 0x06, 0x2F,
-  0x16, 0x2F, 0x26, 0x2F, 0x05, 0xD1, 0x06, 0xD2, 0x10, 0x42, 0x02, 0x89,
-  0x12, 0x60, 0x01, 0xC8, 0xFA, 0x8B, 0xF6, 0x62, 0xF6, 0x61, 0x0B, 0x00,
-  0xF6, 0x60, 0x09, 0x00, 0x8C, 0x68, 0x5F, 0xA0, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x80, 0xFF, 0xFF, 0x00, 0x60, 0x00, 0x00, 0x40, 0x80, 0x5F, 0xA0,
-  0x02, 0x00, 0x09, 0x00, 0x02, 0x00, 0x06, 0x00, 0x38, 0x00, 0x00, 0xFF,
-  0x01, 0x00, 0x18, 0x00, 0x2C, 0x00, 0xA0, 0xFF, 0xC0, 0x12, 0x00, 0x00,
-  0x04, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x01, 0x00, 0x18, 0x00,
-  0x24, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1E, 0x00,
-  0x90, 0x74, 0x5F, 0xA0, 0x22, 0x02, 0x22, 0x02, 0x02, 0x00, 0x1E, 0x00,
-  0xA0, 0x74, 0x5F, 0xA0, 0x01, 0x20, 0x01, 0x20, 0x02, 0x00, 0x1E, 0x00,
-  0x90, 0x78, 0x5F, 0xA0, 0x1B, 0x00, 0x71, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0xD0, 0x0F, 0xD1, 0x1B, 0x20, 0x2B, 0x40, 0x09, 0x00, 0x11, 0xD0,
-  0x22, 0x91, 0x12, 0x20, 0x22, 0x4F, 0x11, 0xD0, 0xF2, 0x20, 0x12, 0xDF,
-  0x0B, 0xD0, 0x0C, 0xD2, 0x00, 0xEE, 0x09, 0x00, 0x0B, 0x40, 0x09, 0x00,
-  0x0B, 0x42, 0x09, 0x00, 0x09, 0x00, 0x0C, 0xDF, 0x26, 0x4F, 0x0B, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0xE0, 0x00, 0x8C,
-  0xD0, 0xE0, 0x00, 0x8C, 0x70, 0xE0, 0x00, 0x8C, 0x1C, 0x00, 0x00, 0xFF,
-  0x0B, 0x09, 0x00, 0x00, 0x5C, 0xE0, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0x60, 0x2A, 0x40, 0x0E, 0xD0,
-  0x02, 0x60, 0x0E, 0x40, 0x00, 0xE1, 0x13, 0x62, 0x13, 0x63, 0x13, 0x6B,
-  0x13, 0x6C, 0x13, 0x6D, 0x0B, 0xDF, 0xF2, 0x6F, 0x2E, 0x4F, 0x0C, 0xD0,
-  0x02, 0x60, 0x6A, 0x40, 0x04, 0xD0, 0x02, 0x60, 0x0B, 0x40, 0x03, 0x64,
-  0x09, 0x00, 0x09, 0x00, 0xA4, 0xE0, 0x00, 0x8C, 0x00, 0x00, 0xC0, 0x8C,
-  0xAC, 0xE0, 0x00, 0x8C, 0x00, 0x00, 0x01, 0x8C, 0xB4, 0xE0, 0x00, 0x8C,
-  0xF0, 0x00, 0x00, 0x60, 0xBC, 0xE0, 0x00, 0x8C, 0x00, 0xF4, 0x00, 0x8C,
-  0xC4, 0xE0, 0x00, 0x8C, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0C, 0xD1, 0x1B, 0x20, 0x2B, 0x40,
-  0x09, 0x00, 0x0B, 0xD0, 0x0B, 0xD1, 0x12, 0x61, 0x12, 0x20, 0x00, 0xE3,
-  0x33, 0x64, 0x33, 0x65, 0x33, 0x66, 0x33, 0x67, 0x33, 0x68, 0x33, 0x69,
-  0x33, 0x6A, 0x09, 0x00, 0x0B, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00,
-  0x09, 0x00, 0x09, 0x00, 0xDA, 0xE0, 0x00, 0x8C, 0x00, 0x00, 0x00, 0xA0,
-  0x1C, 0x00, 0x00, 0xFF, 0x10, 0xE1, 0x00, 0x8C, 0x08, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/* lienus (../rsrc/templates/ip.tmpl) */
+static const unsigned char ip_template_data_0[8429] = {
+  0x78, 0xda, 0xed, 0x7c, 0x6b, 0x78, 0x5b, 0xd5, 0x95, 0xe8, 0x3e, 0x4f,
+  0x49, 0x96, 0x6c, 0x3d, 0x9c, 0x87, 0xe3, 0xb8, 0x39, 0xd2, 0x91, 0xed,
+  0x38, 0xb1, 0x89, 0x2c, 0x29, 0x21, 0x4e, 0x30, 0x58, 0xb6, 0x63, 0x48,
+  0x4a, 0x12, 0xcb, 0x92, 0xa1, 0xb4, 0x1f, 0x33, 0xc8, 0x92, 0x13, 0x60,
+  0x2e, 0x05, 0x27, 0x0e, 0xa5, 0xfd, 0xee, 0x5c, 0xac, 0xf8, 0x91, 0x48,
+  0x48, 0x79, 0xd9, 0x49, 0x08, 0x10, 0x8a, 0xcb, 0x9b, 0x36, 0x40, 0x68,
+  0xe9, 0x40, 0x29, 0x99, 0xa6, 0x33, 0x73, 0x07, 0xb8, 0x99, 0x4b, 0x2d,
+  0x19, 0x52, 0xee, 0x7c, 0x73, 0x27, 0x72, 0x0c, 0x84, 0xdb, 0xaf, 0xd0,
+  0x48, 0x72, 0x1c, 0x27, 0x31, 0x39, 0x77, 0xed, 0x7d, 0xce, 0x91, 0x1d,
+  0x08, 0xf0, 0xcd, 0xfd, 0xd3, 0xde, 0x6f, 0xb4, 0x9c, 0x7d, 0xf6, 0xd6,
+  0xda, 0x6b, 0xad, 0xbd, 0xf6, 0xda, 0x7b, 0xaf, 0xb5, 0xf6, 0x71, 0x64,
+  0x84, 0xf2, 0x90, 0x87, 0xff, 0xbc, 0xa0, 0x19, 0xd1, 0x26, 0xe6, 0x9b,
+  0xb8, 0x53, 0xb8, 0x5e, 0xda, 0x58, 0xed, 0xd1, 0x21, 0x7f, 0x73, 0x73,
+  0x5d, 0x6d, 0x9d, 0xdb, 0xa9, 0x43, 0xc8, 0x84, 0x1e, 0x04, 0x12, 0xa9,
+  0x1a, 0x9a, 0xcf, 0xf7, 0xa1, 0x38, 0x7a, 0x0d, 0x1d, 0x29, 0x48, 0xe8,
+  0x93, 0x86, 0x51, 0xfd, 0xef, 0xed, 0x9b, 0xb4, 0x2d, 0x35, 0x2b, 0x4a,
+  0x5a, 0x50, 0x0b, 0x9b, 0xb8, 0xdd, 0x59, 0xef, 0xbc, 0x31, 0xc0, 0xdb,
+  0x4c, 0x37, 0x5d, 0x8a, 0xe9, 0x91, 0x8e, 0xc8, 0xd5, 0xc1, 0x4f, 0x98,
+  0x46, 0x28, 0x45, 0xc1, 0x87, 0xa3, 0x2c, 0x3c, 0xac, 0xcf, 0xdc, 0xbe,
+  0x5c, 0xd7, 0x72, 0x5b, 0x05, 0x1d, 0x35, 0xb5, 0x7c, 0xbe, 0x67, 0x73,
+  0x39, 0xa6, 0x94, 0x24, 0x7e, 0xd4, 0x35, 0x60, 0x1c, 0xd4, 0x89, 0xdc,
+  0x7b, 0x4d, 0x81, 0x82, 0x7d, 0x3a, 0x5b, 0xb5, 0xcd, 0x52, 0x6e, 0x0f,
+  0xe8, 0x09, 0x7f, 0x0d, 0x0a, 0x4b, 0xa8, 0xa6, 0x6b, 0x58, 0x9a, 0x46,
+  0x8c, 0xd8, 0xaa, 0x3b, 0x0a, 0x92, 0x4f, 0xf3, 0xa3, 0xa2, 0x9d, 0x4f,
+  0xe8, 0x1b, 0x75, 0xa8, 0xb2, 0x15, 0x53, 0x4d, 0xf5, 0xb0, 0x23, 0x74,
+  0x87, 0x59, 0x30, 0x0c, 0xeb, 0xd0, 0xe1, 0xeb, 0x3f, 0x8d, 0x4f, 0x81,
+  0x9e, 0x75, 0x8f, 0xa3, 0x78, 0xda, 0x87, 0xc6, 0x6b, 0xc5, 0xb4, 0x8f,
+  0xda, 0x6a, 0x13, 0x98, 0xa4, 0x18, 0x4a, 0xb7, 0xb9, 0x9c, 0x13, 0x31,
+  0x6d, 0x0f, 0xe6, 0xa9, 0x87, 0x7e, 0xb1, 0xf5, 0x83, 0x9e, 0xb9, 0xa3,
+  0xfa, 0x66, 0x1d, 0xa2, 0x91, 0xce, 0xa3, 0xf3, 0x18, 0xdf, 0xa1, 0x1d,
+  0x34, 0xb2, 0x0e, 0xad, 0xb2, 0x9e, 0x3d, 0x51, 0xe4, 0x31, 0x25, 0xf5,
+  0x4d, 0xa0, 0x81, 0x90, 0x09, 0x18, 0xdf, 0xd1, 0x7a, 0xb4, 0x1e, 0x9a,
+  0x29, 0x1e, 0x5c, 0x62, 0xbf, 0xce, 0x5a, 0xe4, 0xb9, 0xe0, 0x65, 0x23,
+  0x4c, 0x4c, 0x77, 0xba, 0x4a, 0x30, 0xc3, 0x88, 0x17, 0xbc, 0x54, 0x84,
+  0x8e, 0x5e, 0xf0, 0x32, 0x11, 0x6d, 0x4c, 0x0b, 0x38, 0x0d, 0xe0, 0x8c,
+  0xd2, 0x1f, 0x41, 0xfe, 0x6d, 0x87, 0x50, 0x9c, 0x1f, 0x2b, 0x11, 0x66,
+  0x4b, 0x77, 0x29, 0xd2, 0xa7, 0xda, 0x4b, 0xc8, 0xc8, 0x39, 0xe9, 0x74,
+  0xc5, 0xd0, 0x2a, 0xb1, 0xda, 0x8a, 0x7b, 0x2c, 0xa4, 0x87, 0xfa, 0xd0,
+  0x4c, 0x34, 0x30, 0x93, 0x4f, 0x1a, 0x01, 0x8d, 0x3b, 0x05, 0x74, 0xda,
+  0x2e, 0x14, 0x92, 0xcf, 0xbc, 0x30, 0x79, 0xcb, 0xf9, 0x76, 0x3d, 0x69,
+  0x73, 0xc2, 0xb9, 0x76, 0x1d, 0x69, 0xb1, 0x40, 0xe5, 0x22, 0x5a, 0x19,
+  0x25, 0x49, 0xda, 0xb6, 0x17, 0xc5, 0xeb, 0x07, 0x50, 0x3c, 0x0e, 0xb5,
+  0xe5, 0xc7, 0x28, 0x5e, 0x06, 0xa5, 0x1c, 0x4a, 0xa6, 0x8d, 0xda, 0x62,
+  0x11, 0x16, 0x0e, 0x65, 0x7c, 0x6e, 0xd7, 0x54, 0x2c, 0xed, 0xa7, 0xba,
+  0x9d, 0xc2, 0xdc, 0xc1, 0x74, 0x9b, 0xdd, 0x49, 0xc5, 0xa8, 0x71, 0xb7,
+  0xa0, 0x4d, 0x4e, 0xb4, 0x89, 0x4e, 0x3a, 0x9a, 0xf5, 0xd7, 0xd9, 0xdf,
+  0x8a, 0xf2, 0x60, 0x39, 0xf4, 0x21, 0x96, 0x5e, 0xd5, 0x23, 0xdb, 0xdb,
+  0xb4, 0x78, 0xd8, 0x18, 0xee, 0x5f, 0x84, 0x52, 0x08, 0x1d, 0x11, 0x5b,
+  0xa7, 0x7a, 0x1a, 0x85, 0x85, 0xef, 0xa7, 0xdb, 0x17, 0x12, 0x0d, 0x8e,
+  0xbe, 0x02, 0xd6, 0x74, 0x3c, 0x00, 0xcf, 0x92, 0x93, 0xc1, 0xcd, 0xb6,
+  0x03, 0xb6, 0xfd, 0x2b, 0x60, 0xcd, 0xe6, 0x41, 0xfb, 0x5b, 0x07, 0x16,
+  0xee, 0x77, 0x40, 0x7b, 0x0e, 0xb4, 0x4b, 0x0e, 0xcc, 0xdd, 0xbf, 0x04,
+  0xda, 0x73, 0x1f, 0x9e, 0x7b, 0x70, 0x2e, 0xb4, 0x4d, 0xb2, 0x2d, 0x3a,
+  0x7f, 0x07, 0x7c, 0x2b, 0xa0, 0xc8, 0x73, 0xd4, 0x2a, 0xe3, 0x1d, 0x43,
+  0xed, 0xd4, 0xfb, 0xe8, 0x53, 0xc4, 0x52, 0x06, 0xe6, 0x0d, 0xd4, 0x46,
+  0x1d, 0x3f, 0x7e, 0x1c, 0x0d, 0x3f, 0x84, 0xe2, 0x87, 0xc0, 0xc6, 0x87,
+  0xa1, 0x0c, 0x43, 0xb9, 0x2b, 0x86, 0xe2, 0xeb, 0x63, 0x78, 0x4d, 0xff,
+  0xd8, 0x93, 0x0d, 0x59, 0xba, 0x1b, 0xed, 0xd9, 0xa0, 0x69, 0x6b, 0x9b,
+  0x18, 0x12, 0xb2, 0xed, 0xb2, 0x05, 0x69, 0xe1, 0xc2, 0x40, 0x7a, 0xfb,
+  0xd4, 0x00, 0xe5, 0xc0, 0x96, 0xac, 0x00, 0x1b, 0x65, 0xdb, 0xd2, 0xde,
+  0x32, 0x54, 0x14, 0x58, 0x1f, 0x29, 0x8e, 0xa5, 0xbd, 0x54, 0x17, 0x6e,
+  0xb7, 0x47, 0x0a, 0x63, 0xc2, 0xc7, 0xd9, 0x4d, 0xd9, 0x4e, 0x7a, 0xdb,
+  0x42, 0xd0, 0x30, 0xed, 0xa7, 0xc1, 0x3a, 0x45, 0xc3, 0x78, 0x9f, 0x06,
+  0x0e, 0xa3, 0x38, 0xe1, 0xe1, 0xe5, 0x7e, 0x3d, 0xee, 0x27, 0xbb, 0x2b,
+  0xe3, 0x4f, 0xb7, 0xb9, 0x9d, 0x27, 0x63, 0x73, 0x14, 0x8d, 0xc5, 0xd6,
+  0xb7, 0x7b, 0x36, 0x08, 0xb7, 0x0b, 0xd9, 0xa0, 0x63, 0x6b, 0x40, 0xcc,
+  0x76, 0xb0, 0x5b, 0x74, 0x49, 0x6d, 0x4a, 0x5e, 0x23, 0x47, 0x6a, 0x1a,
+  0x59, 0x23, 0x54, 0xb4, 0x10, 0x64, 0x7e, 0xee, 0x77, 0x76, 0x70, 0x5b,
+  0xcc, 0xf6, 0x3a, 0x85, 0x4f, 0x92, 0x3c, 0x30, 0x97, 0xe7, 0x1f, 0x43,
+  0xf1, 0x86, 0x94, 0x4e, 0xa8, 0x48, 0x94, 0x08, 0x15, 0xa3, 0x2e, 0x07,
+  0x1a, 0x2b, 0x15, 0xe6, 0x02, 0x75, 0x26, 0x68, 0x0d, 0xd5, 0x87, 0x80,
+  0x9f, 0xb6, 0xba, 0xa9, 0x98, 0x09, 0x63, 0x42, 0xae, 0x7e, 0x43, 0x60,
+  0xca, 0x67, 0x70, 0x55, 0x09, 0x99, 0x0e, 0x66, 0x8b, 0xc5, 0x71, 0x11,
+  0x56, 0x73, 0xb5, 0x70, 0xc1, 0x77, 0x11, 0x56, 0xf3, 0xe3, 0x18, 0xc2,
+  0xb3, 0x0c, 0x99, 0xba, 0xdd, 0xc2, 0x94, 0x4f, 0xb4, 0x67, 0xfd, 0x99,
+  0xa0, 0x0d, 0xe8, 0x5d, 0xdb, 0xb3, 0xfe, 0x39, 0x29, 0x37, 0x3c, 0xb3,
+  0x41, 0x76, 0xab, 0x58, 0x9c, 0xf5, 0xb3, 0xa9, 0xfa, 0x70, 0x76, 0xb3,
+  0xe9, 0x07, 0xd3, 0xb7, 0xb4, 0x6d, 0xfa, 0xbc, 0xbd, 0xb1, 0x53, 0xd6,
+  0xf4, 0x73, 0x5f, 0x26, 0xe4, 0x04, 0x7a, 0xba, 0xcb, 0xd6, 0x61, 0x70,
+  0x9a, 0x45, 0x55, 0xcb, 0x7b, 0x5f, 0x45, 0x47, 0x9e, 0x06, 0x3d, 0xe3,
+  0x51, 0x6c, 0xef, 0x4f, 0x7a, 0x5a, 0x60, 0xff, 0x95, 0xe6, 0xf6, 0x9f,
+  0xd3, 0x81, 0x77, 0x69, 0x23, 0x8c, 0x3c, 0x2f, 0x61, 0x16, 0xd2, 0x5e,
+  0x14, 0x30, 0x04, 0xac, 0x11, 0x4d, 0x2c, 0x1d, 0x64, 0xb6, 0xda, 0x1c,
+  0x59, 0xd0, 0xcf, 0x2d, 0x38, 0xa0, 0xf7, 0x9c, 0x2f, 0xeb, 0xad, 0x21,
+  0xd6, 0x37, 0xc4, 0xb2, 0x60, 0xfd, 0x1a, 0x62, 0x7d, 0x3e, 0x26, 0xa4,
+  0xb2, 0xe1, 0x2c, 0x58, 0xdd, 0x4d, 0x4e, 0xd2, 0xb9, 0xb6, 0x2c, 0xac,
+  0x11, 0xc6, 0x60, 0x3e, 0x6d, 0x6e, 0x1d, 0xf0, 0xf8, 0xe9, 0x36, 0x66,
+  0x0b, 0x8c, 0xe0, 0xaf, 0x0d, 0x66, 0xfb, 0x91, 0xeb, 0x7c, 0x2c, 0xed,
+  0xc3, 0xb3, 0x4b, 0x87, 0x0c, 0x6e, 0xa7, 0x23, 0x1d, 0xa4, 0x61, 0xb4,
+  0x09, 0x7f, 0x16, 0xd6, 0xe5, 0x8d, 0x58, 0x3a, 0x74, 0xb9, 0xdb, 0xe9,
+  0x70, 0x07, 0x60, 0x57, 0x2a, 0x73, 0x28, 0xc9, 0xad, 0xd4, 0x87, 0x3d,
+  0x85, 0x49, 0x7c, 0xaa, 0x96, 0x0b, 0x96, 0x41, 0x9b, 0xc3, 0xbc, 0x37,
+  0xbd, 0x1d, 0xa5, 0x26, 0xc2, 0x28, 0x75, 0x2e, 0xfc, 0xbd, 0x33, 0xfa,
+  0x83, 0x78, 0xa5, 0xb5, 0xdb, 0x34, 0x64, 0x76, 0x65, 0x0a, 0x4f, 0x0d,
+  0xb5, 0x94, 0xf2, 0x50, 0x92, 0x84, 0x6e, 0xf8, 0x34, 0x6e, 0x7d, 0x1d,
+  0xc5, 0xb7, 0xed, 0xc2, 0x76, 0xf8, 0x10, 0x7c, 0x89, 0x5b, 0x98, 0x9b,
+  0x2c, 0x17, 0x16, 0x81, 0x0d, 0x6c, 0x20, 0x87, 0xce, 0xc9, 0x59, 0xa8,
+  0xc8, 0x31, 0x12, 0x39, 0x7a, 0x65, 0xbc, 0x8b, 0x03, 0x45, 0x5d, 0x94,
+  0xc3, 0x00, 0x94, 0x45, 0x67, 0x4a, 0x3e, 0x96, 0x29, 0xf8, 0x2b, 0x46,
+  0x7a, 0x06, 0xa9, 0xe3, 0x3c, 0xfc, 0x14, 0x3a, 0x82, 0xc7, 0xb9, 0xe7,
+  0x49, 0x7c, 0xe6, 0x3e, 0xe9, 0x41, 0xe3, 0x2b, 0x84, 0x05, 0xef, 0x63,
+  0x8e, 0x05, 0x84, 0x03, 0x9d, 0xb6, 0x91, 0x73, 0x9f, 0x86, 0xb3, 0x9d,
+  0x0d, 0x69, 0xbb, 0xeb, 0x9d, 0xa6, 0x60, 0xda, 0x5b, 0x4f, 0x2d, 0xea,
+  0x10, 0xc4, 0x52, 0xfa, 0x9c, 0xb7, 0xa6, 0x96, 0x13, 0xd2, 0x3e, 0xb0,
+  0x89, 0x60, 0x18, 0xc7, 0x7b, 0xf5, 0x0f, 0x31, 0x03, 0x9c, 0x6b, 0x97,
+  0xc3, 0x38, 0x94, 0xe9, 0x58, 0x65, 0xb3, 0x38, 0xce, 0xf9, 0xe6, 0xd3,
+  0xa5, 0x74, 0x85, 0x70, 0xce, 0xfb, 0x45, 0x0b, 0x35, 0x48, 0x6b, 0xc1,
+  0xd6, 0xeb, 0xc1, 0xe6, 0x23, 0xe1, 0x3b, 0x86, 0xff, 0xd8, 0xb3, 0x46,
+  0x28, 0x4e, 0x4e, 0xf8, 0xad, 0x6e, 0x6b, 0xd4, 0x92, 0xb0, 0x84, 0x9c,
+  0x82, 0x65, 0x84, 0x06, 0x39, 0x28, 0x35, 0xb9, 0xbd, 0x18, 0xc6, 0x9f,
+  0xe8, 0x97, 0xc2, 0x67, 0x03, 0x97, 0xc3, 0x69, 0x7f, 0x49, 0xf3, 0x65,
+  0x58, 0x0d, 0x58, 0x0b, 0x21, 0x13, 0x2c, 0x69, 0x92, 0x70, 0xdb, 0x25,
+  0x3a, 0x26, 0x07, 0xa8, 0xae, 0xc9, 0xed, 0x93, 0x03, 0xfc, 0xb8, 0xbb,
+  0xf6, 0x13, 0x38, 0x2f, 0x78, 0x84, 0xbb, 0x5e, 0xbb, 0x13, 0xb5, 0x63,
+  0x7f, 0xa9, 0xf8, 0xe4, 0x6c, 0xa8, 0x92, 0x9c, 0xdf, 0x72, 0x38, 0xbf,
+  0x77, 0x81, 0xcf, 0x13, 0x1d, 0x53, 0x5e, 0x03, 0xf0, 0x53, 0x6f, 0x73,
+  0x51, 0x26, 0x75, 0x3e, 0x4c, 0x83, 0x8f, 0x62, 0x61, 0x2c, 0x0a, 0xda,
+  0xd8, 0x5f, 0xc9, 0xbd, 0xec, 0xdb, 0x54, 0x94, 0xc2, 0xb4, 0x7e, 0x57,
+  0xb0, 0x92, 0xf8, 0xc1, 0x0d, 0x40, 0x33, 0x09, 0xf6, 0x98, 0x27, 0x48,
+  0x5b, 0x4c, 0x21, 0x21, 0xb5, 0xdc, 0x98, 0xf5, 0x6b, 0x4f, 0xd7, 0xb9,
+  0x2a, 0x84, 0xeb, 0xa1, 0x47, 0x48, 0x4d, 0x33, 0xf5, 0xa1, 0x73, 0xbe,
+  0xea, 0xe0, 0x35, 0xcd, 0xe7, 0x81, 0x5f, 0x67, 0x5f, 0x0e, 0xbe, 0x9e,
+  0x8a, 0x50, 0xb1, 0x3a, 0xfb, 0xc2, 0xe8, 0x94, 0x77, 0xe2, 0x56, 0xed,
+  0x8d, 0xb4, 0xf7, 0x5e, 0x7e, 0xca, 0x4b, 0x0f, 0x64, 0xda, 0x64, 0xef,
+  0x86, 0x75, 0xb2, 0x6d, 0x32, 0xac, 0x90, 0x71, 0xf3, 0x15, 0x5c, 0xe5,
+  0x56, 0x5b, 0xa7, 0x61, 0xb9, 0x1c, 0x49, 0x32, 0xe0, 0x0f, 0x44, 0x01,
+  0x74, 0x18, 0x60, 0x42, 0x53, 0x6d, 0xc5, 0x03, 0x46, 0x7b, 0x29, 0x62,
+  0x5c, 0x54, 0x0c, 0xef, 0xe5, 0xac, 0xff, 0x9c, 0x0f, 0x8f, 0x7e, 0xae,
+  0xcd, 0xdc, 0xf8, 0x9b, 0x28, 0x9c, 0xc8, 0x01, 0x26, 0x38, 0xe5, 0x77,
+  0x0f, 0x18, 0xc5, 0x52, 0x94, 0xf1, 0x33, 0xee, 0xe7, 0x63, 0x55, 0x39,
+  0x3f, 0xf0, 0x2f, 0x10, 0x3b, 0xaa, 0x1e, 0x05, 0x9b, 0x3f, 0x84, 0x6d,
+  0x82, 0x7d, 0xac, 0xcf, 0x91, 0xd9, 0xcc, 0xbf, 0xcf, 0xbf, 0xa7, 0xb9,
+  0xc2, 0x37, 0xaa, 0x35, 0x3a, 0x6e, 0x41, 0xc8, 0xf3, 0x69, 0xfc, 0x1e,
+  0x88, 0x7d, 0x67, 0x7b, 0x9a, 0x05, 0x9f, 0xd0, 0x21, 0x14, 0x26, 0x45,
+  0x47, 0xc6, 0x3f, 0x67, 0x5f, 0x9d, 0xb3, 0x38, 0xa8, 0x6d, 0xac, 0x71,
+  0x6a, 0x1b, 0xf1, 0x0f, 0x6a, 0xcc, 0x7a, 0xb5, 0xce, 0x82, 0x41, 0xfc,
+  0x39, 0x13, 0x2a, 0x73, 0xbb, 0x1c, 0xe9, 0x36, 0x8b, 0xdd, 0x44, 0x56,
+  0xe2, 0x14, 0xd5, 0x43, 0xc3, 0x7e, 0x03, 0x39, 0x13, 0x3d, 0x4d, 0x42,
+  0x9b, 0xa0, 0x07, 0xef, 0x93, 0xf6, 0xd9, 0x43, 0xda, 0xa6, 0x7a, 0x97,
+  0xb6, 0x09, 0xff, 0xa0, 0xa6, 0x4c, 0x5b, 0x19, 0xb4, 0x33, 0xa1, 0x1a,
+  0xe0, 0x74, 0x05, 0x0c, 0x84, 0x4f, 0x7e, 0x62, 0x3e, 0xac, 0x6b, 0x69,
+  0xd2, 0x86, 0xed, 0xef, 0x48, 0xb7, 0x2f, 0xb8, 0x42, 0xd7, 0x1d, 0x0e,
+  0xb1, 0xf5, 0x2c, 0xac, 0x6e, 0x11, 0x59, 0x5d, 0x03, 0xac, 0x6e, 0x36,
+  0x54, 0xd0, 0xdd, 0x01, 0x6d, 0xed, 0xd6, 0x2d, 0x62, 0xe1, 0xa8, 0x93,
+  0xac, 0xf5, 0xe4, 0x80, 0x79, 0x48, 0xeb, 0x76, 0x07, 0xb5, 0xcd, 0x35,
+  0x6e, 0x6d, 0x33, 0xfe, 0x41, 0xcd, 0xe7, 0x07, 0xb4, 0x6e, 0xcd, 0x20,
+  0xfe, 0x9c, 0x6e, 0xab, 0x77, 0x9a, 0x89, 0xff, 0x98, 0xd1, 0xb5, 0xb6,
+  0x0f, 0xc7, 0x7a, 0x16, 0xf6, 0xf6, 0xf4, 0x56, 0xfb, 0x5d, 0xe9, 0x76,
+  0x0f, 0xf8, 0x65, 0xba, 0xea, 0x1c, 0xac, 0x00, 0xe6, 0xc3, 0xa7, 0x9e,
+  0xea, 0xca, 0x74, 0xc8, 0xba, 0x30, 0x41, 0x15, 0x5f, 0xeb, 0xd2, 0xc5,
+  0xce, 0x43, 0xfb, 0x1c, 0xb4, 0xad, 0xb3, 0x64, 0x67, 0x42, 0x54, 0xb7,
+  0xcb, 0x31, 0x31, 0x30, 0xff, 0x4b, 0x5a, 0x60, 0x4a, 0x3d, 0xa1, 0xd4,
+  0x24, 0xca, 0xdc, 0x69, 0xaf, 0xab, 0xf6, 0x1f, 0x63, 0x26, 0x98, 0xdb,
+  0xe4, 0x5d, 0x78, 0x76, 0x3d, 0xf4, 0x29, 0x38, 0xab, 0x78, 0xcd, 0x64,
+  0x3b, 0xe0, 0x93, 0x92, 0xbd, 0xb3, 0xe8, 0x81, 0xec, 0xe6, 0xc2, 0x1f,
+  0x64, 0x37, 0x19, 0xee, 0x9f, 0x68, 0x6f, 0xea, 0xbc, 0x0f, 0x34, 0xcb,
+  0xde, 0x59, 0x00, 0x38, 0x1d, 0xe0, 0xb4, 0xf7, 0x4f, 0xf8, 0x6c, 0xed,
+  0x9b, 0x08, 0x8e, 0x07, 0x1c, 0x07, 0x38, 0x16, 0x70, 0x6d, 0x7b, 0x97,
+  0xb1, 0xdf, 0x23, 0x58, 0x1a, 0xb0, 0x14, 0x60, 0x27, 0x7c, 0x6b, 0x01,
+  0xe7, 0x05, 0xdc, 0x34, 0xec, 0x54, 0x26, 0x84, 0x3c, 0xf5, 0xb5, 0x4c,
+  0xc7, 0x14, 0x3e, 0x53, 0xce, 0x09, 0xf2, 0x3c, 0x0b, 0x91, 0xa1, 0xde,
+  0xc9, 0xa7, 0xe4, 0x7d, 0x5a, 0xe5, 0x61, 0x82, 0x9f, 0xcf, 0xa2, 0xbc,
+  0x40, 0x68, 0xce, 0x91, 0x67, 0x9a, 0x3c, 0xf9, 0x94, 0x1c, 0x15, 0x4b,
+  0x3c, 0xd5, 0x56, 0x26, 0x78, 0x79, 0x16, 0xed, 0x45, 0xd2, 0x3f, 0x49,
+  0x9e, 0x19, 0x85, 0x56, 0xf6, 0x4a, 0xd5, 0x56, 0x6e, 0x74, 0x95, 0x55,
+  0x8d, 0x71, 0xa8, 0x80, 0x2d, 0x90, 0xf7, 0x29, 0xa4, 0x1a, 0x48, 0xc5,
+  0xaa, 0x7b, 0x6f, 0xab, 0x23, 0xe3, 0xcb, 0xfa, 0x97, 0x34, 0xe3, 0xfc,
+  0x2b, 0xeb, 0x5f, 0x00, 0x75, 0x26, 0x98, 0xf5, 0xd7, 0x8a, 0xf2, 0x3e,
+  0x93, 0x24, 0xb1, 0x75, 0xa4, 0xe7, 0x66, 0xe1, 0x7b, 0x02, 0x3e, 0xeb,
+  0x1d, 0xe4, 0xac, 0x6f, 0x11, 0x2f, 0xf9, 0x5d, 0xbe, 0x2a, 0x38, 0xcd,
+  0x38, 0x62, 0x6c, 0x88, 0xb0, 0xb1, 0x29, 0xe2, 0xcf, 0x7d, 0x11, 0x26,
+  0x5a, 0xab, 0x48, 0x9f, 0x02, 0x0f, 0x56, 0x25, 0xd8, 0x3b, 0xed, 0xaf,
+  0xe0, 0x0c, 0xe8, 0x92, 0x7f, 0x12, 0xa2, 0xda, 0x94, 0x5f, 0xdb, 0x5d,
+  0x27, 0xb8, 0x3b, 0x17, 0xe4, 0x70, 0xae, 0xb6, 0x1a, 0xe7, 0x5c, 0x38,
+  0x83, 0x2c, 0xc1, 0x17, 0x2a, 0xf8, 0xe9, 0x81, 0x6b, 0xb7, 0xab, 0x38,
+  0x26, 0x87, 0x5b, 0x99, 0xc3, 0x5d, 0x38, 0xaa, 0xe2, 0xea, 0x72, 0xb8,
+  0x3f, 0xe5, 0x70, 0xab, 0x14, 0x1c, 0x3a, 0x5d, 0x2e, 0xe0, 0xc8, 0x3b,
+  0xd5, 0x3e, 0x26, 0xf7, 0x79, 0x27, 0xfc, 0xda, 0x66, 0xca, 0x3b, 0xe9,
+  0xab, 0x64, 0x64, 0x8a, 0x09, 0xf0, 0x00, 0xe5, 0xc0, 0xb3, 0x6a, 0x60,
+  0xc2, 0x4f, 0xbb, 0xff, 0x10, 0x3b, 0xe7, 0xd5, 0x0a, 0x28, 0x05, 0x51,
+  0x85, 0x44, 0xc6, 0x72, 0xe1, 0x3e, 0xec, 0x09, 0x36, 0x0b, 0x64, 0xad,
+  0xa7, 0xda, 0x7f, 0x88, 0xf7, 0x2a, 0xe8, 0x6a, 0x70, 0xd7, 0x09, 0x17,
+  0xbd, 0x2c, 0x8e, 0xb6, 0x11, 0x01, 0x62, 0xe0, 0x34, 0x7d, 0xd1, 0xbf,
+  0x02, 0xa2, 0xda, 0x02, 0xc8, 0xcf, 0x26, 0x7c, 0xf5, 0xae, 0x72, 0x21,
+  0x3d, 0xc0, 0x74, 0xd4, 0x3b, 0x2f, 0x79, 0xf9, 0x81, 0x02, 0xb2, 0x1a,
+  0xe9, 0xa0, 0xc1, 0x65, 0x73, 0xa4, 0x07, 0xd2, 0x6d, 0x06, 0x82, 0x95,
+  0xd7, 0x28, 0xbd, 0xbd, 0x61, 0x18, 0x47, 0x03, 0xbb, 0xb0, 0x92, 0xc4,
+  0xca, 0xf0, 0x23, 0xe0, 0x0f, 0x60, 0x4f, 0xa6, 0x07, 0xb2, 0x1d, 0x95,
+  0x5b, 0xcc, 0x21, 0x77, 0xed, 0xfc, 0x68, 0x3a, 0x58, 0x9e, 0xfa, 0x9c,
+  0x71, 0xbb, 0x2c, 0xd1, 0x4b, 0xde, 0x6c, 0x87, 0xb0, 0xc5, 0xb4, 0xf9,
+  0x9e, 0xcd, 0xda, 0x1b, 0x29, 0xf0, 0x75, 0x17, 0x6f, 0x69, 0x1b, 0x48,
+  0x83, 0x7f, 0xbb, 0x08, 0x39, 0x40, 0x7a, 0xc0, 0xb0, 0x7c, 0x0e, 0x91,
+  0x29, 0xcf, 0x28, 0x0d, 0x9e, 0x3b, 0xbd, 0xdd, 0x18, 0x60, 0x82, 0x97,
+  0xfc, 0xd7, 0x0e, 0x30, 0x2e, 0x36, 0x86, 0x67, 0x95, 0x86, 0xd3, 0xe2,
+  0x74, 0x64, 0x81, 0xc2, 0x0e, 0x91, 0x38, 0x0b, 0x19, 0xf6, 0x3b, 0x31,
+  0xd2, 0x1f, 0xba, 0xe4, 0x5b, 0x4c, 0xbc, 0x1f, 0xb6, 0xc2, 0x8e, 0x98,
+  0xba, 0x82, 0xd8, 0x9f, 0xa9, 0x7b, 0x24, 0xe3, 0x05, 0x2f, 0x61, 0xc5,
+  0x3e, 0x3b, 0x4b, 0xd6, 0x3c, 0xfc, 0xb6, 0x36, 0x06, 0xfe, 0x73, 0xdc,
+  0x45, 0xf6, 0x4c, 0x6d, 0x87, 0x49, 0x5c, 0x04, 0x73, 0xc0, 0x51, 0x25,
+  0xe3, 0xd7, 0x9c, 0x76, 0x75, 0x5c, 0xd3, 0x68, 0xb1, 0x67, 0xfc, 0x38,
+  0x57, 0x60, 0x04, 0xa9, 0x0b, 0x73, 0xf4, 0xbc, 0xe3, 0xea, 0xd0, 0xdb,
+  0x00, 0x4b, 0xce, 0xac, 0x2a, 0xe5, 0x4c, 0x4c, 0xe5, 0xcf, 0x04, 0xe4,
+  0xfd, 0x26, 0x3f, 0xa7, 0x7b, 0x9a, 0x1c, 0x99, 0x00, 0x0a, 0xb0, 0xe4,
+  0x93, 0xfc, 0xc4, 0x1e, 0xa9, 0x19, 0xfb, 0x1d, 0x92, 0x5f, 0x5b, 0x70,
+  0x04, 0xf5, 0x67, 0xdb, 0xeb, 0x97, 0x7f, 0xf2, 0x1b, 0x58, 0xa5, 0x70,
+  0x11, 0xc8, 0x4b, 0xfb, 0xf1, 0xd9, 0xbf, 0xde, 0x93, 0x81, 0x35, 0x72,
+  0x09, 0x72, 0xbe, 0xc7, 0x8e, 0xe3, 0xbb, 0xc4, 0xff, 0x89, 0x65, 0xbc,
+  0x26, 0x35, 0x27, 0x56, 0x6a, 0xd9, 0x6f, 0x06, 0x61, 0xf7, 0x6b, 0x9b,
+  0xd2, 0x7e, 0x77, 0x87, 0xb6, 0xb9, 0xcc, 0x5d, 0x02, 0xfc, 0xe0, 0x3f,
+  0x47, 0xeb, 0x5d, 0x99, 0x0e, 0x8b, 0x68, 0x50, 0xc6, 0x25, 0xda, 0x74,
+  0x7e, 0xf0, 0x0b, 0xac, 0x89, 0x72, 0xa2, 0xe0, 0x7e, 0x84, 0xb1, 0xda,
+  0xd3, 0x73, 0xe1, 0x86, 0x83, 0x73, 0xb7, 0xe2, 0x51, 0x57, 0x40, 0xfb,
+  0xf6, 0xa5, 0x28, 0x8e, 0x4b, 0x85, 0x31, 0xd3, 0xa8, 0x2b, 0x68, 0x82,
+  0x9b, 0xce, 0x9a, 0xd4, 0x3c, 0x1a, 0x7c, 0x7b, 0xa8, 0x08, 0xda, 0x96,
+  0xbd, 0xf3, 0x18, 0x9c, 0x49, 0xea, 0xa0, 0xaf, 0x20, 0x61, 0x09, 0x68,
+  0x4f, 0xe8, 0x86, 0x6a, 0xdc, 0xb4, 0x9d, 0x83, 0xcf, 0x68, 0x0c, 0x53,
+  0xca, 0xf3, 0xfc, 0x04, 0xf6, 0x02, 0xba, 0xfb, 0x8e, 0xe1, 0x4f, 0x20,
+  0xc6, 0x96, 0xc3, 0x1d, 0xa9, 0xe4, 0xfa, 0x4f, 0x95, 0xdc, 0x4d, 0x04,
+  0x4a, 0xb1, 0x63, 0x8e, 0x80, 0xe9, 0x2d, 0x16, 0x21, 0x69, 0x85, 0x39,
+  0x57, 0x79, 0xb4, 0x27, 0x16, 0x25, 0x68, 0x9b, 0x61, 0xfc, 0x5b, 0x23,
+  0x2e, 0xeb, 0x39, 0xaf, 0x0e, 0xf2, 0xb2, 0x85, 0xa3, 0x0b, 0x93, 0xae,
+  0x40, 0xb5, 0x95, 0x26, 0x9a, 0xcd, 0x19, 0x75, 0x75, 0x94, 0x24, 0x3d,
+  0xa9, 0x4a, 0x0a, 0x7d, 0xf8, 0x34, 0xd8, 0xaa, 0x74, 0xd0, 0x2e, 0x18,
+  0x21, 0x1f, 0xc8, 0xfa, 0x6a, 0x8a, 0x2d, 0xa1, 0xe2, 0x64, 0xf1, 0xde,
+  0x4a, 0xc6, 0x12, 0x32, 0x27, 0x4d, 0xa4, 0x36, 0x25, 0x0b, 0xa1, 0x36,
+  0x0c, 0x59, 0x82, 0xf5, 0x2e, 0x1b, 0xe4, 0x3e, 0x90, 0x2f, 0x80, 0xc5,
+  0x71, 0x0e, 0x4e, 0x51, 0x47, 0xd1, 0xab, 0xe8, 0x75, 0x84, 0xc0, 0x97,
+  0x63, 0xdd, 0x6a, 0xe0, 0x4e, 0x81, 0x75, 0xc3, 0x3a, 0x22, 0x14, 0x46,
+  0x38, 0xd7, 0xef, 0xe9, 0xe9, 0x41, 0x1a, 0x09, 0xa1, 0xcb, 0x50, 0xd2,
+  0x6d, 0x2c, 0xe4, 0x7c, 0xd3, 0x5b, 0x20, 0xf3, 0xb5, 0xd9, 0x87, 0x32,
+  0xc1, 0x3a, 0xc8, 0x29, 0xe4, 0xfb, 0xcc, 0xb7, 0xc8, 0x7d, 0xe6, 0xb3,
+  0x18, 0xd6, 0x02, 0xf6, 0x14, 0x68, 0x01, 0x63, 0x14, 0x1b, 0x20, 0x3b,
+  0x41, 0xa7, 0xb1, 0x16, 0x60, 0x1d, 0x68, 0x19, 0xa0, 0x35, 0xf1, 0xa5,
+  0x1c, 0x87, 0xa2, 0xc2, 0xa8, 0x5f, 0x1b, 0xd1, 0xca, 0x3a, 0x7c, 0x08,
+  0x65, 0xba, 0x67, 0x0d, 0x58, 0x78, 0x4d, 0xe2, 0x7e, 0xb0, 0xaf, 0x18,
+  0x6a, 0x4e, 0x6c, 0x25, 0x35, 0x1a, 0xbb, 0x8f, 0xd4, 0x9e, 0xc4, 0x3d,
+  0xa4, 0x6e, 0x48, 0xdc, 0x4d, 0xea, 0x1b, 0x12, 0x9b, 0x49, 0x5d, 0x97,
+  0x08, 0x91, 0xfa, 0xba, 0x44, 0x80, 0xd4, 0xab, 0x61, 0x85, 0xa4, 0x2d,
+  0x55, 0x8d, 0xab, 0x46, 0x74, 0xb6, 0xbb, 0x52, 0x18, 0xb3, 0x52, 0xc1,
+  0x2c, 0x07, 0xcc, 0x3d, 0x04, 0xb3, 0x3c, 0x71, 0x33, 0xa1, 0x75, 0x43,
+  0xcf, 0x4d, 0xa4, 0xe5, 0x84, 0x56, 0x33, 0x69, 0xd5, 0x42, 0xab, 0x81,
+  0xb4, 0x96, 0x41, 0xeb, 0x3a, 0xd2, 0xba, 0x06, 0x5a, 0x2b, 0x49, 0xab,
+  0x1a, 0xd6, 0x3b, 0x30, 0x56, 0xef, 0xa4, 0x6d, 0x62, 0x68, 0x09, 0xb4,
+  0x3b, 0x95, 0xf6, 0x62, 0xa0, 0x58, 0x4b, 0x64, 0x57, 0x42, 0x6b, 0x3d,
+  0x69, 0x95, 0x43, 0xbf, 0x57, 0xe9, 0x17, 0xa1, 0xdd, 0xae, 0xb4, 0xad,
+  0x40, 0x71, 0x3b, 0xa1, 0xc0, 0x39, 0x51, 0x39, 0x55, 0x43, 0x55, 0x51,
+  0xb5, 0x54, 0x3d, 0xe4, 0xb7, 0x9d, 0xd4, 0x1a, 0xca, 0x44, 0x8d, 0xa0,
+  0xf7, 0xd0, 0xbf, 0xa1, 0x0f, 0xe0, 0xae, 0x27, 0xdb, 0x26, 0x5c, 0x69,
+  0x40, 0xe8, 0x13, 0x1d, 0xf2, 0x9c, 0x81, 0xdd, 0x89, 0x8a, 0x10, 0x43,
+  0x9b, 0xf0, 0x55, 0x3f, 0x8c, 0xc8, 0x7a, 0x49, 0x1a, 0x16, 0xea, 0x55,
+  0x0d, 0x3a, 0xb4, 0x06, 0xea, 0xf5, 0x50, 0xbc, 0x50, 0xda, 0xa1, 0xdc,
+  0x06, 0xa5, 0x0e, 0x8a, 0x07, 0x4a, 0x15, 0x94, 0x1a, 0x28, 0xcb, 0xa1,
+  0xd4, 0x43, 0xa9, 0x85, 0x82, 0x67, 0xb5, 0x81, 0xcc, 0x8a, 0x1a, 0xdb,
+  0x46, 0xf4, 0x59, 0x9a, 0xf8, 0x5b, 0x52, 0x6b, 0xc6, 0x9a, 0x08, 0x7e,
+  0x71, 0x02, 0x5b, 0xa2, 0xf2, 0x2d, 0x6d, 0x76, 0xb5, 0x24, 0x86, 0x2a,
+  0x12, 0x3f, 0x4c, 0xc9, 0x2b, 0xb2, 0x82, 0xf4, 0x66, 0x3b, 0x2c, 0x01,
+  0xe7, 0x3e, 0x79, 0x4e, 0x42, 0xe2, 0x1a, 0x82, 0x93, 0xc6, 0x96, 0x92,
+  0xba, 0x2c, 0xb1, 0x98, 0xd4, 0x0b, 0x61, 0x0c, 0x3b, 0x69, 0x95, 0x42,
+  0xcb, 0x43, 0xf8, 0x4b, 0xa0, 0x55, 0x0a, 0x38, 0xf9, 0x94, 0xe0, 0x3c,
+  0x2b, 0x0d, 0xbb, 0x7d, 0x49, 0xac, 0x18, 0x9f, 0x0a, 0xf0, 0x16, 0x14,
+  0xbe, 0xb5, 0xdb, 0xab, 0xc1, 0x36, 0x6f, 0xc3, 0x24, 0x4b, 0xa8, 0x7e,
+  0x14, 0x81, 0x00, 0xff, 0x26, 0x3a, 0x8e, 0x3e, 0x44, 0x13, 0x60, 0x93,
+  0xb5, 0xa0, 0xfb, 0x03, 0xa7, 0x16, 0x23, 0x4f, 0x18, 0xa1, 0xf9, 0xaf,
+  0x25, 0xea, 0xc0, 0x14, 0x0d, 0x60, 0x0f, 0xfc, 0xc6, 0x43, 0x32, 0x41,
+  0xdf, 0x1c, 0x28, 0xb7, 0x63, 0xdb, 0xd4, 0x74, 0x0d, 0x2f, 0x24, 0x19,
+  0x37, 0x96, 0xb9, 0x6c, 0xe8, 0x3a, 0x2b, 0xed, 0x98, 0x9f, 0xa4, 0x45,
+  0xf9, 0x6d, 0x84, 0xfc, 0xc4, 0xbe, 0x83, 0x1a, 0x2b, 0x1e, 0xb5, 0xd8,
+  0xd1, 0x69, 0xcb, 0x88, 0x68, 0x2d, 0xdb, 0x67, 0x49, 0x5a, 0x44, 0x4b,
+  0xc2, 0x04, 0xb1, 0xbd, 0xaa, 0xd9, 0x0c, 0x27, 0xd1, 0x00, 0xfe, 0xc0,
+  0x70, 0x82, 0xb6, 0x43, 0x5e, 0x16, 0xe0, 0xa1, 0x66, 0x21, 0xeb, 0xcf,
+  0x78, 0x8d, 0xef, 0x50, 0x91, 0x39, 0x51, 0x3a, 0xd2, 0x14, 0x65, 0x23,
+  0xd5, 0x51, 0xe2, 0xff, 0x19, 0x84, 0xef, 0x0d, 0x30, 0x66, 0xb9, 0x62,
+  0x6f, 0xbc, 0x1e, 0xea, 0xd9, 0x6a, 0x1e, 0xca, 0x78, 0x57, 0x59, 0x4d,
+  0x27, 0x68, 0xc1, 0x9a, 0xb4, 0x26, 0xc0, 0x2e, 0x76, 0x97, 0x08, 0xe7,
+  0x1e, 0x7c, 0x8e, 0x75, 0xc4, 0x0a, 0x3a, 0x59, 0x13, 0xb6, 0x11, 0x8b,
+  0xd5, 0x36, 0x6a, 0x4b, 0xb8, 0x6c, 0xb6, 0xa4, 0x08, 0x78, 0x3f, 0xc8,
+  0xb4, 0x25, 0xe6, 0x03, 0xd6, 0x3a, 0x5a, 0x92, 0x74, 0x89, 0x56, 0x18,
+  0x7f, 0x2f, 0x8c, 0x2f, 0x24, 0x4a, 0x40, 0xdb, 0x45, 0x23, 0x73, 0xc1,
+  0x57, 0x2c, 0x4a, 0xce, 0x07, 0x9d, 0x6f, 0x00, 0x4a, 0x43, 0xa2, 0x10,
+  0xb0, 0x85, 0xc9, 0x42, 0xf8, 0x3c, 0x37, 0x29, 0x06, 0xbc, 0x27, 0x68,
+  0xb1, 0x30, 0x51, 0x04, 0x73, 0x99, 0x37, 0x52, 0x00, 0x94, 0x73, 0x47,
+  0x0b, 0x61, 0x2e, 0x4b, 0xc8, 0x5b, 0x0a, 0xf5, 0x9c, 0x23, 0xd4, 0xc2,
+  0x60, 0x5b, 0xb6, 0x30, 0x0f, 0x22, 0xbc, 0x6f, 0xb4, 0x74, 0x15, 0xc2,
+  0x7b, 0xe7, 0xbb, 0x8c, 0x81, 0xc6, 0xfb, 0xa7, 0x61, 0x28, 0xcd, 0xdc,
+  0x46, 0x68, 0x6f, 0x66, 0x6e, 0x66, 0x76, 0x91, 0xfd, 0x75, 0x07, 0xd3,
+  0x45, 0xdf, 0x43, 0xd7, 0xa0, 0x86, 0x67, 0x4e, 0x6a, 0x58, 0xba, 0x1c,
+  0x35, 0xfc, 0xf3, 0x49, 0x8d, 0x6f, 0x5f, 0x0d, 0x8c, 0xe3, 0x1d, 0xaa,
+  0x86, 0x11, 0x36, 0x0e, 0x65, 0xda, 0xea, 0x6c, 0x77, 0x47, 0x97, 0x24,
+  0x97, 0x26, 0x2c, 0xe2, 0xd2, 0x11, 0xd5, 0x1f, 0xab, 0xf9, 0x5c, 0x39,
+  0x64, 0x71, 0x2e, 0x6b, 0x45, 0x12, 0xee, 0xd8, 0x62, 0x45, 0x02, 0x7a,
+  0x21, 0x53, 0xd4, 0x36, 0x1b, 0x72, 0xfd, 0xc2, 0x08, 0x78, 0x7c, 0xdb,
+  0xec, 0xfc, 0x17, 0x35, 0x51, 0x5b, 0xab, 0x48, 0x1e, 0x5c, 0x3a, 0xba,
+  0x0a, 0x56, 0xc6, 0x12, 0xa0, 0x3c, 0x52, 0x57, 0x89, 0x47, 0xeb, 0x99,
+  0x0f, 0x99, 0x91, 0x5e, 0x4c, 0x7b, 0x99, 0x90, 0x16, 0xb2, 0x28, 0xfc,
+  0x46, 0x07, 0x41, 0x4f, 0xd1, 0x10, 0xc6, 0x9a, 0xc1, 0x0e, 0x05, 0x43,
+  0x66, 0xb0, 0x1b, 0x1a, 0x33, 0x81, 0x65, 0xd6, 0x0e, 0xe3, 0xf7, 0x62,
+  0x29, 0x0a, 0x7c, 0x1e, 0x83, 0x58, 0x58, 0x27, 0x98, 0x0b, 0xab, 0x9c,
+  0x07, 0x88, 0x01, 0xa8, 0x5e, 0x39, 0x2b, 0x08, 0x05, 0x90, 0x87, 0xd4,
+  0x67, 0x1b, 0xd0, 0xb4, 0x11, 0xd5, 0x2a, 0x7b, 0x29, 0x0e, 0x65, 0xc9,
+  0x08, 0x1d, 0x94, 0xb6, 0x96, 0x80, 0x26, 0x55, 0x89, 0x05, 0xe2, 0xec,
+  0x99, 0xa1, 0x66, 0xa9, 0xfb, 0x86, 0x7d, 0x0b, 0xec, 0xd7, 0x89, 0xe2,
+  0x28, 0x14, 0x18, 0xbb, 0x6e, 0x48, 0x84, 0xb1, 0xc5, 0x04, 0x78, 0x7a,
+  0x9b, 0x38, 0x62, 0x1b, 0x75, 0x59, 0x45, 0x58, 0x55, 0x8c, 0x81, 0xb6,
+  0x0d, 0xa5, 0x6c, 0xa3, 0xb4, 0xdd, 0x96, 0xb0, 0x04, 0x6d, 0xa3, 0xe5,
+  0x7b, 0xaf, 0xa5, 0x6d, 0xf8, 0x4d, 0x99, 0x6f, 0x25, 0x5d, 0xca, 0xe8,
+  0x9a, 0xa9, 0xe6, 0x45, 0xb0, 0x07, 0x20, 0xce, 0x84, 0xca, 0x60, 0x1d,
+  0x57, 0xa2, 0x52, 0x06, 0xcb, 0x2f, 0x05, 0xdb, 0xa2, 0xb1, 0x52, 0x98,
+  0x49, 0x69, 0xb2, 0x34, 0x21, 0xda, 0x0a, 0xf6, 0x96, 0xc2, 0xae, 0x41,
+  0xe3, 0x0b, 0xf0, 0x0e, 0x95, 0xf3, 0x3b, 0x98, 0xd7, 0xbf, 0xc0, 0x1c,
+  0x25, 0x09, 0xcf, 0x0b, 0xeb, 0x8e, 0x5f, 0x24, 0xaa, 0xfa, 0x7f, 0xd5,
+  0x3c, 0xf1, 0xbc, 0xb0, 0x8f, 0x61, 0xa9, 0xb9, 0x08, 0x29, 0x3e, 0x42,
+  0x0b, 0xe5, 0x87, 0x50, 0x70, 0x1c, 0xc0, 0x67, 0xc9, 0x00, 0xc5, 0x44,
+  0x62, 0x17, 0x3e, 0x2d, 0x99, 0xf6, 0x8a, 0xbf, 0x87, 0xec, 0xc0, 0xcb,
+  0x47, 0x16, 0x46, 0xb5, 0x90, 0x27, 0xea, 0x22, 0x86, 0xe8, 0x3c, 0xb0,
+  0xae, 0x7d, 0xc8, 0x29, 0x14, 0x8f, 0xa6, 0x7d, 0xd7, 0x89, 0x36, 0xc8,
+  0x16, 0x7d, 0x40, 0x83, 0xb1, 0x0b, 0xf6, 0x99, 0x21, 0xf6, 0xa8, 0xd8,
+  0x9b, 0x00, 0xab, 0xc7, 0x7b, 0x10, 0xb0, 0xda, 0x1c, 0xb6, 0x1e, 0xb0,
+  0x38, 0xbe, 0x19, 0x94, 0xc8, 0x30, 0x87, 0x36, 0x53, 0x16, 0x7c, 0xcf,
+  0x80, 0x2d, 0x6a, 0xc8, 0xbd, 0x33, 0x90, 0x63, 0xf7, 0x5f, 0xbf, 0x89,
+  0xdf, 0x59, 0xfd, 0x0a, 0xa2, 0xdf, 0x99, 0x37, 0x67, 0xa2, 0x38, 0x9b,
+  0xbb, 0xc3, 0xe1, 0xbb, 0x90, 0x72, 0x47, 0xdc, 0x3e, 0x6f, 0xb4, 0x36,
+  0x70, 0x2e, 0x9c, 0x1d, 0xd0, 0x5a, 0x99, 0x18, 0x3b, 0x66, 0x71, 0x94,
+  0xe1, 0x77, 0x1b, 0x90, 0xed, 0xd5, 0x46, 0x8a, 0xa3, 0xce, 0x08, 0x17,
+  0x75, 0x45, 0x34, 0x51, 0x77, 0x44, 0x17, 0xc5, 0xef, 0x30, 0x71, 0x46,
+  0x84, 0x6b, 0x1a, 0x6a, 0xfc, 0xc6, 0x83, 0x81, 0x1a, 0xdf, 0x77, 0xf1,
+  0x9d, 0x0a, 0xeb, 0x96, 0x09, 0x68, 0x73, 0x63, 0x84, 0xe1, 0xee, 0xb3,
+  0x0d, 0xce, 0x75, 0xee, 0x3e, 0x68, 0xad, 0x74, 0xac, 0xdf, 0xa5, 0x43,
+  0xd7, 0x42, 0x84, 0x5d, 0x6c, 0x5b, 0xed, 0x5e, 0xea, 0xd4, 0xd8, 0xcb,
+  0x1b, 0x59, 0xf7, 0x9f, 0xb7, 0x2c, 0x73, 0x16, 0x07, 0x26, 0x43, 0x7a,
+  0x34, 0x19, 0xa4, 0x13, 0x4c, 0x12, 0xa5, 0x44, 0x1b, 0x6e, 0xe3, 0x77,
+  0xb5, 0x1b, 0x59, 0x44, 0x74, 0xbe, 0x71, 0x17, 0xce, 0x5a, 0x17, 0x20,
+  0xa0, 0x77, 0xfd, 0x79, 0x4b, 0x71, 0x80, 0xe8, 0x99, 0x64, 0x12, 0x28,
+  0x65, 0x11, 0xbf, 0xa8, 0xe7, 0xad, 0x8a, 0x6d, 0x6f, 0x74, 0x2c, 0xb6,
+  0x2d, 0x61, 0xff, 0x32, 0xec, 0xbb, 0xd8, 0xbe, 0x84, 0xfe, 0xb6, 0x58,
+  0xd1, 0x44, 0xc7, 0x34, 0x76, 0x5b, 0x33, 0xeb, 0x5e, 0x0f, 0x77, 0xde,
+  0xc9, 0xce, 0xaf, 0xb3, 0xf7, 0x46, 0x79, 0x16, 0xe3, 0x37, 0x3a, 0x98,
+  0x4e, 0x6c, 0xf3, 0x35, 0xee, 0x3f, 0x67, 0x61, 0x62, 0x58, 0x5f, 0xd0,
+  0x30, 0x54, 0x5f, 0x2b, 0xd7, 0x95, 0x8e, 0xab, 0xe9, 0x7d, 0xad, 0x83,
+  0x1b, 0xbd, 0x81, 0x99, 0xee, 0xaa, 0x6e, 0x5e, 0x06, 0x6d, 0x5a, 0x6d,
+  0x33, 0xda, 0xc3, 0x28, 0xae, 0x43, 0xcb, 0xfc, 0x46, 0xf3, 0x35, 0xde,
+  0x1b, 0xcc, 0x35, 0xfe, 0x42, 0x73, 0xb5, 0xb7, 0xde, 0xbc, 0xd4, 0xaf,
+  0x37, 0x2f, 0xf1, 0xae, 0x36, 0x57, 0xf9, 0x75, 0xe6, 0xc5, 0xde, 0x3a,
+  0x73, 0xa5, 0x5f, 0x63, 0xae, 0xf0, 0x5e, 0x6b, 0x2e, 0xf7, 0x73, 0x66,
+  0xbb, 0x77, 0xb9, 0x59, 0xf4, 0x33, 0x66, 0x9b, 0xd7, 0x65, 0x86, 0x8c,
+  0xc3, 0xec, 0xc2, 0xe3, 0x84, 0x58, 0x90, 0x43, 0x43, 0xb9, 0xfc, 0x18,
+  0x8a, 0x5f, 0x84, 0x32, 0x09, 0x25, 0x03, 0xe5, 0x33, 0x28, 0x7f, 0x80,
+  0xf2, 0x31, 0x94, 0xd3, 0x50, 0xfe, 0x1d, 0xca, 0xbf, 0x42, 0x39, 0x09,
+  0x25, 0x09, 0xe5, 0x5d, 0x28, 0xff, 0x03, 0xca, 0x3f, 0x3f, 0x86, 0xdf,
+  0xd5, 0xf8, 0x3b, 0x68, 0x38, 0xf3, 0xcd, 0x01, 0xf9, 0x3c, 0x6e, 0x03,
+  0x79, 0xd4, 0x30, 0xfa, 0x88, 0xba, 0x7f, 0x4d, 0xa8, 0xce, 0x7e, 0x69,
+  0x0f, 0xf8, 0x1c, 0xe4, 0x0f, 0x48, 0xd2, 0xb5, 0x0e, 0xb0, 0xfd, 0x38,
+  0xd3, 0xb9, 0xaa, 0x7c, 0x81, 0xfd, 0x66, 0x7b, 0x9d, 0xbd, 0x24, 0xca,
+  0x74, 0xce, 0x09, 0x34, 0x87, 0x20, 0xbd, 0xb0, 0x17, 0x45, 0xe7, 0x04,
+  0x50, 0xc4, 0x19, 0x2e, 0x20, 0xb5, 0x2b, 0xcc, 0x93, 0xda, 0x1d, 0xa6,
+  0xa1, 0xfe, 0xec, 0x65, 0xb6, 0xbb, 0x59, 0xb1, 0x16, 0x35, 0x5a, 0xdd,
+  0x8c, 0x7f, 0x47, 0xf2, 0x36, 0x8c, 0x81, 0xe5, 0xdd, 0xea, 0xd8, 0xec,
+  0x60, 0x42, 0xf3, 0x3a, 0xd1, 0xc7, 0xeb, 0x2b, 0xe7, 0x44, 0xe7, 0x6d,
+  0x6a, 0xb2, 0xde, 0x5e, 0xa9, 0x8f, 0xce, 0xeb, 0x6c, 0x33, 0xad, 0xaf,
+  0xd4, 0xe1, 0xcf, 0xa6, 0xdb, 0x2b, 0x35, 0xf0, 0xd9, 0x6f, 0xfa, 0xec,
+  0x65, 0x53, 0x17, 0x33, 0xcc, 0x76, 0x51, 0xc3, 0xda, 0x2e, 0x43, 0xd7,
+  0xf4, 0x16, 0x66, 0x33, 0x1e, 0x01, 0x01, 0x15, 0xae, 0x3b, 0xc2, 0x1c,
+  0xa9, 0x83, 0x61, 0x0a, 0xea, 0x50, 0x78, 0x72, 0x33, 0xac, 0xcf, 0x26,
+  0x79, 0x4c, 0xfc, 0xce, 0x9d, 0xe4, 0x7a, 0x4a, 0x19, 0x86, 0x82, 0xef,
+  0xff, 0x18, 0xfc, 0x2d, 0x37, 0x35, 0xde, 0xdc, 0xd8, 0xde, 0xb8, 0xb1,
+  0x11, 0x49, 0x77, 0xb6, 0xd8, 0xa9, 0x3f, 0xfd, 0xcf, 0x9f, 0x45, 0xbd,
+  0xbe, 0xd6, 0x35, 0xb7, 0x34, 0xb7, 0xac, 0xb1, 0x36, 0x7d, 0xd7, 0xda,
+  0xea, 0x43, 0xd2, 0x2d, 0x1b, 0xd7, 0xb4, 0xf8, 0xac, 0xeb, 0xd7, 0x35,
+  0xb7, 0x6c, 0xf4, 0xb7, 0x58, 0x6f, 0xf4, 0xb5, 0x6e, 0x40, 0x12, 0xe6,
+  0xb3, 0xb6, 0x6c, 0x6c, 0x6f, 0xf1, 0x79, 0x7d, 0xeb, 0xfc, 0x2d, 0xfe,
+  0x1a, 0xeb, 0xfa, 0xf6, 0x35, 0xcb, 0x90, 0x74, 0x3b, 0x8c, 0x75, 0x0f,
+  0xce, 0x39, 0xa1, 0x34, 0x9a, 0xab, 0x9b, 0x0a, 0x6d, 0xcd, 0x45, 0xf6,
+  0x1a, 0x9a, 0x5b, 0x53, 0x68, 0x5b, 0x46, 0x73, 0x2d, 0x86, 0x45, 0x37,
+  0x1a, 0x16, 0xdd, 0x54, 0x64, 0x5f, 0xc7, 0x68, 0xd7, 0xeb, 0xcb, 0x84,
+  0x79, 0x2b, 0x37, 0x58, 0xae, 0xd9, 0x58, 0x64, 0x6f, 0x35, 0x56, 0x7a,
+  0x0d, 0x8b, 0x7c, 0x85, 0x36, 0x7f, 0xa1, 0xad, 0xbd, 0xd0, 0x76, 0x4b,
+  0xa1, 0xed, 0xbb, 0xc6, 0x4a, 0x09, 0x05, 0xee, 0x18, 0x46, 0xe1, 0x3b,
+  0x86, 0xd7, 0x25, 0xf1, 0xef, 0x84, 0xd6, 0xbd, 0xe7, 0x09, 0x5c, 0x7e,
+  0x07, 0x95, 0xd3, 0xe3, 0x37, 0x25, 0x9c, 0xb6, 0x9b, 0x46, 0xa5, 0x8f,
+  0x7c, 0x76, 0xc3, 0x56, 0x9f, 0xe8, 0x09, 0x50, 0x27, 0xf4, 0x08, 0x95,
+  0x4b, 0xa9, 0x66, 0x88, 0x82, 0x7a, 0x54, 0x57, 0xeb, 0x0f, 0xe0, 0x15,
+  0x5b, 0x5b, 0x2b, 0xb6, 0x76, 0x7e, 0xd4, 0x30, 0xda, 0xdc, 0xa1, 0x6f,
+  0xf6, 0x07, 0x6e, 0x18, 0x65, 0x3a, 0xd4, 0x77, 0x69, 0xf8, 0xf3, 0xea,
+  0x24, 0x13, 0x82, 0x9e, 0x26, 0x7f, 0x40, 0xeb, 0xa9, 0x6c, 0x95, 0x63,
+  0xbf, 0x1e, 0xd5, 0xd7, 0x76, 0x7e, 0xd4, 0x93, 0x5a, 0x67, 0xbd, 0x30,
+  0xfe, 0x1d, 0xd4, 0x1c, 0x2c, 0x45, 0xd7, 0x7b, 0xae, 0x6f, 0xfa, 0x0e,
+  0x5d, 0x4a, 0xeb, 0x51, 0x4d, 0x2d, 0x1a, 0xa6, 0xcf, 0x7c, 0xec, 0x38,
+  0xe9, 0x58, 0xfc, 0xbf, 0x47, 0x02, 0xf4, 0xdb, 0x54, 0x74, 0xf9, 0xb0,
+  0x94, 0x82, 0xdb, 0xca, 0xa8, 0xd5, 0x3e, 0x12, 0xf8, 0xfc, 0x1d, 0x74,
+  0xcd, 0xe2, 0x7f, 0xdf, 0xb2, 0xec, 0xb6, 0x8a, 0x6b, 0x1f, 0x9e, 0x13,
+  0xad, 0x48, 0x8a, 0x94, 0x7b, 0x6f, 0x25, 0x55, 0x3e, 0xea, 0xb3, 0x97,
+  0x27, 0x83, 0xe2, 0x58, 0xc0, 0x7a, 0x82, 0x5a, 0x66, 0x3f, 0xb9, 0x74,
+  0x5f, 0x47, 0x60, 0x81, 0xb5, 0x0a, 0xf2, 0x48, 0xaa, 0x72, 0x2c, 0xf8,
+  0x23, 0xd1, 0xb6, 0x4c, 0x18, 0x6d, 0xb2, 0x0b, 0xc9, 0x26, 0x11, 0x24,
+  0x9e, 0xb8, 0xad, 0xa2, 0x60, 0x0f, 0xba, 0xa6, 0x74, 0xff, 0x58, 0x68,
+  0xad, 0x7d, 0x3a, 0x2a, 0xcb, 0x1c, 0x0b, 0xfd, 0xc8, 0xee, 0x5c, 0x86,
+  0x52, 0x93, 0xdf, 0x87, 0x75, 0xbc, 0x57, 0x0b, 0xf1, 0x08, 0xb0, 0xf6,
+  0x92, 0xee, 0x53, 0xa7, 0x9d, 0x1d, 0x4b, 0x60, 0xff, 0x9b, 0xed, 0xd2,
+  0xe5, 0x35, 0xb4, 0x74, 0x16, 0x19, 0x49, 0xee, 0x88, 0x3e, 0x90, 0x58,
+  0x28, 0x26, 0x28, 0x5a, 0x28, 0x06, 0x28, 0xf8, 0x3d, 0x02, 0x7e, 0x9f,
+  0x50, 0x06, 0xed, 0xf5, 0x4f, 0x20, 0xb2, 0xf6, 0x4f, 0xe3, 0xdc, 0x05,
+  0x8d, 0x48, 0x73, 0x00, 0x57, 0x02, 0xe5, 0x3a, 0x45, 0xee, 0xea, 0xf7,
+  0x4e, 0x8d, 0x37, 0x06, 0x57, 0x89, 0xb6, 0xf2, 0xbb, 0x06, 0x1b, 0x41,
+  0xbe, 0xb9, 0x7c, 0x65, 0x62, 0xe5, 0xa8, 0x25, 0x50, 0xed, 0x71, 0x75,
+  0xba, 0x80, 0xe6, 0x12, 0xd0, 0x2c, 0xcf, 0xd1, 0xdc, 0xaa, 0xd0, 0x38,
+  0x13, 0x4e, 0x85, 0xa6, 0x36, 0x81, 0x4e, 0x5b, 0x6d, 0x55, 0x40, 0xc9,
+  0xe2, 0x15, 0xb1, 0x57, 0x10, 0x1e, 0xdc, 0x9a, 0xee, 0x11, 0x7f, 0xdf,
+  0x15, 0xaa, 0x75, 0x74, 0xc1, 0xe7, 0xb5, 0xe5, 0xf6, 0x93, 0x73, 0x77,
+  0xa1, 0xc5, 0x22, 0x5d, 0x31, 0xba, 0x82, 0xe4, 0x2e, 0xb6, 0xd1, 0x26,
+  0xd1, 0x67, 0xef, 0xc0, 0x56, 0xaa, 0xb4, 0xbd, 0x5f, 0xb3, 0xaf, 0x0d,
+  0xac, 0x74, 0xf6, 0x04, 0x55, 0x51, 0x31, 0xd8, 0x11, 0x58, 0x02, 0xb6,
+  0x3a, 0x1b, 0x5a, 0x5b, 0x6e, 0xde, 0x53, 0xbb, 0xb8, 0x24, 0x09, 0xb9,
+  0x98, 0xd8, 0x05, 0xd2, 0xd1, 0xe2, 0xd2, 0xfd, 0x1d, 0xc1, 0xb5, 0xe2,
+  0x74, 0x14, 0x4b, 0x44, 0x8b, 0x4d, 0x43, 0x1d, 0x58, 0xa7, 0x4a, 0x3d,
+  0x44, 0x72, 0xed, 0x7b, 0x9e, 0x4d, 0x1e, 0x8c, 0x2d, 0xd7, 0x8d, 0xca,
+  0x76, 0x32, 0xdb, 0xf5, 0xc8, 0x5b, 0x2e, 0x5d, 0x5e, 0x4b, 0x1b, 0x25,
+  0x6c, 0x27, 0x6c, 0x23, 0x6c, 0x0f, 0xd5, 0x16, 0x55, 0xd0, 0x7e, 0x1e,
+  0xea, 0x23, 0x24, 0xaf, 0xf9, 0x40, 0xea, 0x02, 0x3b, 0x61, 0xfb, 0x6c,
+  0xd8, 0x74, 0x5b, 0x85, 0x29, 0x8a, 0x77, 0x13, 0x05, 0x39, 0x0a, 0xae,
+  0xe9, 0x88, 0x96, 0xd4, 0x4c, 0x84, 0x25, 0x35, 0x1b, 0x41, 0x51, 0xfa,
+  0x43, 0xc7, 0xfb, 0xde, 0xcd, 0x5e, 0x3c, 0x62, 0xc5, 0xd4, 0xf8, 0x35,
+  0xbf, 0xdf, 0x02, 0x9a, 0xdc, 0x2c, 0xda, 0x16, 0xeb, 0x51, 0xa0, 0x62,
+  0x49, 0xae, 0xa7, 0x2a, 0x29, 0x8d, 0xbb, 0xc4, 0x9b, 0x3b, 0x17, 0xc3,
+  0x8a, 0xe3, 0x9e, 0x8a, 0xa4, 0x94, 0x92, 0x77, 0xeb, 0x5f, 0x05, 0xc4,
+  0x56, 0x04, 0x99, 0x04, 0x05, 0x85, 0x81, 0xc2, 0xc2, 0x18, 0x05, 0xf8,
+  0xed, 0xc0, 0xb0, 0xf6, 0x23, 0xcd, 0xb0, 0xf5, 0xa3, 0x9a, 0x03, 0x38,
+  0x8f, 0x58, 0x7a, 0x80, 0x82, 0x67, 0xd5, 0x81, 0x92, 0x64, 0xe7, 0xc7,
+  0x78, 0xdf, 0x86, 0x02, 0xdf, 0x41, 0xf3, 0x46, 0x4b, 0x29, 0x7d, 0x73,
+  0x28, 0x30, 0x47, 0xd9, 0xcb, 0x18, 0x57, 0xd9, 0x5a, 0x8a, 0xf0, 0x3e,
+  0x16, 0x5b, 0xff, 0x2a, 0x70, 0xa5, 0xd4, 0xf9, 0xd1, 0x05, 0x20, 0xa1,
+  0x04, 0xa4, 0xce, 0x03, 0xa9, 0xd4, 0x01, 0xfc, 0x8e, 0x06, 0xd1, 0x48,
+  0x1b, 0x46, 0xd8, 0x1e, 0xd8, 0x06, 0x56, 0x28, 0xe5, 0xb3, 0xf6, 0x4c,
+  0x09, 0x19, 0x73, 0xde, 0x01, 0xbd, 0x32, 0xa6, 0x3f, 0x70, 0x27, 0xd2,
+  0x91, 0x31, 0xfd, 0x01, 0x4d, 0xee, 0xfc, 0xdc, 0x99, 0x1b, 0xb3, 0xe9,
+  0x25, 0x90, 0x08, 0xf2, 0x54, 0xfe, 0xee, 0x1f, 0xb5, 0x7f, 0x7f, 0xab,
+  0xf5, 0xd6, 0x4d, 0x5b, 0xbb, 0xef, 0xbe, 0xef, 0xde, 0xd5, 0xd6, 0xda,
+  0x65, 0x2b, 0x9c, 0x48, 0xc6, 0x35, 0xdd, 0x7f, 0xf7, 0x3d, 0x9d, 0xab,
+  0xbf, 0x7d, 0xff, 0xbd, 0x56, 0x97, 0xdb, 0xea, 0x5c, 0xb5, 0xaa, 0xce,
+  0xb9, 0x7c, 0xf5, 0x0a, 0xd7, 0xea, 0x15, 0x2b, 0xd1, 0xd3, 0x3f, 0x41,
+  0xf1, 0xd7, 0xa1, 0xfc, 0x25, 0xfd, 0xae, 0x7d, 0x83, 0xaf, 0x9a, 0x92,
+  0x5b, 0x7f, 0x0d, 0x65, 0x1e, 0x14, 0x03, 0xc9, 0x8d, 0xe5, 0x82, 0xb3,
+  0xdc, 0x92, 0x92, 0x12, 0xb4, 0x64, 0xc9, 0x12, 0xe4, 0xf3, 0xf9, 0x50,
+  0x28, 0x14, 0x42, 0xdd, 0xdd, 0xdd, 0xa8, 0xbf, 0xbf, 0x1f, 0xc5, 0xe3,
+  0x71, 0x74, 0xf8, 0xf0, 0x61, 0xf4, 0xe2, 0x8b, 0x2f, 0xa2, 0x63, 0xc7,
+  0x8e, 0xa1, 0x77, 0xdf, 0x7d, 0x17, 0x9d, 0x3c, 0x79, 0x12, 0x9d, 0x39,
+  0x73, 0x06, 0x9d, 0x3f, 0x7f, 0x9e, 0xc8, 0x8c, 0x32, 0x88, 0xef, 0x63,
+  0xfa, 0x51, 0x1f, 0x83, 0xa2, 0x46, 0xc4, 0xf4, 0x19, 0x0b, 0x7a, 0x91,
+  0xa6, 0xcf, 0x88, 0xfa, 0x34, 0x4c, 0xaf, 0xb1, 0x4f, 0x83, 0x31, 0x9a,
+  0x5e, 0xfc, 0xec, 0x47, 0x9a, 0x5e, 0x78, 0x30, 0x46, 0xca, 0xc8, 0xf4,
+  0x22, 0x23, 0xd5, 0x3b, 0x83, 0x01, 0x4a, 0xa4, 0x35, 0xb2, 0xb3, 0x30,
+  0xbd, 0x8c, 0x51, 0xa7, 0x35, 0x6a, 0x66, 0xd3, 0xf0, 0x46, 0x2d, 0x6b,
+  0x44, 0xb3, 0x31, 0x5a, 0x63, 0x2f, 0x7d, 0x25, 0x06, 0x19, 0x69, 0x78,
+  0x5c, 0x81, 0xa1, 0x7b, 0x8d, 0xfc, 0x95, 0x18, 0x18, 0xa7, 0x80, 0x60,
+  0xb4, 0xbd, 0x9a, 0x7e, 0xa4, 0xd3, 0xc0, 0x5e, 0xed, 0x05, 0x15, 0x7b,
+  0x35, 0xe8, 0xbf, 0x6d, 0xf0, 0xfd, 0xde, 0x24, 0x9b, 0xea, 0x06, 0x28,
+  0x76, 0x30, 0xdb, 0x77, 0x15, 0x33, 0x69, 0xf1, 0xed, 0x1a, 0x7c, 0x14,
+  0x36, 0xd7, 0xb1, 0xb8, 0x13, 0x1d, 0xeb, 0x2f, 0x41, 0xc7, 0xfe, 0x2b,
+  0x42, 0xc7, 0x0e, 0x87, 0xd0, 0xb1, 0x17, 0xf7, 0x13, 0x9e, 0xed, 0x69,
+  0x8a, 0xe7, 0x7a, 0x69, 0xa6, 0x97, 0x65, 0x7a, 0x69, 0x8e, 0x3f, 0x46,
+  0xf5, 0xf2, 0x3f, 0xe5, 0x1e, 0xa1, 0xf8, 0x23, 0x1c, 0xff, 0x30, 0xb4,
+  0x7f, 0xc6, 0x0d, 0x53, 0x3c, 0xbd, 0x8b, 0x65, 0xb8, 0xd7, 0x80, 0x8e,
+  0x3e, 0xc2, 0xd2, 0x07, 0xa0, 0x66, 0x5e, 0x62, 0xb9, 0xfd, 0x14, 0x47,
+  0xbf, 0xc4, 0xfe, 0x18, 0x7a, 0x07, 0x59, 0xee, 0x17, 0x14, 0xc7, 0xbc,
+  0xcc, 0xd2, 0x43, 0x50, 0xbd, 0xc2, 0x72, 0xfb, 0x00, 0xf9, 0x0a, 0xfb,
+  0x38, 0xc5, 0x1d, 0x64, 0xf9, 0x97, 0xa0, 0xfd, 0x73, 0x96, 0xde, 0x47,
+  0x71, 0xaf, 0xb2, 0xdc, 0x1e, 0xf8, 0xf0, 0x0b, 0xf6, 0x30, 0x45, 0x1f,
+  0x62, 0xb9, 0x23, 0x18, 0x43, 0x03, 0x86, 0xf9, 0x25, 0xcb, 0xed, 0xa6,
+  0xb8, 0x5f, 0xb2, 0x8f, 0x51, 0xcc, 0xa3, 0x2c, 0xfd, 0x02, 0xc1, 0xd0,
+  0x80, 0x79, 0x8d, 0xe5, 0x76, 0x51, 0xf4, 0xdf, 0xb1, 0x8f, 0x52, 0xcc,
+  0x61, 0x96, 0x7e, 0x0e, 0x23, 0x68, 0x40, 0xbc, 0xce, 0x72, 0x31, 0xa0,
+  0x79, 0x8d, 0x7d, 0x84, 0xa2, 0x7f, 0xcc, 0x72, 0xcf, 0x60, 0x0c, 0x1d,
+  0xa7, 0xe8, 0x5f, 0xb1, 0xdc, 0x43, 0x14, 0xff, 0x2b, 0xf6, 0x10, 0xc5,
+  0x0d, 0xb3, 0xfc, 0x53, 0x18, 0x41, 0xc7, 0x28, 0xfa, 0x0d, 0x96, 0x8b,
+  0x52, 0xfc, 0x1b, 0xec, 0xc3, 0x14, 0xff, 0x13, 0x96, 0x79, 0x12, 0x23,
+  0xe8, 0x87, 0x28, 0xee, 0xd7, 0x18, 0xcd, 0x60, 0x34, 0xfd, 0x24, 0x0b,
+  0x93, 0xa4, 0x7f, 0xcd, 0xd2, 0x40, 0xf7, 0x26, 0xcb, 0x45, 0x70, 0xfb,
+  0x61, 0x6a, 0x0f, 0xcb, 0xf1, 0xbd, 0xa0, 0xef, 0x6e, 0x96, 0x7e, 0x82,
+  0xe2, 0xde, 0xc4, 0xbd, 0x0c, 0xf4, 0xee, 0xc4, 0x34, 0x07, 0x29, 0x6e,
+  0x17, 0x4b, 0x43, 0x73, 0x37, 0xcb, 0x3f, 0x4e, 0xf1, 0x0f, 0xb3, 0xcf,
+  0xd2, 0xc0, 0xc6, 0x0d, 0xb1, 0xcc, 0x0b, 0x34, 0x50, 0xec, 0x67, 0x99,
+  0xe7, 0xe9, 0x83, 0x14, 0x1d, 0x67, 0x99, 0x3e, 0x8a, 0xef, 0x25, 0x72,
+  0x76, 0xb1, 0xdc, 0xe3, 0x14, 0x33, 0xc8, 0xd2, 0xbd, 0xfc, 0x51, 0x8a,
+  0xdf, 0x0b, 0x06, 0xe5, 0x7f, 0x4e, 0x71, 0xa4, 0x3e, 0x4e, 0xed, 0x62,
+  0x81, 0x84, 0xee, 0x67, 0xb9, 0x5e, 0x8a, 0x03, 0xa6, 0xc3, 0x72, 0xc7,
+  0xab, 0x14, 0x0d, 0x4a, 0xfc, 0x12, 0x34, 0x61, 0xf8, 0x7f, 0xc0, 0x1d,
+  0x34, 0x74, 0xef, 0xc0, 0x44, 0x40, 0xff, 0x18, 0xb5, 0x97, 0xe5, 0x06,
+  0x28, 0xfe, 0x05, 0x18, 0x6f, 0x37, 0x10, 0xc0, 0x40, 0x3f, 0xe3, 0xf8,
+  0x01, 0x8a, 0x03, 0x7d, 0xfb, 0x29, 0x58, 0xc3, 0x03, 0x78, 0x7c, 0x10,
+  0xbb, 0x13, 0x16, 0x16, 0x37, 0xb9, 0x47, 0x29, 0x6e, 0x0f, 0x0b, 0x74,
+  0x1c, 0xfd, 0x53, 0x96, 0xde, 0x81, 0x67, 0x80, 0xb5, 0x83, 0x25, 0x05,
+  0x31, 0x0c, 0x4c, 0x07, 0x7a, 0x98, 0x9f, 0xb1, 0x07, 0x40, 0x38, 0x0c,
+  0x13, 0x61, 0x79, 0x8a, 0x07, 0x55, 0x1e, 0xc5, 0xc2, 0x81, 0x8c, 0x39,
+  0x82, 0x79, 0x80, 0x0c, 0xa8, 0x60, 0xf1, 0xfb, 0xf1, 0x84, 0x80, 0x83,
+  0x7e, 0x91, 0xdd, 0xaf, 0x68, 0x46, 0x47, 0x14, 0xcd, 0x0e, 0x61, 0x1d,
+  0x60, 0x60, 0xa0, 0x03, 0x16, 0x32, 0x35, 0xee, 0x65, 0xcc, 0xc2, 0x91,
+  0x36, 0xec, 0x9d, 0xfd, 0x14, 0x43, 0x54, 0x8b, 0xaa, 0xaa, 0x1d, 0xa2,
+  0x68, 0x95, 0x8e, 0x1e, 0xc0, 0xe3, 0x82, 0x3c, 0xfe, 0x28, 0xe6, 0xc1,
+  0xbd, 0x04, 0x3f, 0x84, 0x47, 0x84, 0xd6, 0x43, 0x8a, 0x62, 0x87, 0x40,
+  0x32, 0xee, 0x39, 0x8a, 0x39, 0x38, 0x22, 0x8e, 0x21, 0x1c, 0x20, 0x9a,
+  0x30, 0x0f, 0xa9, 0x7a, 0x3d, 0xa4, 0xe8, 0x45, 0x16, 0x0d, 0xba, 0x5e,
+  0xc1, 0x1c, 0x74, 0x5c, 0x6e, 0x02, 0x83, 0x4c, 0x85, 0x19, 0xb0, 0x56,
+  0x14, 0x1f, 0x53, 0xb5, 0x3a, 0xa8, 0x8c, 0x4e, 0xcb, 0x1c, 0x31, 0x42,
+  0x07, 0x2c, 0x7d, 0x58, 0x01, 0xc0, 0xbf, 0xc2, 0x0e, 0x2a, 0x4a, 0xc5,
+  0x15, 0xa5, 0x0e, 0x2a, 0xa3, 0xff, 0x5c, 0x61, 0xe0, 0x66, 0x31, 0xf0,
+  0x78, 0xb8, 0x41, 0x45, 0x29, 0x86, 0x08, 0xc0, 0xe3, 0x1d, 0x50, 0xc6,
+  0xff, 0x1a, 0x16, 0x59, 0xad, 0x5d, 0x58, 0x2d, 0xe0, 0xe6, 0x30, 0x07,
+  0x50, 0xfd, 0xe2, 0xab, 0x18, 0xf6, 0x29, 0x4a, 0xed, 0x56, 0x94, 0xc2,
+  0xf4, 0xd0, 0xfa, 0x1a, 0x7a, 0x45, 0xa7, 0xdd, 0xaa, 0x4e, 0xfb, 0x29,
+  0x65, 0x44, 0xd8, 0xd6, 0x39, 0x1e, 0x18, 0xff, 0x29, 0x3a, 0xc7, 0xb6,
+  0x9b, 0x7d, 0x0a, 0xce, 0xb4, 0xac, 0xd9, 0x1e, 0x55, 0x33, 0xcc, 0xd7,
+  0x4b, 0x08, 0x8e, 0xa8, 0x5c, 0xd0, 0x7e, 0x5e, 0x61, 0x01, 0x55, 0x5e,
+  0x25, 0xcf, 0x5e, 0xbc, 0xbd, 0x65, 0x44, 0x8e, 0xe3, 0x45, 0x95, 0x21,
+  0x46, 0x3c, 0x80, 0xc2, 0xc0, 0xbf, 0x4a, 0xe4, 0x82, 0x56, 0x7b, 0x55,
+  0xdd, 0x86, 0x28, 0x55, 0x58, 0x9c, 0xee, 0xe3, 0xf8, 0xc3, 0x33, 0x7c,
+  0xcc, 0x61, 0x9a, 0x8b, 0xe7, 0x58, 0x61, 0x90, 0x27, 0xe9, 0xbd, 0x8a,
+  0x86, 0xfb, 0x54, 0x0d, 0x15, 0xee, 0x1f, 0xb3, 0xe0, 0xea, 0x0e, 0xa9,
+  0xac, 0xcf, 0x63, 0xf7, 0x31, 0x9b, 0x8f, 0xdd, 0xa3, 0xea, 0x39, 0xa8,
+  0x8c, 0x35, 0x24, 0xdb, 0x1c, 0x1c, 0x08, 0xde, 0x15, 0x5f, 0xcd, 0xa6,
+  0x68, 0x3b, 0xa8, 0x6a, 0x3b, 0xa8, 0xac, 0xee, 0x53, 0xd8, 0x38, 0x5f,
+  0xc3, 0x27, 0xab, 0x39, 0xa4, 0xaa, 0x39, 0xa8, 0xec, 0xa3, 0xa7, 0xe1,
+  0x60, 0x0f, 0x7e, 0x35, 0xdf, 0x6e, 0x55, 0xcd, 0xfd, 0x8a, 0x9a, 0x83,
+  0xea, 0x8e, 0x7d, 0x06, 0x7b, 0xdc, 0xaf, 0xe1, 0x53, 0xf4, 0xdc, 0xaf,
+  0xea, 0x49, 0xf6, 0x00, 0x48, 0xe2, 0x9f, 0x85, 0x11, 0xf7, 0x28, 0x9c,
+  0xcc, 0xd5, 0x38, 0x65, 0x4d, 0x0f, 0xa8, 0x9a, 0x92, 0xcd, 0x86, 0xcf,
+  0xe1, 0x73, 0x2c, 0xbf, 0x5b, 0xe1, 0x7b, 0xe1, 0x4b, 0x6c, 0xbb, 0x54,
+  0x45, 0x0f, 0xe6, 0x14, 0x65, 0x64, 0x9f, 0xf7, 0x1c, 0xf1, 0xf1, 0x5f,
+  0xc9, 0xa6, 0xe8, 0x79, 0x70, 0x96, 0x9e, 0xc4, 0x6d, 0xe1, 0xe1, 0xe2,
+  0x5f, 0xc3, 0x27, 0x6b, 0xf9, 0xf0, 0x8c, 0x3d, 0x15, 0x2f, 0xf6, 0x2c,
+  0xcb, 0xc7, 0xbe, 0x92, 0x2d, 0xae, 0x6a, 0x79, 0x28, 0xa7, 0x25, 0x27,
+  0xbb, 0x56, 0x8e, 0x81, 0x95, 0xf8, 0x3a, 0x46, 0x45, 0xcf, 0x43, 0x33,
+  0xeb, 0xbe, 0x97, 0x38, 0xc9, 0x3e, 0x2e, 0x4e, 0x1f, 0xc0, 0xf1, 0x46,
+  0x61, 0xfd, 0xc2, 0x0e, 0x3d, 0x40, 0x03, 0x71, 0x5c, 0xd1, 0xf6, 0x91,
+  0x19, 0x6d, 0xe1, 0x7c, 0xd0, 0x70, 0x0a, 0x71, 0x68, 0xe5, 0xa3, 0x84,
+  0xf7, 0xf5, 0x1c, 0xdb, 0x21, 0xfc, 0x88, 0xa9, 0xaa, 0x3e, 0x9a, 0xdb,
+  0xa0, 0xcc, 0x3e, 0x1c, 0x4b, 0xf6, 0x93, 0xd0, 0xf1, 0x15, 0x3c, 0xf2,
+  0xe6, 0x80, 0x20, 0x9b, 0xd3, 0x92, 0x3f, 0xc8, 0xee, 0x82, 0xa3, 0x00,
+  0x9a, 0xe2, 0x50, 0x13, 0xb9, 0xba, 0x9a, 0xfc, 0x10, 0xdd, 0x2b, 0x0b,
+  0xd8, 0x85, 0x51, 0x87, 0x59, 0xf5, 0x2c, 0x71, 0xb0, 0xcd, 0xb0, 0x75,
+  0xf6, 0xb0, 0x91, 0xab, 0xdb, 0x06, 0x76, 0x34, 0xe1, 0x7c, 0x48, 0x55,
+  0xf7, 0x70, 0xee, 0xdc, 0xd3, 0xcf, 0x92, 0x88, 0xb3, 0x1b, 0x47, 0xd4,
+  0x6f, 0xe0, 0x55, 0xd4, 0x86, 0x80, 0xb3, 0x5b, 0xf1, 0x9d, 0x30, 0x4d,
+  0x06, 0xef, 0xd4, 0x5e, 0xb2, 0x1d, 0xbe, 0x51, 0xc0, 0x2e, 0xd9, 0x63,
+  0xe1, 0x58, 0x4e, 0x54, 0x87, 0x1c, 0x86, 0x79, 0x8e, 0x6c, 0x3f, 0xe8,
+  0xd9, 0xf1, 0xf5, 0xdc, 0x51, 0x55, 0xf5, 0xdd, 0x2c, 0x91, 0x81, 0xf7,
+  0xfb, 0x41, 0xbc, 0x6f, 0xfb, 0x70, 0x00, 0xfa, 0x46, 0xe6, 0x19, 0xdd,
+  0x7b, 0xa9, 0x9c, 0xf6, 0x10, 0x89, 0x9e, 0x25, 0xc1, 0x1c, 0x24, 0x7f,
+  0xa3, 0x04, 0x55, 0x79, 0xd0, 0x56, 0x55, 0xff, 0x61, 0x7c, 0x4e, 0x79,
+  0x1c, 0xd4, 0xbe, 0x81, 0x3b, 0x32, 0xa3, 0x7c, 0x5f, 0x4e, 0x7b, 0x48,
+  0x9b, 0x9e, 0x56, 0x46, 0xe7, 0x07, 0xbe, 0x89, 0x5f, 0xd6, 0x9f, 0xe4,
+  0x14, 0x39, 0xf5, 0x21, 0x3b, 0x04, 0x87, 0x46, 0x48, 0xb9, 0x6f, 0x14,
+  0xa0, 0xaa, 0xdf, 0x3f, 0xa3, 0xfe, 0x63, 0xc0, 0xff, 0x13, 0xcc, 0xf4,
+  0xcd, 0xfc, 0x3b, 0x95, 0x09, 0x00, 0xef, 0x40, 0x6e, 0x02, 0x38, 0xe7,
+  0x64, 0x1e, 0x27, 0x7e, 0x35, 0x36, 0x13, 0xd4, 0xbe, 0x52, 0x42, 0x6e,
+  0x0a, 0x3b, 0x66, 0xa6, 0x30, 0x0c, 0xa9, 0x6d, 0x1f, 0x17, 0xc3, 0xc7,
+  0xef, 0x0b, 0x62, 0x00, 0xf1, 0xf8, 0x95, 0xbb, 0x7f, 0x07, 0x47, 0xc7,
+  0x55, 0x59, 0x24, 0x81, 0xd8, 0x8d, 0x37, 0x0d, 0xa7, 0xce, 0xe6, 0x15,
+  0x25, 0x33, 0xe0, 0x66, 0x09, 0xb9, 0x32, 0x8a, 0x71, 0x11, 0x45, 0x52,
+  0x1c, 0xd6, 0x4b, 0x49, 0x4a, 0x76, 0xb3, 0x3b, 0x73, 0xf3, 0xb9, 0xaa,
+  0x04, 0x60, 0x53, 0x03, 0x27, 0x98, 0x70, 0xe7, 0x2c, 0x09, 0xf2, 0x7c,
+  0x9e, 0x21, 0x62, 0xe2, 0xd8, 0x3f, 0x3c, 0x7b, 0x95, 0x69, 0xd0, 0x38,
+  0x40, 0xcf, 0x8a, 0xd6, 0xcc, 0x0e, 0x9a, 0xc9, 0x49, 0x20, 0xb3, 0x78,
+  0x56, 0xd1, 0x3f, 0x8a, 0x33, 0x89, 0x2f, 0x30, 0xcf, 0xca, 0x0f, 0x9e,
+  0x94, 0x99, 0x06, 0x54, 0xc5, 0x95, 0x8d, 0x87, 0xb9, 0xae, 0x5c, 0xc1,
+  0xab, 0x32, 0xc9, 0xba, 0x3e, 0xa7, 0xea, 0x1a, 0x01, 0xae, 0xde, 0x2b,
+  0xf6, 0xcd, 0x55, 0xb9, 0x14, 0x2b, 0x33, 0x8f, 0x28, 0x2a, 0x46, 0xa8,
+  0x9f, 0xab, 0x12, 0xbe, 0xcc, 0xd7, 0x4b, 0x29, 0x7c, 0xfd, 0x33, 0xb6,
+  0xe5, 0x1e, 0x91, 0xb5, 0xc4, 0x8c, 0x33, 0xe7, 0x44, 0x49, 0xdf, 0xfa,
+  0xe5, 0x58, 0x9e, 0xe3, 0x52, 0xf7, 0x47, 0x2f, 0x70, 0x29, 0xa3, 0xec,
+  0x84, 0xdc, 0x8e, 0xcb, 0x9d, 0xcf, 0x2f, 0xa6, 0x8a, 0x3f, 0x51, 0x39,
+  0xd5, 0xdd, 0x00, 0x5e, 0x58, 0x56, 0x74, 0x27, 0x75, 0x94, 0x44, 0x51,
+  0xe2, 0x19, 0xbe, 0x90, 0x94, 0xf2, 0xf8, 0xfe, 0x41, 0x18, 0xfb, 0x54,
+  0x45, 0xc1, 0x77, 0x11, 0x0f, 0x8e, 0x35, 0xdc, 0x49, 0xbd, 0x8c, 0x43,
+  0x14, 0x43, 0x3c, 0xd2, 0x55, 0x32, 0xe0, 0x61, 0x95, 0x57, 0x55, 0x97,
+  0xc3, 0xac, 0x8a, 0xbe, 0x3b, 0xa8, 0x97, 0x48, 0x36, 0x0e, 0x02, 0x23,
+  0x57, 0xc9, 0xb8, 0x9f, 0x90, 0x79, 0x7b, 0x67, 0x25, 0x86, 0xdc, 0x63,
+  0x8a, 0xca, 0x3b, 0xa8, 0x17, 0xb1, 0x25, 0xb1, 0xd1, 0x22, 0x58, 0xc0,
+  0xac, 0xfc, 0x1e, 0xd4, 0x81, 0x0b, 0x96, 0xc2, 0x3a, 0xa3, 0x72, 0x2f,
+  0x66, 0xe6, 0x64, 0xab, 0xfe, 0x14, 0x62, 0x0e, 0x39, 0xd9, 0x10, 0x72,
+  0xae, 0x7a, 0xa1, 0x38, 0xac, 0xf2, 0x33, 0xaa, 0xda, 0x84, 0x3d, 0xb7,
+  0x9a, 0xcf, 0x73, 0xbd, 0x38, 0xfa, 0x30, 0x7b, 0xf0, 0xe5, 0x0d, 0x07,
+  0x5b, 0x72, 0x77, 0x99, 0xb9, 0xc7, 0x3c, 0xc6, 0x11, 0xfe, 0x19, 0xcd,
+  0x71, 0x10, 0xa1, 0xd5, 0x93, 0xc7, 0xd3, 0x7b, 0x49, 0x5c, 0x26, 0xd7,
+  0xa4, 0xbd, 0xf8, 0x1a, 0x87, 0x69, 0x67, 0x54, 0x7d, 0x0a, 0x94, 0x7c,
+  0x09, 0xdf, 0x57, 0x07, 0x71, 0xdc, 0xbf, 0xf2, 0xd6, 0xf5, 0x38, 0xa1,
+  0x95, 0x2f, 0x22, 0xa0, 0xd6, 0x53, 0xc4, 0xb0, 0xfd, 0xd4, 0x31, 0x9c,
+  0x90, 0xe4, 0x6e, 0x72, 0x90, 0x21, 0x3d, 0x86, 0x0f, 0x4e, 0x6e, 0x78,
+  0x98, 0xd3, 0x13, 0xe4, 0xb8, 0xf5, 0x53, 0x6f, 0xb2, 0xcc, 0x9e, 0x99,
+  0x2b, 0xe1, 0xcc, 0xa0, 0x60, 0xf6, 0x17, 0x59, 0xdc, 0xbd, 0x57, 0xb9,
+  0x4e, 0xc2, 0x5d, 0x33, 0x37, 0x0c, 0xe9, 0x04, 0x7b, 0xff, 0x9a, 0xe4,
+  0x32, 0xf2, 0x25, 0xf4, 0x2d, 0x45, 0x36, 0xe9, 0x03, 0xab, 0xbd, 0x81,
+  0xb3, 0x5c, 0x7c, 0x6f, 0x7d, 0x88, 0x62, 0xfe, 0xbb, 0x2a, 0x75, 0x00,
+  0xaf, 0x4b, 0x1f, 0xf5, 0x3a, 0x98, 0xe8, 0x00, 0xb9, 0xeb, 0xc6, 0x28,
+  0xe6, 0x9f, 0x14, 0xa1, 0xa4, 0x0f, 0x0c, 0x05, 0xf7, 0x63, 0xb8, 0x7c,
+  0xc1, 0xfd, 0x18, 0x52, 0x8a, 0x7f, 0x54, 0x84, 0x92, 0x3e, 0x90, 0xf1,
+  0x77, 0xe4, 0x02, 0x28, 0x5f, 0xa9, 0x7f, 0xab, 0x0a, 0xdd, 0x81, 0xf7,
+  0x49, 0x2f, 0x05, 0xf7, 0x70, 0x48, 0xa4, 0x79, 0x9a, 0x5c, 0xc4, 0xf9,
+  0xe3, 0x8a, 0x54, 0xd2, 0xc9, 0xe1, 0xa3, 0x07, 0xee, 0x92, 0x63, 0xe0,
+  0xbc, 0xef, 0xa5, 0xb8, 0xbf, 0x57, 0xc4, 0x92, 0x4e, 0x1a, 0xb6, 0x3b,
+  0xcd, 0x3f, 0x2d, 0x5f, 0xfa, 0x21, 0x6b, 0x81, 0xeb, 0xb4, 0x22, 0x78,
+  0x27, 0xbe, 0x98, 0x51, 0x47, 0x58, 0x86, 0xe6, 0x5f, 0xc0, 0xef, 0x0d,
+  0xc8, 0xfb, 0x02, 0x58, 0x87, 0xd7, 0x64, 0x6f, 0xc4, 0x91, 0xfe, 0x9f,
+  0xc2, 0xda, 0xbf, 0x42, 0xde, 0x31, 0x40, 0x2e, 0xde, 0xcb, 0xbf, 0x8a,
+  0x97, 0x7a, 0x37, 0x87, 0x7d, 0xdd, 0x51, 0x8e, 0xbf, 0x48, 0x1d, 0x47,
+  0x29, 0x34, 0x85, 0xfe, 0x16, 0x3d, 0x80, 0xae, 0x0b, 0xd7, 0xa5, 0xca,
+  0xba, 0xca, 0xca, 0x8a, 0x8a, 0x8c, 0xd2, 0x4e, 0xe9, 0x2d, 0xd4, 0x1d,
+  0xbe, 0x2e, 0x6c, 0x3c, 0xae, 0x51, 0xdf, 0x15, 0x19, 0xa5, 0x33, 0xd2,
+  0xeb, 0xc2, 0xf1, 0x07, 0x99, 0xb3, 0xc2, 0xf6, 0x53, 0xd3, 0xd2, 0x79,
+  0x66, 0xca, 0x88, 0x3f, 0x34, 0x48, 0xa7, 0xa6, 0x15, 0x0a, 0xe1, 0xac,
+  0x74, 0x66, 0xfb, 0xbf, 0x31, 0x29, 0x63, 0xb8, 0x08, 0xd5, 0xa1, 0x14,
+  0x83, 0x2b, 0xa6, 0xab, 0x30, 0xd5, 0x2d, 0xed, 0x9c, 0x9e, 0x79, 0xe7,
+  0x64, 0x0c, 0xcc, 0x08, 0x0a, 0x4f, 0x6b, 0x52, 0x0d, 0xd4, 0x97, 0x04,
+  0x61, 0x2a, 0xfc, 0x4a, 0x25, 0x55, 0x84, 0xf0, 0x3f, 0xe3, 0x65, 0xe9,
+  0x33, 0x24, 0xb7, 0xd5, 0x97, 0xfb, 0x57, 0xef, 0x85, 0x7f, 0x57, 0xd5,
+  0x44, 0xea, 0xbb, 0x8c, 0xa6, 0xbe, 0xa0, 0x89, 0x44, 0x00, 0xa1, 0x54,
+  0x19, 0x13, 0xee, 0x2a, 0xa2, 0x8e, 0xd7, 0x69, 0x72, 0xcd, 0x06, 0x65,
+  0x10, 0x43, 0xaa, 0x47, 0xda, 0x2e, 0x5d, 0x46, 0x75, 0x20, 0x22, 0xc5,
+  0xf4, 0x85, 0x8b, 0x8a, 0xae, 0xda, 0x34, 0x5e, 0xae, 0x6b, 0x98, 0x4a,
+  0xcd, 0x7a, 0xab, 0x96, 0xa2, 0xa6, 0x91, 0x14, 0xee, 0x49, 0x09, 0xd3,
+  0x46, 0x89, 0xb9, 0x3c, 0x76, 0xea, 0xf5, 0x07, 0xce, 0xac, 0xba, 0xf0,
+  0xee, 0x83, 0x0d, 0xc2, 0x9e, 0xb7, 0xc6, 0xc6, 0xa6, 0x7e, 0xf8, 0xa0,
+  0x41, 0x08, 0x6b, 0x66, 0x88, 0x85, 0xe3, 0x3d, 0xdb, 0x25, 0xcd, 0xb4,
+  0x30, 0xf5, 0x60, 0xfa, 0xc2, 0x5b, 0xe3, 0x4f, 0xec, 0x79, 0x50, 0x98,
+  0x6a, 0x48, 0x49, 0xdb, 0x2f, 0x33, 0x53, 0x9a, 0xdc, 0x6c, 0x7a, 0xd2,
+  0xa9, 0x6c, 0xf8, 0x33, 0x34, 0x4d, 0x4d, 0x31, 0x67, 0x35, 0x29, 0xe3,
+  0x71, 0x21, 0xdc, 0x80, 0x1e, 0xa0, 0x7e, 0xa7, 0xd9, 0x73, 0xd9, 0x38,
+  0xa5, 0x0a, 0x92, 0x7e, 0x77, 0x39, 0x75, 0x59, 0x93, 0x7a, 0x10, 0xfe,
+  0x19, 0xa5, 0x3f, 0x4d, 0x7f, 0xc1, 0x22, 0xb3, 0x6d, 0x6e, 0x94, 0xce,
+  0x4b, 0x75, 0xab, 0x7e, 0xfb, 0x99, 0xa6, 0xab, 0x01, 0x16, 0x40, 0x21,
+  0x68, 0x18, 0x97, 0xde, 0x04, 0x02, 0xd4, 0xc5, 0x1c, 0x37, 0x4e, 0x37,
+  0x9c, 0x65, 0x8e, 0x17, 0xa1, 0x07, 0x99, 0xa9, 0xeb, 0xa5, 0xb7, 0x66,
+  0x19, 0xec, 0xb7, 0x80, 0xec, 0x62, 0xc2, 0x65, 0x28, 0xa5, 0x41, 0x75,
+  0x54, 0xee, 0x83, 0x3a, 0x13, 0x75, 0x25, 0x67, 0x2f, 0xeb, 0x6c, 0x09,
+  0x29, 0x63, 0xea, 0xfa, 0xe3, 0xdd, 0xbf, 0x1d, 0x7f, 0xab, 0x6f, 0xb7,
+  0xe6, 0x4d, 0xcd, 0x59, 0xcd, 0x71, 0xbc, 0x3c, 0x65, 0xb0, 0x40, 0x5d,
+  0x60, 0xb2, 0xe3, 0xea, 0x3c, 0xf0, 0xb7, 0x1b, 0x6e, 0xbc, 0x6f, 0xab,
+  0xf5, 0xdb, 0x8d, 0xde, 0xc6, 0x8d, 0x35, 0xed, 0x8d, 0xeb, 0xbe, 0x03,
+  0x95, 0x77, 0xed, 0xba, 0xf5, 0xeb, 0xbc, 0xeb, 0x36, 0xb6, 0xf8, 0x97,
+  0xa9, 0xfd, 0xb7, 0xf8, 0x1b, 0xad, 0x1d, 0xf7, 0x76, 0x5a, 0x9b, 0x1b,
+  0x37, 0x36, 0xae, 0x69, 0x5c, 0x66, 0x55, 0x41, 0xed, 0x6f, 0xb9, 0xc5,
+  0xd7, 0xea, 0x6d, 0x99, 0xc1, 0xcf, 0xee, 0xb7, 0x7e, 0x0d, 0xfc, 0xb9,
+  0xfb, 0xf9, 0x11, 0xfc, 0x9d, 0xa7, 0xab, 0xff, 0x58, 0x3f, 0xf8, 0xcb,
+  0x7a, 0x7f, 0x9c, 0x87, 0x3c, 0xe4, 0x21, 0x0f, 0x79, 0xc8, 0x43, 0x1e,
+  0xf2, 0x90, 0x87, 0x3c, 0xe4, 0x21, 0x0f, 0x79, 0xc8, 0x43, 0x1e, 0xf2,
+  0x90, 0x87, 0x3c, 0xe4, 0x21, 0x0f, 0x79, 0xc8, 0x43, 0x1e, 0xf2, 0x90,
+  0x87, 0x3c, 0xe4, 0x21, 0x0f, 0x79, 0xc8, 0x43, 0x1e, 0xfe, 0xdf, 0x80,
+  0x1f, 0x41, 0x63, 0x7a, 0x8f, 0x0e, 0x71, 0x23, 0x33, 0x4f, 0x56, 0xf9,
+  0x3f, 0x03, 0x55, 0xff, 0x0b, 0xc5, 0x3f, 0xf9, 0x00, 0xc5, 0xbb, 0xa0,
+  0xb4, 0x43, 0x59, 0xb7, 0x71, 0x5d, 0x9d, 0xd3, 0x55, 0xbb, 0xf2, 0xcb,
+  0xff, 0x93, 0x80, 0x22, 0x1c, 0x28, 0x85, 0xbf, 0x23, 0xcc, 0x8f, 0xd0,
+  0x01, 0x3e, 0xc2, 0x45, 0x35, 0xe4, 0x6f, 0x16, 0x50, 0x51, 0x3d, 0xaa,
+  0x6c, 0xa5, 0x13, 0xd5, 0x8d, 0x3a, 0xb4, 0x16, 0xa1, 0xf8, 0x7e, 0x90,
+  0x43, 0x01, 0x45, 0xb5, 0x87, 0xfa, 0x30, 0x05, 0x9f, 0x37, 0x06, 0x56,
+  0x8d, 0xcd, 0xaf, 0x45, 0xb1, 0x0b, 0x5d, 0x7a, 0x34, 0xd2, 0xb5, 0x54,
+  0x14, 0x5b, 0x3d, 0x9d, 0xcd, 0x01, 0x6b, 0x84, 0x8f, 0xa6, 0x7f, 0x03,
+  0x72, 0xc7, 0x4a, 0xac, 0xd4, 0xae, 0xa5, 0x22, 0x75, 0x1a, 0x7f, 0xe3,
+  0xd8, 0x1e, 0x90, 0x24, 0x36, 0xc1, 0x8c, 0x5a, 0x82, 0xb5, 0xae, 0x25,
+  0x48, 0xfe, 0x1b, 0xaa, 0xd6, 0x0d, 0xeb, 0xd6, 0x97, 0x87, 0xf1, 0xb8,
+  0x05, 0xa3, 0x85, 0xef, 0xe9, 0x9b, 0x6f, 0xd8, 0xa6, 0xb5, 0xea, 0x63,
+  0x5a, 0xf9, 0x6f, 0xb3, 0x59, 0xf9, 0x98, 0x66, 0xd4, 0x19, 0x10, 0x23,
+  0x74, 0x8c, 0x05, 0x0d, 0x2a, 0x5b, 0xe5, 0xef, 0x2d, 0xbf, 0x04, 0x3a,
+  0x8c, 0x7c, 0x20, 0xeb, 0x82, 0x10, 0x15, 0x47, 0xc0, 0x5f, 0xe9, 0x90,
+  0xbf, 0x65, 0x2c, 0xb6, 0x6e, 0x7c, 0xeb, 0x5b, 0x54, 0x59, 0x2d, 0xd3,
+  0xa5, 0xf3, 0x68, 0x3d, 0x5c, 0xe7, 0xda, 0xf2, 0x82, 0x18, 0x7e, 0x4e,
+  0xee, 0x59, 0x5f, 0x5b, 0xd9, 0x8a, 0xbf, 0x29, 0x3c, 0x19, 0x9a, 0x0c,
+  0xea, 0x51, 0x09, 0xe2, 0x42, 0x9e, 0xc4, 0x2a, 0x5b, 0x89, 0x8d, 0x8a,
+  0x96, 0xda, 0x51, 0x8c, 0x0f, 0xde, 0x40, 0x3e, 0x15, 0xc0, 0x27, 0x43,
+  0x37, 0xdf, 0xc1, 0x6c, 0x02, 0x19, 0x8c, 0x69, 0xcd, 0xf4, 0x1e, 0x76,
+  0xeb, 0x07, 0x2f, 0xfb, 0x03, 0x6a, 0x3b, 0x19, 0x05, 0x7b, 0x23, 0x8b,
+  0x88, 0x9f, 0x66, 0xf2, 0x34, 0x89, 0x7c, 0x07, 0xc6, 0x70, 0xe4, 0x89,
+  0xdb, 0x26, 0x51, 0x1a, 0x53, 0x31, 0x66, 0x82, 0x31, 0x8b, 0xf8, 0x9b,
+  0xba, 0x62, 0x87, 0x80, 0xbf, 0xef, 0x88, 0x4a, 0x6d, 0x62, 0xeb, 0xb5,
+  0x0e, 0xed, 0xb8, 0x45, 0x34, 0x35, 0x63, 0x99, 0xf8, 0xaf, 0x8d, 0x9a,
+  0xd6, 0x4c, 0xc6, 0xa8, 0x6d, 0xd3, 0x5b, 0x27, 0x43, 0x78, 0x8e, 0x25,
+  0xe8, 0xab, 0xfe, 0xcf, 0x07, 0xac, 0x8f, 0x63, 0x9e, 0x43, 0x9d, 0xed,
+  0x66, 0x87, 0xbe, 0xe9, 0x07, 0x8e, 0xc9, 0x3b, 0x27, 0x37, 0xab, 0x33,
+  0x9b, 0xec, 0x98, 0x0c, 0xc8, 0x12, 0x64, 0x3a, 0x2e, 0xc1, 0x27, 0x4d,
+  0x4d, 0x74, 0xd4, 0x12, 0xa0, 0xde, 0xbe, 0x18, 0xc3, 0xfd, 0x7a, 0x34,
+  0x19, 0xd0, 0xa1, 0xf8, 0x5d, 0x77, 0x0c, 0x03, 0x11, 0x42, 0x61, 0x49,
+  0x42, 0x01, 0x84, 0x3c, 0xe1, 0x3b, 0x86, 0x69, 0x84, 0xff, 0xda, 0x2c,
+  0x8f, 0xea, 0x10, 0x92, 0x28, 0xe8, 0xac, 0x41, 0xc3, 0x12, 0xfe, 0xd3,
+  0x7d, 0x2c, 0xf9, 0x1e, 0xe0, 0x08, 0xc1, 0x95, 0x43, 0x9f, 0x15, 0xe1,
+  0x2f, 0x54, 0x2e, 0x42, 0x7b, 0xb7, 0xdd, 0x31, 0x2c, 0xd2, 0x22, 0x8d,
+  0xdb, 0xc3, 0xd0, 0xa6, 0xac, 0x94, 0x95, 0xe0, 0x7f, 0x78, 0xc7, 0xf0,
+  0x42, 0xb4, 0x85, 0xc6, 0xfb, 0x53, 0xd5, 0x3b, 0x0f, 0x79, 0xc8, 0x43,
+  0x1e, 0xf2, 0xf0, 0x1f, 0x03, 0xd3, 0x88, 0x31, 0xb1, 0xd0, 0x8a, 0xa3,
+  0xb3, 0x79, 0x44, 0xdc, 0x67, 0xb1, 0x8a, 0xad, 0xe6, 0x91, 0x8c, 0xd5,
+  0x72, 0x4a, 0x3f, 0x62, 0x48, 0xa2, 0xcf, 0x20, 0xaa, 0x40, 0x0f, 0xf9,
+  0x5b, 0xe0, 0xc8, 0x70, 0x4a, 0x8e, 0x8e, 0x57, 0xfe, 0x00, 0x0c, 0x17,
+  0x40, 0x5c, 0x1f, 0x81, 0xd2, 0x95, 0xc2, 0x7f, 0x1f, 0x01, 0x49, 0x7a,
+  0x40, 0xdf, 0x9e, 0x42, 0x47, 0x94, 0x21, 0x76, 0xcd, 0x1e, 0x4f, 0x0f,
+  0xb1, 0x7d, 0xa9, 0xa7, 0x08, 0x9e, 0x45, 0x1e, 0x34, 0x56, 0x1c, 0x2c,
+  0x0e, 0x15, 0xff, 0x97, 0xe2, 0x7b, 0x8a, 0xbf, 0xaf, 0x3f, 0x95, 0xb9,
+  0x6f, 0x59, 0xab, 0x01, 0xf0, 0x7f, 0xe3, 0x61, 0xe1, 0xa9, 0xf7, 0x30,
+  0x9d, 0x58, 0xfe, 0xd3, 0x29, 0x1c, 0x83, 0x8f, 0xc7, 0x8f, 0xa4, 0xe4,
+  0x58, 0xfc, 0x2a, 0xd4, 0x67, 0x11, 0x0a, 0xbc, 0x89, 0x3f, 0x4f, 0xa0,
+  0xf8, 0x3f, 0x41, 0x4d, 0x21, 0x76, 0x96, 0x7c, 0x83, 0x32, 0x1f, 0xfd,
+  0x88, 0x3e, 0x61, 0xe9, 0xb0, 0x58, 0xd1, 0xb8, 0xbb, 0xd3, 0xbd, 0xc9,
+  0xbd, 0xd9, 0x7d, 0xa7, 0xfb, 0x2e, 0xf7, 0xdd, 0xee, 0xbf, 0xd1, 0xa1,
+  0xd9, 0xb3, 0xf8, 0x57, 0x22, 0x17, 0x0d, 0x63, 0xbd, 0x4d, 0x63, 0x28,
+  0xae, 0xd5, 0xe6, 0xf7, 0x44, 0x1e, 0xf2, 0x90, 0x87, 0x3c, 0xe4, 0x21,
+  0x0f, 0x79, 0xc8, 0x43, 0x1e, 0xf2, 0x90, 0x87, 0x3c, 0xe4, 0x21, 0x0f,
+  0x79, 0xc8, 0x43, 0x1e, 0xf2, 0x90, 0x87, 0x3c, 0xe4, 0x21, 0x0f, 0x79,
+  0xc8, 0x43, 0x1e, 0xf2, 0x90, 0x87, 0x3c, 0xe4, 0xe1, 0xff, 0x3f, 0xf8,
+  0xbf, 0x1c, 0x72, 0x9b, 0x9b
+};
+
+/* aip (../rsrc/templates/ipalt.tmpl) */
+static const unsigned char ip_template_data_1[8502] = {
+  0x78, 0xda, 0xed, 0x7c, 0x7b, 0x78, 0x5b, 0xc5, 0xb5, 0xef, 0xcc, 0x7e,
+  0x49, 0xb2, 0x64, 0xeb, 0x91, 0x97, 0xe3, 0xb8, 0xd9, 0xd2, 0x96, 0xed,
+  0x38, 0xb1, 0x89, 0x2c, 0x29, 0x21, 0x4e, 0x30, 0x58, 0xb6, 0x62, 0x48,
+  0x4a, 0x88, 0x65, 0xc9, 0xb4, 0xb4, 0x1f, 0xe7, 0xa0, 0x87, 0x13, 0xe0,
+  0x5c, 0x0a, 0x4e, 0x0c, 0xa5, 0xfd, 0xee, 0xb9, 0x58, 0x71, 0xec, 0xc4,
+  0x42, 0xca, 0xcb, 0x4e, 0x42, 0x80, 0xd0, 0xba, 0xe5, 0xdd, 0x86, 0x57,
+  0x4b, 0x0f, 0xb4, 0x25, 0xa7, 0xe9, 0x39, 0xf7, 0x1e, 0xe0, 0x72, 0x6e,
+  0x6b, 0x49, 0x90, 0x72, 0xef, 0xd7, 0x7b, 0x90, 0x63, 0x20, 0xdc, 0x7e,
+  0x2d, 0x8d, 0x2c, 0xc7, 0x71, 0x12, 0x13, 0xdd, 0x35, 0xb3, 0xf7, 0x96,
+  0x1d, 0x08, 0xf0, 0x9d, 0xfb, 0xc7, 0x6d, 0xbf, 0xef, 0x68, 0x92, 0xd9,
+  0x33, 0x5a, 0xb3, 0xd6, 0x9a, 0xdf, 0xac, 0x99, 0x59, 0xb3, 0x66, 0x27,
+  0x12, 0x42, 0xc5, 0x54, 0x4c, 0xff, 0x71, 0x93, 0x66, 0x54, 0x9b, 0x5c,
+  0x64, 0xe2, 0xdf, 0x23, 0xe5, 0x8a, 0x96, 0x3a, 0x8f, 0x0e, 0x05, 0xbc,
+  0xde, 0xc6, 0x86, 0x46, 0xb7, 0x53, 0x87, 0x90, 0x09, 0x3d, 0x00, 0x2c,
+  0xf9, 0x3a, 0xa8, 0x3e, 0xb3, 0x13, 0x25, 0xd0, 0x2b, 0xe8, 0x58, 0x49,
+  0x52, 0x9f, 0x32, 0xa4, 0xf5, 0xbf, 0xb3, 0x6f, 0xd1, 0xb6, 0xd5, 0xaf,
+  0x2e, 0x6f, 0x43, 0x6d, 0x5c, 0xf2, 0x56, 0x67, 0x93, 0xf3, 0xfa, 0xa0,
+  0x60, 0x33, 0xdd, 0x70, 0x31, 0xae, 0x47, 0x3a, 0xaa, 0x57, 0x07, 0x7f,
+  0xa2, 0x0c, 0x42, 0x19, 0x0c, 0x1f, 0x5e, 0xe4, 0xe0, 0x61, 0x7d, 0xf2,
+  0xd6, 0x55, 0xba, 0xb6, 0x5b, 0xaa, 0x99, 0x98, 0xa9, 0xed, 0x93, 0x7d,
+  0x5b, 0xab, 0x08, 0x67, 0x3e, 0x2f, 0xa4, 0x5d, 0x03, 0xc6, 0x21, 0x9d,
+  0xc4, 0xbf, 0xdd, 0x1a, 0x2c, 0x39, 0xa0, 0xb3, 0xd5, 0xd9, 0x2c, 0x55,
+  0xf6, 0xa0, 0x9e, 0xca, 0xd7, 0xa3, 0x68, 0x1e, 0xd5, 0x77, 0x8f, 0xe4,
+  0x67, 0x10, 0x2b, 0xb5, 0xeb, 0x5e, 0x04, 0xcd, 0xa7, 0x84, 0xb4, 0x64,
+  0x17, 0x92, 0xfa, 0x16, 0x1d, 0xaa, 0x69, 0x27, 0x5c, 0xd3, 0xbd, 0xdc,
+  0x28, 0x13, 0x32, 0x8b, 0x86, 0x11, 0x1d, 0x3a, 0x7a, 0xed, 0x9f, 0x12,
+  0xd3, 0x80, 0xb3, 0xf1, 0x31, 0x94, 0xc8, 0xfa, 0xd1, 0x78, 0x83, 0x94,
+  0xf5, 0xe3, 0xed, 0x36, 0x91, 0x4d, 0x49, 0x91, 0x6c, 0x87, 0xcb, 0x39,
+  0x19, 0xd7, 0xf6, 0x12, 0x99, 0x26, 0x68, 0x97, 0xda, 0xdf, 0xed, 0x5d,
+  0x90, 0xd6, 0x7b, 0x75, 0x88, 0x41, 0x3a, 0x8f, 0xce, 0x63, 0x7c, 0x93,
+  0x71, 0x30, 0xc8, 0x3a, 0xbc, 0xd6, 0x7a, 0xe6, 0xad, 0x32, 0x8f, 0x29,
+  0xa5, 0x6f, 0x05, 0x04, 0xe2, 0x44, 0xd0, 0xf8, 0xa6, 0xd6, 0xa3, 0xf5,
+  0x30, 0xec, 0xbc, 0xa1, 0xe5, 0xf6, 0x6b, 0xac, 0x65, 0x9e, 0xf3, 0x3e,
+  0x6e, 0x90, 0x8d, 0xeb, 0x4e, 0xd5, 0x8a, 0x66, 0xe8, 0xf1, 0xbc, 0x0f,
+  0x0f, 0x32, 0xb1, 0xf3, 0x3e, 0x76, 0x50, 0x1b, 0xd7, 0x02, 0x4d, 0x03,
+  0x34, 0x63, 0xfe, 0x8f, 0xa0, 0xff, 0x96, 0x23, 0x28, 0x21, 0x8c, 0x95,
+  0x8b, 0x73, 0xb5, 0xbb, 0x14, 0xed, 0xd3, 0x9d, 0xe5, 0xb4, 0xe7, 0x82,
+  0x76, 0xa6, 0x7a, 0x78, 0xad, 0x54, 0x67, 0x25, 0x2d, 0x16, 0xda, 0x82,
+  0xdf, 0x37, 0x53, 0x04, 0x66, 0xfa, 0x49, 0x23, 0xa2, 0x71, 0xa7, 0x88,
+  0x4e, 0xd9, 0xc5, 0x52, 0xfa, 0x59, 0x10, 0xa7, 0x6e, 0x3e, 0xd7, 0xa9,
+  0xa7, 0x75, 0x5e, 0x3c, 0xdb, 0xa9, 0xa3, 0x35, 0x0e, 0xb8, 0x5c, 0x14,
+  0x95, 0x31, 0x9f, 0xcf, 0xdf, 0xbb, 0x1f, 0x25, 0x9a, 0x06, 0x50, 0x22,
+  0x01, 0xa5, 0xe5, 0x7b, 0x28, 0x51, 0x09, 0xb9, 0x0a, 0xf2, 0x44, 0x07,
+  0xde, 0x66, 0x11, 0x97, 0x0c, 0x4f, 0xf8, 0xdd, 0xae, 0xe9, 0x78, 0x36,
+  0x80, 0x7b, 0x9c, 0xe2, 0x82, 0xa1, 0x6c, 0x87, 0xdd, 0x89, 0xe3, 0x78,
+  0xdc, 0x2d, 0x6a, 0x53, 0x93, 0x1d, 0x92, 0x93, 0x89, 0xe5, 0x02, 0x8d,
+  0xf6, 0xd7, 0x63, 0x02, 0x58, 0x0e, 0xbd, 0x4f, 0xb4, 0xd7, 0xf6, 0xca,
+  0xf6, 0x36, 0x2d, 0x1b, 0x31, 0x46, 0xfb, 0x97, 0xa2, 0x0c, 0x42, 0xc7,
+  0xa4, 0xf6, 0xe9, 0xde, 0x16, 0x71, 0xc9, 0x3b, 0xd9, 0xce, 0x25, 0x14,
+  0xc1, 0x8b, 0x2f, 0x81, 0x35, 0x1d, 0xf7, 0xc3, 0xb3, 0xfc, 0x64, 0x78,
+  0xab, 0xed, 0x90, 0xed, 0xe0, 0x6a, 0x98, 0xb3, 0x85, 0x50, 0xff, 0xca,
+  0xa1, 0x25, 0x07, 0x1d, 0x50, 0x9f, 0x0f, 0xf5, 0xf2, 0x43, 0x0b, 0x0e,
+  0x2e, 0x87, 0xfa, 0x82, 0x87, 0x16, 0x1c, 0x5e, 0x00, 0x75, 0x93, 0x6c,
+  0x8b, 0xae, 0xdf, 0x82, 0xdc, 0x6a, 0xc8, 0xf2, 0x18, 0xb5, 0x4a, 0x7f,
+  0xc7, 0x51, 0x27, 0x7e, 0x07, 0xfd, 0x09, 0x71, 0xd8, 0xc0, 0xfe, 0x02,
+  0x75, 0xe0, 0x13, 0x27, 0x4e, 0xa0, 0x91, 0x07, 0x51, 0xe2, 0x08, 0xd8,
+  0xf8, 0x28, 0xe4, 0x11, 0xc8, 0x77, 0xc4, 0x51, 0x62, 0x53, 0x9c, 0xcc,
+  0xe9, 0x1f, 0x7b, 0x73, 0x11, 0x4b, 0x4f, 0x8b, 0x3d, 0x17, 0x36, 0x6d,
+  0xef, 0x90, 0x22, 0x62, 0xae, 0x53, 0xb6, 0x20, 0x23, 0x9e, 0x1f, 0xc8,
+  0xee, 0x98, 0x1e, 0xc0, 0x0e, 0x62, 0xc9, 0x6a, 0xb0, 0x51, 0xae, 0x23,
+  0xeb, 0xab, 0x44, 0x65, 0xc1, 0x4d, 0x83, 0xf3, 0xe2, 0x59, 0x1f, 0xee,
+  0x26, 0xf5, 0xce, 0xc1, 0xd2, 0xb8, 0xf8, 0x61, 0x6e, 0x4b, 0xae, 0x8b,
+  0xb9, 0x77, 0x09, 0x20, 0xcc, 0x06, 0x18, 0xb0, 0x4e, 0xd9, 0x08, 0x59,
+  0xa7, 0xc1, 0xa3, 0x28, 0x41, 0x65, 0x04, 0xb9, 0x5d, 0x4f, 0xda, 0xe9,
+  0xea, 0x9a, 0x08, 0x64, 0x3b, 0xdc, 0xce, 0x93, 0xf1, 0xf9, 0x0a, 0x62,
+  0xa9, 0xfd, 0x8d, 0xde, 0x9b, 0xc4, 0x5b, 0xc5, 0x5c, 0xd8, 0xb1, 0x3d,
+  0x28, 0xe5, 0x42, 0xdc, 0x36, 0x5d, 0x4a, 0x9b, 0x91, 0xe7, 0xc8, 0x91,
+  0x99, 0x41, 0xd6, 0x41, 0x1c, 0x2b, 0x05, 0x9d, 0x9f, 0x04, 0x9c, 0x21,
+  0x7e, 0x9b, 0xd9, 0xde, 0xa8, 0xc8, 0xe5, 0xf3, 0x1e, 0x18, 0xcb, 0x33,
+  0x8f, 0xa2, 0x44, 0x73, 0x46, 0x27, 0x56, 0x27, 0xcb, 0xc5, 0xea, 0xb4,
+  0xcb, 0x81, 0xc6, 0x2a, 0xc4, 0x05, 0xc0, 0x3d, 0x11, 0xb6, 0x46, 0x9a,
+  0x22, 0x20, 0xcf, 0x58, 0xdd, 0x38, 0x6e, 0x22, 0x94, 0x88, 0xab, 0xdf,
+  0x10, 0x9c, 0xf6, 0x1b, 0x5c, 0xb5, 0xe2, 0x44, 0x88, 0xdd, 0x66, 0x71,
+  0x5c, 0x80, 0xd9, 0x5c, 0x27, 0x9e, 0xf7, 0x5f, 0x80, 0xd9, 0xfc, 0x30,
+  0x8e, 0xc8, 0x28, 0x23, 0xa6, 0x1e, 0xb7, 0x38, 0xed, 0x97, 0xec, 0xb9,
+  0xc0, 0x44, 0xd8, 0x06, 0xfc, 0xae, 0x1d, 0xb9, 0xc0, 0xfc, 0x8c, 0x1b,
+  0x9e, 0xb9, 0x30, 0xb7, 0x5d, 0x9a, 0x97, 0x0b, 0x70, 0x99, 0xa6, 0x68,
+  0x6e, 0xab, 0xe9, 0xdb, 0x33, 0x37, 0x77, 0x6c, 0xf9, 0xa4, 0xb3, 0xa5,
+  0x4b, 0x46, 0xfa, 0x89, 0x7f, 0x22, 0xe2, 0x04, 0x7e, 0xa6, 0xdb, 0x16,
+  0x32, 0x38, 0xcd, 0x92, 0x8a, 0xf2, 0xee, 0x97, 0xd1, 0xb1, 0x27, 0x00,
+  0x67, 0x22, 0x46, 0xec, 0xfd, 0x51, 0x6f, 0x1b, 0xac, 0xbf, 0x8a, 0xc2,
+  0xfa, 0x73, 0x3a, 0xc8, 0x2a, 0x6d, 0x81, 0x9e, 0x17, 0x26, 0xcd, 0x62,
+  0xd6, 0x87, 0x82, 0x86, 0xa0, 0x75, 0x50, 0x13, 0xcf, 0x86, 0xd9, 0xed,
+  0x36, 0x47, 0x0e, 0xf0, 0xb9, 0x45, 0x07, 0xb4, 0x9e, 0xf5, 0xe7, 0x7c,
+  0xf5, 0xd4, 0xfa, 0x86, 0x78, 0x0e, 0xac, 0x5f, 0x4f, 0xad, 0x2f, 0xc4,
+  0xc5, 0x4c, 0x2e, 0x9a, 0x03, 0xab, 0xbb, 0xe9, 0x4e, 0x3a, 0xdb, 0x91,
+  0x83, 0x39, 0x22, 0x14, 0x22, 0xa7, 0x2d, 0xcc, 0x03, 0xe9, 0x3f, 0xdb,
+  0xc1, 0x6e, 0x83, 0x1e, 0x02, 0x0d, 0xe1, 0x5c, 0x3f, 0x72, 0x9d, 0x8b,
+  0x67, 0xfd, 0x64, 0x74, 0xd9, 0x88, 0xc1, 0xed, 0x74, 0x64, 0xc3, 0x0c,
+  0xf4, 0x36, 0x19, 0xc8, 0xc1, 0xbc, 0xfc, 0x22, 0x9e, 0x8d, 0x5c, 0xea,
+  0x71, 0x3a, 0xdc, 0x41, 0x58, 0x95, 0xca, 0x18, 0xca, 0x0b, 0x33, 0xf5,
+  0x7e, 0x6f, 0x69, 0x8a, 0xec, 0xaa, 0x55, 0xa2, 0x65, 0xc8, 0xe6, 0x30,
+  0xef, 0xcf, 0xee, 0x40, 0x99, 0xc9, 0x28, 0xca, 0x9c, 0x8d, 0x7e, 0xf3,
+  0xb4, 0xfe, 0x30, 0x99, 0x69, 0xed, 0xbd, 0x1a, 0x3a, 0xba, 0x4a, 0x45,
+  0xa6, 0x1e, 0xaf, 0xc0, 0x1e, 0x9c, 0xcf, 0xa3, 0xeb, 0xfe, 0x94, 0xb0,
+  0xbe, 0x8a, 0x12, 0xf7, 0xee, 0x21, 0x76, 0x78, 0x1f, 0x7c, 0x89, 0x5b,
+  0x5c, 0x90, 0xaa, 0x12, 0x97, 0x82, 0x0d, 0x6c, 0xa0, 0x87, 0x29, 0xe8,
+  0x59, 0xa2, 0xe8, 0x31, 0x52, 0x3d, 0x7a, 0xa5, 0xbf, 0x0b, 0x03, 0x65,
+  0xdd, 0xd8, 0x61, 0x00, 0xce, 0xb2, 0xd3, 0xe5, 0x1f, 0xca, 0x1c, 0xc2,
+  0x65, 0x3d, 0x3d, 0x89, 0xd4, 0x7e, 0x1e, 0x7a, 0x1c, 0x1d, 0x23, 0xfd,
+  0xdc, 0xf5, 0x43, 0xb2, 0xe7, 0x3e, 0xea, 0x45, 0xe3, 0xab, 0xc5, 0xc5,
+  0xef, 0x10, 0x89, 0xc5, 0x54, 0x02, 0x9d, 0xb2, 0xd1, 0x7d, 0x9f, 0x85,
+  0xbd, 0x9d, 0x8b, 0x68, 0x7b, 0x9a, 0x9c, 0xa6, 0x70, 0xd6, 0xd7, 0x84,
+  0x97, 0x86, 0x44, 0xa9, 0x82, 0x39, 0xeb, 0xab, 0x6f, 0xe0, 0xc5, 0xac,
+  0x1f, 0x6c, 0x22, 0x1a, 0xc6, 0xc9, 0x5a, 0xfd, 0x43, 0xdc, 0x00, 0xfb,
+  0xda, 0xe5, 0x30, 0x0e, 0x4f, 0x84, 0xd6, 0xda, 0x2c, 0x8e, 0xb3, 0xfe,
+  0x45, 0x4c, 0x05, 0x53, 0x2d, 0x9e, 0xf5, 0x7d, 0xda, 0x42, 0xcd, 0xf9,
+  0x0d, 0x60, 0xeb, 0x4d, 0x60, 0xf3, 0xd1, 0xe8, 0x6d, 0x23, 0x7f, 0xec,
+  0x5d, 0x2f, 0xce, 0x4b, 0x4d, 0x06, 0xac, 0x6e, 0x6b, 0xcc, 0x92, 0xb4,
+  0x44, 0x9c, 0xa2, 0x65, 0x94, 0x01, 0x3d, 0x28, 0x33, 0xb5, 0x63, 0x1e,
+  0xf4, 0x3f, 0xd9, 0x9f, 0x8f, 0x9e, 0x09, 0x5e, 0x8a, 0x66, 0x03, 0xe5,
+  0xde, 0x4b, 0x30, 0x1b, 0x30, 0x17, 0xe2, 0x44, 0xb8, 0xbc, 0x35, 0x4f,
+  0xea, 0x2e, 0xc9, 0x31, 0x35, 0x80, 0xbb, 0xa7, 0x76, 0x4c, 0x0d, 0x08,
+  0xe3, 0xee, 0x86, 0x8f, 0x60, 0xbf, 0x90, 0x1e, 0xee, 0x78, 0xe5, 0x76,
+  0xd4, 0x49, 0xfc, 0xa5, 0xe2, 0x93, 0x73, 0x91, 0x1a, 0xba, 0x7f, 0xab,
+  0x60, 0xff, 0xde, 0x01, 0x3e, 0x4f, 0x72, 0x4c, 0xfb, 0x0c, 0x20, 0x8f,
+  0xdf, 0xe0, 0x63, 0x6c, 0xe6, 0x5c, 0x94, 0x01, 0x1f, 0xc5, 0x41, 0x5f,
+  0x18, 0xea, 0xc4, 0x5f, 0xc9, 0xad, 0xdc, 0x1b, 0x38, 0x86, 0x09, 0x6f,
+  0xc0, 0x15, 0xae, 0xa1, 0x7e, 0xf0, 0x26, 0xe0, 0x99, 0x02, 0x7b, 0x2c,
+  0x14, 0xf3, 0xdb, 0x4c, 0x11, 0x31, 0xb3, 0xca, 0x98, 0x0b, 0x68, 0x4f,
+  0x35, 0xba, 0xaa, 0xc5, 0x6b, 0xa1, 0x45, 0xcc, 0xcc, 0xb0, 0x4d, 0x91,
+  0xb3, 0xfe, 0xba, 0xf0, 0x55, 0xde, 0x73, 0x20, 0xaf, 0xb3, 0xaf, 0x02,
+  0x5f, 0x8f, 0x07, 0x71, 0xbc, 0xd1, 0xbe, 0x24, 0x36, 0xed, 0x9b, 0xfc,
+  0x9a, 0xf6, 0x7a, 0xc6, 0x77, 0xb7, 0x30, 0xed, 0x63, 0x06, 0x26, 0x3a,
+  0x64, 0xef, 0x46, 0x30, 0xd9, 0xb6, 0x18, 0x56, 0xcb, 0xb4, 0x45, 0x0a,
+  0xad, 0x66, 0xbb, 0xad, 0xcb, 0xb0, 0x4a, 0x3e, 0x49, 0x26, 0xc0, 0x1f,
+  0x48, 0x22, 0x60, 0x18, 0x60, 0x23, 0xd3, 0x1d, 0xf3, 0x06, 0x8c, 0xf6,
+  0x0a, 0xc4, 0xba, 0x70, 0x9c, 0xac, 0xe5, 0x5c, 0xe0, 0xac, 0x9f, 0xf4,
+  0x7e, 0xb6, 0xc3, 0xdc, 0xf2, 0xab, 0x18, 0xec, 0xc8, 0x01, 0x36, 0x3c,
+  0x1d, 0x70, 0x0f, 0x18, 0xa5, 0x0a, 0x34, 0x11, 0x60, 0xdd, 0xcf, 0xc4,
+  0x6b, 0x0b, 0x7e, 0xe0, 0x5f, 0xe1, 0xec, 0xa8, 0x7d, 0x04, 0x6c, 0xfe,
+  0x20, 0xb1, 0x09, 0xf1, 0xb1, 0x7e, 0xc7, 0xc4, 0x56, 0xe1, 0x1d, 0xe1,
+  0x6d, 0xcd, 0x65, 0xbe, 0x51, 0x2d, 0xd1, 0x09, 0x0b, 0x42, 0x9e, 0x3f,
+  0x25, 0xee, 0x82, 0xb3, 0xef, 0x4c, 0xaf, 0x57, 0xf4, 0x8b, 0x21, 0xb1,
+  0x34, 0x25, 0x39, 0x26, 0x02, 0xf3, 0x0f, 0x34, 0x3a, 0xe7, 0x85, 0xb5,
+  0x2d, 0xf5, 0x4e, 0x6d, 0x0b, 0xf9, 0x83, 0x5a, 0x72, 0x3e, 0xad, 0xb3,
+  0x64, 0x88, 0x7c, 0x9e, 0x88, 0x54, 0xba, 0x5d, 0x8e, 0x6c, 0x87, 0xc5,
+  0x6e, 0xa2, 0x33, 0xf1, 0x1e, 0xee, 0x65, 0x60, 0xbd, 0x81, 0x9e, 0xc9,
+  0xde, 0x56, 0xb1, 0x43, 0xd4, 0x83, 0xf7, 0xc9, 0xfa, 0xed, 0x11, 0x6d,
+  0x6b, 0x93, 0x4b, 0xdb, 0x4a, 0xfe, 0xa0, 0xd6, 0x89, 0x8e, 0x4a, 0xa8,
+  0x4f, 0x44, 0xea, 0x41, 0xd2, 0x15, 0x34, 0x50, 0x39, 0xf9, 0x49, 0xe4,
+  0x08, 0xd6, 0x8a, 0x94, 0x8d, 0xd8, 0xdf, 0x91, 0xed, 0x5c, 0x7c, 0x19,
+  0xd6, 0x5d, 0x0e, 0xa9, 0xfd, 0x0c, 0xcc, 0x6e, 0x19, 0x9d, 0x5d, 0x03,
+  0xcc, 0x6e, 0x2e, 0x52, 0xd2, 0x13, 0x82, 0xba, 0x76, 0xfb, 0x36, 0xa9,
+  0x34, 0xed, 0xa4, 0x73, 0x3d, 0x35, 0x60, 0x1e, 0xd6, 0xba, 0xdd, 0x61,
+  0xad, 0xb7, 0xde, 0xad, 0xf5, 0x92, 0x3f, 0xc8, 0x7b, 0x6e, 0x40, 0xeb,
+  0xd6, 0x0c, 0x91, 0xcf, 0xd9, 0x8e, 0x26, 0xa7, 0x99, 0xfa, 0x8f, 0x59,
+  0xac, 0x0d, 0x3b, 0xc9, 0x59, 0xcf, 0xc1, 0xda, 0x9e, 0xd9, 0x6e, 0xbf,
+  0x23, 0xdb, 0xe9, 0x01, 0xbf, 0xcc, 0xd4, 0x9e, 0x85, 0x19, 0x20, 0x72,
+  0x64, 0xd7, 0xe3, 0xee, 0x89, 0x90, 0x8c, 0x85, 0x0d, 0xab, 0xf4, 0x06,
+  0x97, 0x2e, 0x7e, 0x0e, 0xea, 0x67, 0xa1, 0x6e, 0x9d, 0xa3, 0x7b, 0x22,
+  0x82, 0x7b, 0x5c, 0x8e, 0xc9, 0x81, 0x45, 0x9f, 0x41, 0x41, 0x38, 0xf5,
+  0x94, 0x53, 0x93, 0xac, 0x74, 0x67, 0x7d, 0xae, 0x86, 0x7f, 0x8e, 0x9b,
+  0x60, 0x6c, 0x53, 0x77, 0x90, 0xd1, 0xf5, 0x32, 0xef, 0xc1, 0x5e, 0x25,
+  0x73, 0x26, 0xdb, 0x81, 0xec, 0x94, 0xdc, 0xed, 0x65, 0xf7, 0xe7, 0xb6,
+  0x96, 0x7e, 0x3b, 0xb7, 0xc5, 0x70, 0xdf, 0x64, 0x67, 0x6b, 0xd7, 0x3d,
+  0x80, 0x2c, 0x77, 0x7b, 0x09, 0xd0, 0x74, 0x40, 0xd3, 0xde, 0x37, 0xe9,
+  0xb7, 0x75, 0x6e, 0xa1, 0x34, 0x01, 0x68, 0x3c, 0xd0, 0x38, 0xa0, 0x75,
+  0xec, 0x5f, 0xc9, 0x7d, 0x93, 0x52, 0x19, 0xa0, 0x62, 0xa0, 0x4e, 0xfa,
+  0x37, 0x00, 0xcd, 0x07, 0xb4, 0x19, 0x58, 0xa9, 0x6c, 0x04, 0x79, 0x9a,
+  0x1a, 0xd8, 0xd0, 0x34, 0xd9, 0x53, 0xce, 0x49, 0xfa, 0x3c, 0x03, 0x27,
+  0x43, 0x93, 0x53, 0xc8, 0xc8, 0xeb, 0xb4, 0xd6, 0xc3, 0x86, 0x3f, 0x99,
+  0xc3, 0x79, 0x9e, 0xf2, 0x9c, 0xa5, 0xcf, 0x2c, 0x7d, 0x0a, 0x19, 0xf9,
+  0x54, 0x2c, 0xf7, 0xd4, 0x59, 0xd9, 0xf0, 0xa5, 0x39, 0xbc, 0x17, 0x68,
+  0xfb, 0x14, 0x7d, 0x4e, 0x28, 0xbc, 0xb2, 0x57, 0xaa, 0xb3, 0xf2, 0xe9,
+  0xb5, 0x56, 0xf5, 0x8c, 0x43, 0x25, 0x5c, 0x89, 0xbc, 0x4e, 0x21, 0xd4,
+  0x40, 0x2a, 0x55, 0x5d, 0x7b, 0xdb, 0x1d, 0x13, 0xfe, 0x5c, 0x60, 0xb9,
+  0x97, 0xc4, 0x5f, 0xb9, 0xc0, 0x62, 0x28, 0x27, 0xc2, 0xb9, 0x40, 0x83,
+  0x24, 0xaf, 0xb3, 0x7c, 0x5e, 0x6a, 0x1f, 0xed, 0xbd, 0x51, 0xfc, 0xa6,
+  0x48, 0xf6, 0x7a, 0x88, 0xee, 0xf5, 0x6d, 0xd2, 0xc5, 0x80, 0xcb, 0x5f,
+  0x0b, 0xbb, 0x99, 0x9c, 0x18, 0x37, 0x0d, 0x72, 0xf1, 0x69, 0xea, 0xcf,
+  0xfd, 0x83, 0x6c, 0xac, 0x41, 0xd1, 0x3e, 0x0d, 0x1e, 0xac, 0x56, 0xb4,
+  0x77, 0xd9, 0x5f, 0x22, 0x11, 0xd0, 0xc5, 0xc0, 0x14, 0x9c, 0x6a, 0xd3,
+  0x01, 0x6d, 0x4f, 0xa3, 0xe8, 0xee, 0x5a, 0x5c, 0xa0, 0xb9, 0x3a, 0xea,
+  0x9d, 0x0b, 0x60, 0x0f, 0x72, 0x94, 0x5e, 0xaa, 0xd0, 0x67, 0x06, 0xae,
+  0xde, 0xa1, 0xd2, 0xd8, 0x02, 0x6d, 0x4d, 0x81, 0x76, 0xfe, 0x45, 0x95,
+  0xd6, 0x58, 0xa0, 0xfd, 0xb9, 0x40, 0x5b, 0xab, 0xd0, 0xd0, 0xa9, 0x2a,
+  0x91, 0x9c, 0xbc, 0xd3, 0x9d, 0x63, 0x72, 0x9b, 0x6f, 0x32, 0xa0, 0xf5,
+  0x62, 0xdf, 0x94, 0xbf, 0x86, 0x95, 0x39, 0x26, 0xc1, 0x03, 0x54, 0x81,
+  0xcc, 0xda, 0x81, 0xc9, 0x00, 0xe3, 0xfe, 0x43, 0xfc, 0xac, 0x4f, 0x2b,
+  0xa2, 0x0c, 0x9c, 0x2a, 0xf4, 0x64, 0xac, 0x12, 0xef, 0x21, 0x9e, 0x60,
+  0xab, 0x48, 0xe7, 0x7a, 0xba, 0xf3, 0x3b, 0x64, 0xad, 0x02, 0x56, 0x83,
+  0xbb, 0x51, 0xbc, 0xe0, 0xe3, 0xc8, 0x69, 0x3b, 0x28, 0xc2, 0x19, 0x38,
+  0xc3, 0x5c, 0x08, 0xac, 0x86, 0x53, 0x6d, 0x31, 0xc4, 0x67, 0x93, 0xfe,
+  0x26, 0x57, 0x95, 0x98, 0x1d, 0x60, 0x43, 0x4d, 0xce, 0x8b, 0x3e, 0x61,
+  0xa0, 0x84, 0xce, 0x46, 0x36, 0x6c, 0x70, 0xd9, 0x1c, 0xd9, 0x81, 0x6c,
+  0x87, 0x81, 0x52, 0xe5, 0x39, 0xca, 0xee, 0x68, 0x1e, 0x21, 0xa7, 0x81,
+  0x5d, 0x5c, 0x43, 0xcf, 0xca, 0xe8, 0xc3, 0xe0, 0x0f, 0x60, 0x4d, 0x66,
+  0x07, 0x72, 0xa1, 0x9a, 0x6d, 0xe6, 0x88, 0xbb, 0x61, 0x51, 0x2c, 0x1b,
+  0xae, 0xca, 0x7c, 0xc2, 0xba, 0x5d, 0x96, 0xd8, 0x45, 0x5f, 0x2e, 0x24,
+  0x6e, 0x33, 0x6d, 0xbd, 0x6b, 0xab, 0xf6, 0x7a, 0x0c, 0xbe, 0xee, 0xc2,
+  0xcd, 0x1d, 0x03, 0x59, 0xf0, 0x6f, 0x17, 0x20, 0x06, 0xc8, 0x0e, 0x18,
+  0x56, 0xcd, 0xa7, 0x3a, 0xe5, 0x11, 0x65, 0xc1, 0x73, 0x67, 0x77, 0x18,
+  0x83, 0x6c, 0xf8, 0x62, 0xe0, 0xea, 0x01, 0xd6, 0xc5, 0xc5, 0xc9, 0xa8,
+  0xb2, 0xb0, 0x5b, 0x9c, 0x8e, 0x1c, 0x70, 0xd8, 0xe1, 0x24, 0xce, 0x41,
+  0x84, 0xfd, 0x66, 0x9c, 0xb6, 0x47, 0x2e, 0xfa, 0x97, 0x51, 0xef, 0x47,
+  0xac, 0xb0, 0x2b, 0xae, 0xce, 0x20, 0xf1, 0x67, 0xea, 0x1a, 0x99, 0xf0,
+  0x81, 0x97, 0xb0, 0x12, 0x9f, 0x9d, 0xa3, 0x73, 0x1e, 0x7d, 0x43, 0x1b,
+  0x07, 0xff, 0x39, 0xee, 0xa2, 0x6b, 0xa6, 0x21, 0x64, 0x92, 0x96, 0xc2,
+  0x18, 0xc8, 0xa9, 0x32, 0x11, 0xd0, 0x9c, 0x72, 0x85, 0xae, 0x6a, 0xb1,
+  0xd8, 0x27, 0x02, 0x24, 0x56, 0x60, 0xc5, 0x7c, 0x37, 0x91, 0xe8, 0x7d,
+  0xd3, 0x15, 0xd2, 0xdb, 0x80, 0x4a, 0xf7, 0xac, 0xaa, 0xe5, 0x74, 0x5c,
+  0x95, 0x9f, 0x08, 0xca, 0xeb, 0x4d, 0x7e, 0xce, 0xf4, 0xb6, 0x3a, 0x26,
+  0x82, 0x28, 0xc8, 0xd1, 0x4f, 0xf2, 0x93, 0x78, 0x24, 0x2f, 0xf1, 0x3b,
+  0x34, 0xbe, 0xb6, 0x90, 0x13, 0x34, 0x90, 0xeb, 0x6c, 0x5a, 0xf5, 0xd1,
+  0xaf, 0x60, 0x96, 0xa2, 0x65, 0xa0, 0x2f, 0x1b, 0x20, 0x7b, 0xff, 0x5a,
+  0xcf, 0x04, 0xcc, 0x91, 0x4b, 0x94, 0xe3, 0x3d, 0x6e, 0x9c, 0xdc, 0x25,
+  0xfe, 0x4f, 0x7c, 0xc2, 0x67, 0x52, 0x63, 0x62, 0xa5, 0x94, 0xfd, 0x66,
+  0x18, 0x56, 0xbf, 0xb6, 0x35, 0x1b, 0x70, 0x87, 0xb4, 0xde, 0x4a, 0x77,
+  0x39, 0xc8, 0x83, 0xff, 0x4c, 0x37, 0xb9, 0x26, 0x42, 0x16, 0xc9, 0xa0,
+  0xf4, 0x4b, 0xd1, 0x74, 0xbd, 0xfb, 0x53, 0x82, 0x44, 0xd9, 0x51, 0x70,
+  0x3f, 0x22, 0x54, 0xed, 0xa9, 0x05, 0x70, 0xc3, 0x21, 0xb1, 0xdb, 0xbc,
+  0xb4, 0x2b, 0xa8, 0x7d, 0xe3, 0x62, 0x8c, 0x9c, 0x4b, 0xa5, 0x71, 0x53,
+  0xda, 0x15, 0x36, 0xc1, 0x4d, 0x67, 0x7d, 0x66, 0x21, 0x03, 0xbe, 0x3d,
+  0x52, 0x06, 0x75, 0xcb, 0xfe, 0x85, 0x2c, 0x89, 0x24, 0x75, 0xd0, 0x56,
+  0x92, 0xb4, 0x04, 0xb5, 0x6f, 0xe9, 0x86, 0xeb, 0xdd, 0x8c, 0x9d, 0x87,
+  0xcf, 0x68, 0x8c, 0x70, 0xca, 0xe3, 0xfc, 0x08, 0xd6, 0x02, 0xba, 0xf3,
+  0xb6, 0x91, 0x8f, 0xe0, 0x8c, 0xad, 0x82, 0x3b, 0x52, 0xf9, 0xb5, 0x7f,
+  0x52, 0x62, 0x37, 0x09, 0x38, 0xa5, 0xd0, 0x7c, 0x91, 0xf0, 0x5b, 0x2c,
+  0x62, 0xca, 0x0a, 0x63, 0xae, 0xf5, 0x68, 0xdf, 0x5a, 0x9a, 0x64, 0x6c,
+  0x86, 0xf1, 0xaf, 0x8c, 0xba, 0xac, 0x67, 0x7d, 0x3a, 0x88, 0xcb, 0x96,
+  0xa4, 0x97, 0xa4, 0x5c, 0xc1, 0x3a, 0x2b, 0x43, 0x91, 0xcd, 0x4f, 0xbb,
+  0x42, 0xe5, 0x29, 0x4f, 0xa6, 0x06, 0xa3, 0xf7, 0x9f, 0x00, 0x5b, 0x55,
+  0x0c, 0xd9, 0x45, 0x23, 0xc4, 0x03, 0x39, 0x7f, 0xfd, 0x3c, 0x4b, 0x64,
+  0x5e, 0x6a, 0xde, 0xfe, 0x1a, 0xd6, 0x12, 0x31, 0xa7, 0x4c, 0xb4, 0x34,
+  0xa5, 0x4a, 0xa1, 0x34, 0x0c, 0x5b, 0xc2, 0x4d, 0x2e, 0x1b, 0xc4, 0x3e,
+  0x10, 0x2f, 0x80, 0xc5, 0x49, 0x0c, 0x8e, 0xf1, 0x8b, 0xe8, 0x65, 0xf4,
+  0x2a, 0x42, 0xe0, 0xcb, 0x09, 0xb6, 0x7a, 0xb8, 0x53, 0x10, 0x6c, 0x04,
+  0x23, 0x42, 0x51, 0x44, 0x62, 0xfd, 0xde, 0xde, 0x5e, 0xa4, 0xc9, 0x23,
+  0x74, 0x09, 0x72, 0xb6, 0x83, 0x83, 0x98, 0x6f, 0x66, 0x1b, 0x44, 0xbe,
+  0x36, 0xfb, 0xf0, 0x44, 0xb8, 0x11, 0x62, 0x0a, 0xf9, 0x3e, 0xf3, 0x15,
+  0x7a, 0x9f, 0xf9, 0x38, 0x4e, 0x50, 0xc0, 0x9a, 0x02, 0x14, 0xd0, 0xc7,
+  0x3c, 0x03, 0x44, 0x27, 0xe8, 0x14, 0x41, 0x01, 0xd6, 0x81, 0x9a, 0x01,
+  0x6a, 0x93, 0x9f, 0x89, 0x71, 0x30, 0x8e, 0xa2, 0x7e, 0xed, 0xa0, 0x56,
+  0xc6, 0xf0, 0x3e, 0xe4, 0x99, 0xde, 0xf5, 0x60, 0xe1, 0xf5, 0xc9, 0xfb,
+  0xc0, 0xbe, 0x52, 0xc4, 0x9b, 0xdc, 0x4e, 0x4b, 0x34, 0x76, 0x0f, 0x2d,
+  0x3d, 0xc9, 0xbb, 0x68, 0xd9, 0x9c, 0xbc, 0x93, 0x96, 0xd7, 0x25, 0xb7,
+  0xd2, 0xb2, 0x31, 0x19, 0xa1, 0xe5, 0x35, 0xc9, 0x20, 0x2d, 0xd7, 0xc1,
+  0x0c, 0xe5, 0xb7, 0xd5, 0xb6, 0xac, 0x1d, 0xd5, 0xd9, 0xee, 0xc8, 0x10,
+  0xca, 0x1a, 0x85, 0xb2, 0x0a, 0x28, 0x77, 0x51, 0xca, 0xaa, 0xe4, 0x8d,
+  0x94, 0xd7, 0x0d, 0x2d, 0x37, 0xd0, 0x9a, 0x13, 0x6a, 0x5e, 0x5a, 0x6b,
+  0x80, 0x5a, 0x33, 0xad, 0xad, 0x84, 0xda, 0x35, 0xb4, 0x76, 0x15, 0xd4,
+  0xd6, 0xd0, 0x5a, 0x1d, 0xcc, 0x77, 0x70, 0xac, 0xc9, 0xc9, 0xd8, 0xa4,
+  0xc8, 0x72, 0xa8, 0x77, 0x29, 0xf5, 0x65, 0xc0, 0xb1, 0x81, 0xea, 0xae,
+  0x81, 0xda, 0x26, 0x5a, 0xab, 0x82, 0x76, 0x9f, 0xd2, 0x2e, 0x41, 0xbd,
+  0x53, 0xa9, 0x5b, 0x81, 0xe3, 0x56, 0xca, 0x41, 0x62, 0xa2, 0x2a, 0x5c,
+  0x8f, 0x6b, 0x71, 0x03, 0x6e, 0x82, 0xf8, 0xb6, 0x0b, 0xaf, 0xc7, 0x26,
+  0x3c, 0x8a, 0xde, 0x46, 0xbf, 0x47, 0xef, 0xc2, 0x5d, 0x4f, 0xb6, 0x4d,
+  0xb4, 0xc6, 0x80, 0xd0, 0x47, 0x3a, 0xe4, 0x39, 0x0d, 0xab, 0x13, 0x95,
+  0x21, 0x96, 0x31, 0x91, 0xab, 0x7e, 0x14, 0xd1, 0xf9, 0xca, 0x6b, 0x38,
+  0x28, 0xd7, 0x36, 0xeb, 0xd0, 0x7a, 0x28, 0x37, 0x41, 0xf6, 0x41, 0xee,
+  0x84, 0x7c, 0x0b, 0xe4, 0x46, 0xc8, 0x1e, 0xc8, 0xb5, 0x90, 0xeb, 0x21,
+  0xaf, 0x82, 0xdc, 0x04, 0xb9, 0x01, 0x32, 0x19, 0xd5, 0x4d, 0x74, 0x54,
+  0x78, 0xec, 0x5e, 0x8a, 0x67, 0x45, 0xf2, 0xef, 0x69, 0xa9, 0x19, 0x6b,
+  0xa5, 0xf4, 0x65, 0x49, 0x62, 0x89, 0x9a, 0xd7, 0xb5, 0xb9, 0x75, 0x79,
+  0x29, 0x52, 0x9d, 0xfc, 0x4e, 0x46, 0x9e, 0x91, 0xd5, 0xb4, 0x35, 0x17,
+  0xb2, 0x04, 0x9d, 0x07, 0xe4, 0x31, 0x89, 0xc9, 0xab, 0x28, 0x2d, 0x3f,
+  0xb6, 0x82, 0x96, 0x95, 0xc9, 0x65, 0xb4, 0x5c, 0x02, 0x7d, 0xd8, 0x69,
+  0xad, 0x02, 0x6a, 0x1e, 0x2a, 0x5f, 0x0e, 0xb5, 0x0a, 0xa0, 0xc9, 0xbb,
+  0x84, 0xc4, 0x59, 0x59, 0x58, 0xed, 0xcb, 0xe3, 0xf3, 0xc8, 0xae, 0x00,
+  0x6f, 0x81, 0xc9, 0xad, 0xdd, 0x5e, 0x07, 0xb6, 0x79, 0x03, 0x06, 0x59,
+  0x8e, 0xfb, 0xd1, 0x20, 0x1c, 0xf0, 0xaf, 0xa1, 0x13, 0xe8, 0x7d, 0x34,
+  0x09, 0x36, 0xd9, 0x00, 0xd8, 0xef, 0x7f, 0x6f, 0x19, 0xf2, 0x44, 0x11,
+  0x5a, 0xf4, 0x4a, 0xb2, 0x11, 0x4c, 0xd1, 0x0c, 0xf6, 0x20, 0x6f, 0x3c,
+  0xf2, 0x26, 0x68, 0x9b, 0x0f, 0xf9, 0x56, 0x62, 0x9b, 0xfa, 0xee, 0x91,
+  0x25, 0x34, 0xe2, 0x26, 0x3a, 0x57, 0x0e, 0x5f, 0x63, 0x65, 0x1c, 0x8b,
+  0x52, 0x8c, 0x24, 0xbf, 0x8d, 0x90, 0x9f, 0xc4, 0x77, 0xe0, 0xb1, 0x79,
+  0x69, 0x8b, 0x1d, 0x9d, 0xb2, 0x8c, 0x4a, 0xd6, 0xca, 0x03, 0x96, 0x94,
+  0x45, 0xb2, 0x24, 0x4d, 0x70, 0xb6, 0xd7, 0x7a, 0xcd, 0xb0, 0x13, 0x0d,
+  0xe0, 0x0f, 0x0c, 0x6f, 0x31, 0x76, 0x88, 0xcb, 0x82, 0x02, 0x94, 0x1c,
+  0x44, 0xfd, 0x13, 0x3e, 0xe3, 0x9b, 0x78, 0x70, 0x7e, 0x8c, 0x19, 0x6c,
+  0x8d, 0x71, 0x83, 0x75, 0x31, 0xea, 0xff, 0x59, 0x44, 0xee, 0x0d, 0xd0,
+  0x67, 0x95, 0x62, 0x6f, 0x32, 0x1f, 0xea, 0xde, 0xf2, 0x0e, 0x4f, 0xf8,
+  0xd6, 0x5a, 0x4d, 0x6f, 0x31, 0xa2, 0x35, 0x65, 0x4d, 0x82, 0x5d, 0xec,
+  0x2e, 0x09, 0xf6, 0x3d, 0xf8, 0x1c, 0xeb, 0xa8, 0x15, 0x30, 0x59, 0x93,
+  0xb6, 0x51, 0x8b, 0xd5, 0x96, 0xb6, 0x25, 0x5d, 0x36, 0x5b, 0x4a, 0x02,
+  0x7a, 0x00, 0x74, 0xda, 0x92, 0x8b, 0x80, 0x6a, 0x4d, 0x97, 0xa7, 0x5c,
+  0x92, 0x15, 0xfa, 0xdf, 0x0f, 0xfd, 0x8b, 0xc9, 0x72, 0x40, 0xbb, 0x74,
+  0x74, 0x01, 0xf8, 0x8a, 0xa5, 0xa9, 0x45, 0x80, 0xf9, 0x3a, 0xe0, 0x34,
+  0x24, 0x4b, 0x81, 0x5a, 0x9a, 0x2a, 0x85, 0xcf, 0x0b, 0x52, 0x52, 0xd0,
+  0xf7, 0x16, 0x23, 0x95, 0x26, 0xcb, 0x60, 0x2c, 0x0b, 0x47, 0x4b, 0x80,
+  0x73, 0x41, 0xba, 0x14, 0xc6, 0xb2, 0x9c, 0xbe, 0xa5, 0x50, 0xf7, 0x39,
+  0x42, 0x6d, 0x2c, 0xb1, 0x65, 0x1b, 0xfb, 0x00, 0x22, 0xeb, 0x46, 0xcb,
+  0xd4, 0x22, 0xb2, 0x76, 0xbe, 0xc1, 0x1a, 0x18, 0xb2, 0x7e, 0x9a, 0x87,
+  0xb3, 0xec, 0x2d, 0x94, 0xf7, 0x46, 0xf6, 0x46, 0x76, 0x0f, 0x5d, 0x5f,
+  0xb7, 0xb1, 0xdd, 0xcc, 0x5d, 0x4c, 0x3d, 0x6a, 0x7e, 0xf2, 0xa4, 0x86,
+  0x63, 0xaa, 0x50, 0xf3, 0xbf, 0x9c, 0xd4, 0xf8, 0x0f, 0xd4, 0x43, 0x3f,
+  0xbe, 0xe1, 0x3a, 0xe8, 0x61, 0xf3, 0xf0, 0x44, 0x47, 0xa3, 0xed, 0xce,
+  0xd8, 0xf2, 0xd4, 0x8a, 0xa4, 0x45, 0x5a, 0x31, 0xaa, 0xfa, 0x63, 0x35,
+  0x9e, 0xab, 0x82, 0x28, 0xce, 0x65, 0xad, 0x4e, 0xc1, 0x1d, 0x5b, 0xaa,
+  0x4e, 0x42, 0x2b, 0x44, 0x8a, 0x5a, 0xaf, 0xa1, 0xd0, 0x2e, 0x8e, 0x82,
+  0xc7, 0xb7, 0xcd, 0x8d, 0x7f, 0x51, 0x2b, 0xde, 0x5e, 0x4b, 0xe3, 0xe0,
+  0x8a, 0xf4, 0x5a, 0x98, 0x19, 0x4b, 0x10, 0x7b, 0xf2, 0xdd, 0xe5, 0x1e,
+  0xad, 0x67, 0x11, 0x44, 0x46, 0x7a, 0x29, 0xeb, 0x63, 0x23, 0x5a, 0x88,
+  0xa2, 0xc8, 0x1b, 0x1d, 0x04, 0x2d, 0x65, 0xc3, 0x84, 0x6a, 0x06, 0x3b,
+  0x94, 0x0c, 0x9b, 0xc1, 0x6e, 0x68, 0xcc, 0x04, 0x96, 0xd9, 0x30, 0x42,
+  0xde, 0x8b, 0x65, 0x30, 0xf8, 0x3c, 0x16, 0x71, 0x30, 0x4f, 0x30, 0x16,
+  0x4e, 0xd9, 0x0f, 0x70, 0x06, 0xa0, 0x26, 0x65, 0xaf, 0x20, 0x14, 0x44,
+  0x1e, 0x5a, 0x9e, 0x69, 0x46, 0x33, 0x46, 0xd4, 0xa0, 0xac, 0xa5, 0x04,
+  0xe4, 0xe5, 0xa3, 0x4c, 0x38, 0xbf, 0xbd, 0x1c, 0x90, 0xd4, 0x26, 0x17,
+  0x4b, 0x73, 0x47, 0x86, 0xbc, 0xf9, 0x9e, 0xeb, 0x0e, 0x2c, 0xb6, 0x5f,
+  0x23, 0x49, 0x69, 0xc8, 0xd0, 0x77, 0xe3, 0xb0, 0x04, 0x7d, 0x4b, 0x49,
+  0xf0, 0xf4, 0x36, 0x69, 0xd4, 0x96, 0x76, 0x59, 0x25, 0x98, 0x55, 0x42,
+  0x81, 0xba, 0x0d, 0x65, 0x6c, 0x69, 0xc6, 0x6e, 0x4b, 0x5a, 0xc2, 0xb6,
+  0x74, 0xd5, 0xfe, 0xab, 0x19, 0x1b, 0x79, 0x53, 0xe6, 0x5f, 0xc3, 0x54,
+  0xb0, 0x3a, 0x2f, 0xf6, 0x2e, 0x85, 0x35, 0x00, 0xe7, 0x4c, 0xa4, 0x12,
+  0xe6, 0x71, 0x0d, 0xaa, 0x60, 0x89, 0xfe, 0x0a, 0xb0, 0x2d, 0x1a, 0xab,
+  0x80, 0x91, 0x54, 0xa4, 0x2a, 0x92, 0x92, 0xad, 0x64, 0x7f, 0x05, 0xac,
+  0x1a, 0x34, 0xbe, 0x98, 0xac, 0x50, 0x39, 0xbe, 0x83, 0x71, 0xfd, 0x2b,
+  0x8c, 0x31, 0x9f, 0x27, 0xe3, 0x22, 0xd8, 0xc9, 0x8b, 0x44, 0x15, 0xff,
+  0xe7, 0x8d, 0x93, 0x8c, 0x8b, 0xf8, 0x18, 0x0e, 0x2f, 0x40, 0x48, 0xf1,
+  0x11, 0x5a, 0xc8, 0xdf, 0x81, 0x4c, 0xce, 0x01, 0xb2, 0x97, 0x0c, 0x90,
+  0x4d, 0xf4, 0xec, 0x22, 0xbb, 0x65, 0xa2, 0xb3, 0xfa, 0x1f, 0x21, 0x3a,
+  0xf0, 0x09, 0x83, 0x4b, 0x62, 0x5a, 0x88, 0x13, 0x75, 0x83, 0x86, 0xd8,
+  0x42, 0xb0, 0xae, 0x7d, 0xd8, 0x29, 0xce, 0x4b, 0x67, 0xfd, 0xd7, 0x48,
+  0x36, 0x88, 0x16, 0xfd, 0xc0, 0x43, 0xa8, 0x8b, 0x0f, 0x98, 0xe1, 0xec,
+  0x51, 0xa9, 0x37, 0x00, 0x55, 0x4f, 0xd6, 0x20, 0x50, 0xb5, 0x05, 0x6a,
+  0x13, 0x50, 0xc9, 0xf9, 0x66, 0x50, 0x4e, 0x86, 0xf9, 0x8c, 0x19, 0x5b,
+  0xc8, 0x3d, 0x03, 0x96, 0xa8, 0xa1, 0xf0, 0xce, 0x40, 0x3e, 0xbb, 0xff,
+  0xf6, 0x35, 0xf2, 0xce, 0xea, 0xe7, 0x70, 0xfa, 0x9d, 0x7e, 0x6d, 0xf6,
+  0x14, 0xe7, 0x0a, 0x77, 0x38, 0x72, 0x17, 0x52, 0xee, 0x88, 0x3b, 0x16,
+  0xa6, 0x1b, 0x82, 0x67, 0xa3, 0xb9, 0x01, 0xad, 0x95, 0x8d, 0x73, 0x63,
+  0x16, 0x47, 0x25, 0x79, 0xb7, 0x01, 0xd1, 0x5e, 0xc3, 0xe0, 0xbc, 0x98,
+  0x73, 0x90, 0x8f, 0xb9, 0x06, 0x35, 0x31, 0xf7, 0xa0, 0x2e, 0x46, 0xde,
+  0x61, 0x92, 0x88, 0x88, 0x94, 0x0c, 0x94, 0xe4, 0x8d, 0x07, 0x0b, 0x25,
+  0xb9, 0xef, 0x92, 0x3b, 0x15, 0xc1, 0x36, 0x11, 0xd4, 0x16, 0xfa, 0x88,
+  0xc2, 0xdd, 0xe7, 0x5e, 0xd8, 0xd7, 0x85, 0xfb, 0xa0, 0xb5, 0xc6, 0xb1,
+  0x69, 0x8f, 0x0e, 0x5d, 0x0d, 0x27, 0xec, 0x32, 0xdb, 0x3a, 0xf7, 0x0a,
+  0xa7, 0xc6, 0x5e, 0xd5, 0xc2, 0xb9, 0xff, 0xb2, 0x79, 0xa5, 0x73, 0x5e,
+  0x70, 0x2a, 0xa2, 0x47, 0x53, 0x61, 0x26, 0xc9, 0xa6, 0x50, 0x46, 0xb2,
+  0x91, 0x3a, 0x79, 0x57, 0xbb, 0x99, 0x43, 0x14, 0xf3, 0xf5, 0x7b, 0x48,
+  0xd4, 0xba, 0x18, 0x01, 0xbf, 0xeb, 0x2f, 0x9b, 0xe7, 0x05, 0x29, 0xce,
+  0x14, 0x9b, 0x44, 0x19, 0x8b, 0xf4, 0x69, 0x9c, 0x5f, 0x53, 0x6c, 0x7b,
+  0xbd, 0x63, 0x99, 0x6d, 0x39, 0xf7, 0xd7, 0x61, 0xdf, 0x65, 0xf6, 0xe5,
+  0xcc, 0x57, 0xa5, 0xea, 0x56, 0x26, 0xae, 0xb1, 0xdb, 0xbc, 0x9c, 0x7b,
+  0x13, 0xdc, 0x79, 0xa7, 0xba, 0xbe, 0xc8, 0xde, 0x9b, 0xe5, 0x51, 0x8c,
+  0x5f, 0xef, 0x60, 0xbb, 0x88, 0xcd, 0xd7, 0xbb, 0xff, 0x92, 0x99, 0x8d,
+  0x13, 0xbc, 0x80, 0x30, 0xd2, 0xd4, 0x20, 0x97, 0x35, 0x8e, 0x2b, 0xe1,
+  0xbe, 0xda, 0xc1, 0xa7, 0xaf, 0x63, 0x67, 0xba, 0xeb, 0xbc, 0x2b, 0xa1,
+  0xce, 0xa8, 0x75, 0x56, 0x7b, 0x14, 0x25, 0x74, 0x68, 0x65, 0xc0, 0x68,
+  0xbe, 0xca, 0x77, 0x9d, 0xb9, 0x3e, 0x50, 0x6a, 0xae, 0xf3, 0x35, 0x99,
+  0x57, 0x04, 0xf4, 0xe6, 0xe5, 0xbe, 0x75, 0xe6, 0xda, 0x80, 0xce, 0xbc,
+  0xcc, 0xd7, 0x68, 0xae, 0x09, 0x68, 0xcc, 0xd5, 0xbe, 0xab, 0xcd, 0x55,
+  0x01, 0xde, 0x6c, 0xf7, 0xad, 0x32, 0x4b, 0x01, 0xd6, 0x6c, 0xf3, 0xb9,
+  0xcc, 0x10, 0x71, 0x98, 0x5d, 0xa4, 0x9f, 0x08, 0x07, 0x7a, 0x18, 0xc8,
+  0x97, 0x1e, 0x45, 0x89, 0x0b, 0x90, 0xa7, 0x20, 0x4f, 0x40, 0xfe, 0x18,
+  0xf2, 0x1f, 0x20, 0x7f, 0x08, 0xf9, 0x14, 0xe4, 0x7f, 0x83, 0xfc, 0xbf,
+  0x20, 0x9f, 0x84, 0x9c, 0x82, 0xfc, 0x1b, 0xc8, 0xff, 0x1d, 0xf2, 0xbf,
+  0x3c, 0x4a, 0xde, 0xd5, 0x04, 0x42, 0x0c, 0xec, 0x79, 0x6f, 0x50, 0xde,
+  0x8f, 0xf7, 0x82, 0x3e, 0x3c, 0x82, 0x3e, 0xc0, 0xf7, 0xad, 0x8f, 0x34,
+  0xda, 0x2f, 0xee, 0x03, 0x9f, 0x83, 0x02, 0xc1, 0x7c, 0xfe, 0x6a, 0x07,
+  0xd8, 0x7e, 0x9c, 0xed, 0x5a, 0x5b, 0xb5, 0xd8, 0x7e, 0xa3, 0xbd, 0xd1,
+  0x5e, 0x1e, 0x63, 0xbb, 0xe6, 0x07, 0xbd, 0x11, 0x08, 0x2f, 0xec, 0x65,
+  0xb1, 0xf9, 0x41, 0x34, 0xe8, 0x8c, 0x96, 0xd0, 0xd2, 0x15, 0x15, 0x68,
+  0xe9, 0x8e, 0x32, 0x50, 0x7e, 0xfc, 0x02, 0xd7, 0xe3, 0x55, 0xac, 0x85,
+  0xd3, 0x75, 0x5e, 0xf2, 0x6f, 0x24, 0x6f, 0x40, 0x1f, 0x44, 0xdf, 0xd7,
+  0x1c, 0x5b, 0x1d, 0x6c, 0x64, 0x61, 0x17, 0xfa, 0x70, 0x53, 0xcd, 0xfc,
+  0xd8, 0xc2, 0x2d, 0xad, 0xd6, 0x5b, 0x6b, 0xf4, 0xb1, 0x85, 0x5d, 0x1d,
+  0xa6, 0x4d, 0x35, 0x3a, 0xf2, 0xd9, 0x74, 0x6b, 0x8d, 0x06, 0x3e, 0x07,
+  0x4c, 0x1f, 0xbf, 0x60, 0xea, 0x66, 0x47, 0xb8, 0x6e, 0x3c, 0xa2, 0xed,
+  0x36, 0x74, 0xcf, 0x6c, 0x63, 0xb7, 0x92, 0x1e, 0x10, 0x70, 0x91, 0x32,
+  0x14, 0xe5, 0x69, 0x19, 0x8e, 0x62, 0x28, 0x23, 0xd1, 0xa9, 0xad, 0x30,
+  0x3f, 0x5b, 0xe4, 0x3e, 0xc9, 0x3b, 0x77, 0x1a, 0xeb, 0x29, 0x79, 0x04,
+  0x32, 0xb9, 0xff, 0x93, 0x14, 0x68, 0xbb, 0xa1, 0xe5, 0xc6, 0x96, 0xce,
+  0x96, 0xcd, 0x2d, 0x28, 0x7f, 0x7b, 0x9b, 0x1d, 0xff, 0xf9, 0x7f, 0xfc,
+  0x38, 0xe6, 0xf3, 0xb7, 0xaf, 0xbf, 0xd9, 0xdb, 0xb6, 0xde, 0xda, 0xfa,
+  0x0d, 0x6b, 0xbb, 0x1f, 0xe5, 0x6f, 0xde, 0xbc, 0xbe, 0xcd, 0x6f, 0xdd,
+  0xb4, 0xd1, 0xdb, 0xb6, 0x39, 0xd0, 0x66, 0xbd, 0xde, 0xdf, 0x7e, 0x13,
+  0xca, 0x13, 0x39, 0x6b, 0xdb, 0xe6, 0xce, 0x36, 0xbf, 0xcf, 0xbf, 0x31,
+  0xd0, 0x16, 0xa8, 0xb7, 0x6e, 0xea, 0x5c, 0xbf, 0x12, 0xe5, 0x6f, 0x85,
+  0xbe, 0xee, 0x22, 0x31, 0x27, 0xe4, 0x16, 0x73, 0x5d, 0x6b, 0xa9, 0xcd,
+  0x5b, 0x66, 0xaf, 0x67, 0xf8, 0xf5, 0xa5, 0xb6, 0x95, 0x0c, 0xdf, 0x66,
+  0x58, 0x7a, 0xbd, 0x61, 0xe9, 0x0d, 0x65, 0xf6, 0x8d, 0xac, 0x76, 0x93,
+  0xbe, 0x52, 0x5c, 0xb8, 0xe6, 0x26, 0xcb, 0x55, 0x9b, 0xcb, 0xec, 0xed,
+  0xc6, 0x1a, 0x9f, 0x61, 0xa9, 0xbf, 0xd4, 0x16, 0x28, 0xb5, 0x75, 0x96,
+  0xda, 0x6e, 0x2e, 0xb5, 0x7d, 0xc3, 0x58, 0x93, 0x47, 0xc1, 0xdb, 0x46,
+  0x50, 0xf4, 0xb6, 0x91, 0x8d, 0x29, 0xf2, 0x6f, 0x42, 0x1b, 0xdf, 0xf6,
+  0x04, 0x2f, 0xbd, 0x89, 0xaa, 0x98, 0xf1, 0x1b, 0x92, 0x4e, 0xdb, 0x0d,
+  0xe9, 0xfc, 0x07, 0x7e, 0xbb, 0x61, 0xbb, 0x5f, 0xf2, 0x04, 0xf1, 0x5b,
+  0x7a, 0x84, 0xaa, 0xf2, 0x19, 0x2f, 0x9c, 0x82, 0x7a, 0xd4, 0xd8, 0x10,
+  0x08, 0x92, 0x19, 0xdb, 0xd0, 0x20, 0xb5, 0x77, 0x7d, 0xd0, 0x9c, 0xf6,
+  0x86, 0xf4, 0xde, 0x40, 0xf0, 0xba, 0x34, 0x1b, 0x52, 0xdf, 0xa5, 0x91,
+  0xcf, 0xeb, 0x52, 0x6c, 0x04, 0x5a, 0x5a, 0x03, 0x41, 0xad, 0xa7, 0xa6,
+  0x5d, 0x3e, 0xfb, 0xf5, 0xa8, 0xa9, 0xa1, 0xeb, 0x83, 0xde, 0xcc, 0x46,
+  0xeb, 0xf9, 0xf1, 0xaf, 0x23, 0x6f, 0xb8, 0x02, 0x5d, 0xeb, 0xb9, 0xb6,
+  0xf5, 0xeb, 0x4c, 0x05, 0xa3, 0x47, 0xf5, 0x0d, 0x68, 0x84, 0x39, 0xfd,
+  0xa1, 0xe3, 0xa4, 0x63, 0xd9, 0xff, 0x1e, 0x0d, 0x32, 0x6f, 0xe0, 0xd8,
+  0xaa, 0x91, 0x7c, 0x06, 0x6e, 0x2b, 0x69, 0xab, 0x7d, 0x34, 0xf8, 0xc9,
+  0x9b, 0xe8, 0xaa, 0x65, 0xff, 0xb6, 0x6d, 0xe5, 0x2d, 0xd5, 0x57, 0x3f,
+  0x34, 0x3f, 0x56, 0x9d, 0x92, 0xb0, 0x7b, 0x7f, 0x0d, 0xae, 0x4a, 0xfb,
+  0xed, 0x55, 0xa9, 0xb0, 0x34, 0x16, 0xb4, 0xbe, 0x85, 0x57, 0xda, 0x4f,
+  0xae, 0x38, 0x10, 0x0a, 0x2e, 0xb6, 0xd6, 0x42, 0x1c, 0x89, 0x6b, 0xc6,
+  0xc2, 0xdf, 0x95, 0x6c, 0x2b, 0xc5, 0x74, 0xab, 0x5d, 0x4c, 0xb5, 0x4a,
+  0xa0, 0xf1, 0xad, 0x5b, 0xaa, 0x4b, 0xf6, 0xa1, 0xab, 0x2a, 0x0e, 0x8e,
+  0x45, 0x36, 0xd8, 0x67, 0x62, 0xb2, 0xce, 0xb1, 0xc8, 0x77, 0xed, 0xce,
+  0x95, 0x28, 0x33, 0xf5, 0x2d, 0x98, 0xc7, 0xbb, 0xb5, 0x70, 0x1e, 0x01,
+  0xd5, 0x5e, 0xde, 0xf3, 0xde, 0x29, 0x67, 0x68, 0x39, 0xac, 0x7f, 0xb3,
+  0x3d, 0x7f, 0x69, 0x3d, 0x93, 0x3f, 0x83, 0x8c, 0x34, 0x76, 0x44, 0xef,
+  0xe6, 0x39, 0xc8, 0x26, 0xc8, 0x5a, 0xc8, 0x06, 0xc8, 0xe4, 0x3d, 0x02,
+  0x79, 0x9f, 0x50, 0x09, 0xf5, 0x4d, 0xdf, 0x47, 0x74, 0xee, 0x9f, 0x20,
+  0xb1, 0x0b, 0x1a, 0xcd, 0xcf, 0x07, 0x5a, 0x39, 0xe4, 0x6b, 0x14, 0xbd,
+  0xeb, 0xde, 0x7e, 0x6f, 0xbc, 0x25, 0xbc, 0x56, 0xb2, 0x55, 0xdd, 0x31,
+  0xd4, 0x02, 0xfa, 0xcd, 0x55, 0x6b, 0x92, 0x6b, 0xd2, 0x96, 0x60, 0x9d,
+  0xc7, 0xd5, 0xe5, 0x02, 0x9e, 0x8b, 0xc0, 0xb3, 0xaa, 0xc0, 0xf3, 0x35,
+  0x85, 0xc7, 0x99, 0x74, 0x2a, 0x3c, 0x0d, 0x49, 0x74, 0xca, 0x6a, 0xab,
+  0x05, 0x4e, 0x8e, 0xcc, 0x88, 0xbd, 0x9a, 0xca, 0x90, 0xda, 0x4c, 0xaf,
+  0xf4, 0xbb, 0xee, 0x48, 0x83, 0xa3, 0x1b, 0x3e, 0x6f, 0xa8, 0xb2, 0x9f,
+  0x5c, 0xb0, 0x07, 0x2d, 0x93, 0x98, 0xea, 0xf4, 0x6a, 0x1a, 0xbb, 0xd8,
+  0xd2, 0xad, 0x92, 0xdf, 0x1e, 0x22, 0x56, 0xaa, 0xb1, 0xbd, 0x53, 0x7f,
+  0xa0, 0x03, 0xac, 0x74, 0xe6, 0x2d, 0x5c, 0x5d, 0x3d, 0x14, 0x0a, 0x2e,
+  0x07, 0x5b, 0x9d, 0x89, 0x6c, 0xa8, 0x32, 0xef, 0x6b, 0x58, 0x56, 0x9e,
+  0x82, 0x58, 0x4c, 0xea, 0x06, 0xed, 0x68, 0x59, 0xc5, 0xc1, 0x50, 0x78,
+  0x83, 0x34, 0x13, 0x23, 0x1a, 0xd1, 0x32, 0xd3, 0x70, 0x88, 0x60, 0xaa,
+  0xd1, 0xc3, 0x49, 0xae, 0x7d, 0xdb, 0xb3, 0xc5, 0x43, 0xa8, 0x55, 0xba,
+  0xb4, 0x6c, 0x27, 0xb3, 0x5d, 0x8f, 0x7c, 0x55, 0xf9, 0x4b, 0x1b, 0x18,
+  0x63, 0x9e, 0xd8, 0x89, 0xd8, 0x88, 0xd8, 0x43, 0xb5, 0x45, 0x2d, 0xd4,
+  0x9f, 0x81, 0xf2, 0x18, 0x8d, 0x6b, 0xde, 0xcd, 0x77, 0x83, 0x9d, 0x88,
+  0x7d, 0x6e, 0xda, 0x72, 0x4b, 0xb5, 0x29, 0x46, 0x56, 0x13, 0x86, 0x18,
+  0x85, 0x94, 0xcc, 0xa0, 0x96, 0x96, 0xec, 0x20, 0x47, 0x4b, 0x6e, 0x10,
+  0xc5, 0x98, 0xf7, 0x1d, 0xef, 0xf8, 0xb6, 0xfa, 0x48, 0x8f, 0xd5, 0xd3,
+  0xe3, 0x57, 0xfd, 0x6e, 0x1b, 0x20, 0xb9, 0x51, 0xb2, 0x2d, 0xd3, 0xa3,
+  0x60, 0xf5, 0xf2, 0x42, 0x4b, 0x6d, 0x2a, 0x3f, 0xee, 0x92, 0x6e, 0xec,
+  0x5a, 0x06, 0x33, 0x4e, 0x5a, 0xaa, 0x53, 0xf9, 0x8c, 0xbc, 0x5a, 0xff,
+  0x26, 0x28, 0xb5, 0x23, 0x88, 0x24, 0x30, 0x64, 0x16, 0x32, 0x07, 0x7d,
+  0x94, 0x90, 0xb7, 0x03, 0x23, 0xda, 0x0f, 0x34, 0x23, 0xd6, 0x0f, 0xea,
+  0x0f, 0x91, 0x38, 0x62, 0xc5, 0x21, 0x0c, 0xcf, 0xda, 0x43, 0xe5, 0xa9,
+  0xae, 0x0f, 0xc9, 0xba, 0x8d, 0x04, 0xbf, 0x8e, 0x16, 0xa6, 0x2b, 0xb0,
+  0xde, 0x1b, 0x09, 0xce, 0x57, 0xd6, 0x32, 0xa1, 0xd5, 0xb4, 0x57, 0x20,
+  0xb2, 0x8e, 0xa5, 0xf6, 0xbf, 0x09, 0x5e, 0xae, 0x75, 0x51, 0x6c, 0x31,
+  0x68, 0x28, 0x07, 0xad, 0x0b, 0x41, 0x2b, 0x3e, 0x44, 0xde, 0xd1, 0x20,
+  0x06, 0x69, 0xa3, 0x88, 0xd8, 0x83, 0xd8, 0xc0, 0x0a, 0xb9, 0x6a, 0xce,
+  0x9a, 0x29, 0xa7, 0x7d, 0x2e, 0x3c, 0xa4, 0x57, 0xfa, 0x0c, 0x04, 0x6f,
+  0x47, 0x3a, 0xda, 0x67, 0x20, 0xa8, 0x29, 0xec, 0x9f, 0xdb, 0x0b, 0x7d,
+  0xb6, 0x3e, 0x0f, 0x1a, 0x41, 0x9f, 0x2a, 0xdf, 0xf3, 0xdd, 0xce, 0x6f,
+  0x6d, 0xb7, 0x7e, 0x6d, 0xcb, 0xf6, 0x9e, 0x3b, 0xef, 0xb9, 0x7b, 0x9d,
+  0xb5, 0x61, 0xe5, 0x6a, 0x27, 0x92, 0x69, 0xad, 0xf7, 0xdd, 0x79, 0x57,
+  0xd7, 0xba, 0xaf, 0xde, 0x77, 0xb7, 0xd5, 0xe5, 0xb6, 0x3a, 0xd7, 0xae,
+  0x6d, 0x74, 0xae, 0x5a, 0xb7, 0xda, 0xb5, 0x6e, 0xf5, 0x1a, 0xf4, 0xc4,
+  0x0f, 0x50, 0xe2, 0x55, 0xc8, 0x7f, 0x4d, 0xff, 0xd6, 0x7e, 0x93, 0xbf,
+  0x0e, 0xcb, 0xb5, 0xbf, 0x85, 0xbc, 0x10, 0xb2, 0x81, 0xc6, 0xc6, 0x72,
+  0x26, 0x51, 0x6e, 0x79, 0x79, 0x39, 0x5a, 0xbe, 0x7c, 0x39, 0xf2, 0xfb,
+  0xfd, 0x28, 0x12, 0x89, 0xa0, 0x9e, 0x9e, 0x1e, 0xd4, 0xdf, 0xdf, 0x8f,
+  0x12, 0x89, 0x04, 0x3a, 0x7a, 0xf4, 0x28, 0x7a, 0xee, 0xb9, 0xe7, 0xd0,
+  0xf1, 0xe3, 0xc7, 0xd1, 0x6f, 0x7e, 0xf3, 0x1b, 0x74, 0xf2, 0xe4, 0x49,
+  0x74, 0xfa, 0xf4, 0x69, 0x74, 0xee, 0xdc, 0x39, 0xaa, 0x33, 0xc6, 0x22,
+  0x61, 0x27, 0xdb, 0x8f, 0x76, 0xb2, 0x28, 0x66, 0x44, 0xec, 0x4e, 0x63,
+  0x49, 0x1f, 0xd2, 0xec, 0x34, 0xa2, 0x9d, 0x1a, 0xb6, 0xcf, 0xb8, 0x53,
+  0x43, 0x28, 0x9a, 0x3e, 0xf2, 0xec, 0x47, 0x9a, 0x3e, 0x78, 0xb0, 0x46,
+  0x6c, 0x64, 0xfb, 0x90, 0x11, 0xf7, 0xcd, 0x52, 0x80, 0x13, 0x69, 0x8d,
+  0xdc, 0x1c, 0x4a, 0x1f, 0x6b, 0xd4, 0x69, 0x8d, 0x9a, 0xb9, 0x3c, 0x82,
+  0x51, 0xcb, 0x19, 0xd1, 0x5c, 0x8a, 0xd6, 0xd8, 0xc7, 0x5c, 0x4e, 0x41,
+  0x46, 0x06, 0x1e, 0x97, 0x51, 0x98, 0x3e, 0xa3, 0x70, 0x39, 0x05, 0xfa,
+  0x29, 0xa1, 0x14, 0x6d, 0x9f, 0xa6, 0x1f, 0xe9, 0x34, 0xb0, 0x56, 0xfb,
+  0x00, 0x62, 0x9f, 0x06, 0xfd, 0x97, 0x9b, 0xfc, 0xbf, 0x33, 0xc9, 0xa6,
+  0xba, 0x0e, 0xb2, 0x1d, 0xcc, 0xf6, 0x0d, 0xc5, 0x4c, 0x5a, 0x72, 0xbb,
+  0x06, 0x1f, 0x45, 0xcc, 0x75, 0x3c, 0xe1, 0x44, 0xc7, 0xfb, 0xcb, 0xd1,
+  0xf1, 0xff, 0x8c, 0xd0, 0xf1, 0xa3, 0x11, 0x74, 0xfc, 0xb9, 0x83, 0x54,
+  0x66, 0x47, 0x16, 0x0b, 0x7c, 0x1f, 0xc3, 0xf6, 0x71, 0x6c, 0x1f, 0xc3,
+  0x0b, 0xc7, 0x71, 0x9f, 0xf0, 0x23, 0xfe, 0x61, 0x2c, 0x1c, 0xe3, 0x85,
+  0x87, 0xa0, 0xfe, 0x63, 0x7e, 0x04, 0x0b, 0xcc, 0x1e, 0x8e, 0xe5, 0x5f,
+  0x01, 0x3e, 0xe6, 0x18, 0xc7, 0x1c, 0x82, 0x92, 0x7d, 0x9e, 0xe3, 0x0f,
+  0x62, 0x9e, 0x79, 0x9e, 0xfb, 0x1e, 0xb4, 0x0e, 0x71, 0xfc, 0x4f, 0x31,
+  0xcf, 0xbe, 0xc0, 0x31, 0xc3, 0x50, 0xbc, 0xc4, 0xf1, 0x07, 0x80, 0xf8,
+  0x12, 0xf7, 0x18, 0xe6, 0x0f, 0x73, 0xc2, 0xf3, 0x50, 0xff, 0x09, 0xc7,
+  0x1c, 0xc0, 0xfc, 0xcb, 0x1c, 0xbf, 0x0f, 0x3e, 0xfc, 0x94, 0x3b, 0x8a,
+  0x99, 0x23, 0x1c, 0x7f, 0x8c, 0x50, 0x18, 0xa0, 0xb0, 0x3f, 0xe3, 0xf8,
+  0xbd, 0x98, 0xff, 0x19, 0xf7, 0x28, 0x66, 0x1f, 0xe1, 0x98, 0x67, 0x29,
+  0x85, 0x01, 0xca, 0x2b, 0x1c, 0xbf, 0x07, 0x33, 0xff, 0xc0, 0x3d, 0x82,
+  0xd9, 0xa3, 0x1c, 0xf3, 0x34, 0x21, 0x30, 0x40, 0x78, 0x95, 0xe3, 0xe3,
+  0xc0, 0xf3, 0x0a, 0xf7, 0x30, 0x66, 0xbe, 0xc7, 0xf1, 0x4f, 0x12, 0x0a,
+  0x93, 0xc0, 0xcc, 0xcf, 0x39, 0xfe, 0x41, 0x2c, 0xfc, 0x9c, 0x3b, 0x82,
+  0xf9, 0x11, 0x4e, 0x78, 0x9c, 0x10, 0x98, 0x38, 0x66, 0x7e, 0xc1, 0xf1,
+  0x31, 0x2c, 0xfc, 0x82, 0x7b, 0x08, 0x0b, 0x3f, 0xe0, 0xd8, 0x1f, 0x12,
+  0x02, 0xf3, 0x20, 0xe6, 0x7f, 0x49, 0xc8, 0x2c, 0x21, 0x33, 0x3f, 0xe4,
+  0x60, 0x90, 0xcc, 0x2f, 0x39, 0x06, 0xf8, 0x5e, 0xe3, 0xf8, 0x41, 0x52,
+  0x7f, 0x08, 0xef, 0xe3, 0x78, 0xa1, 0x0f, 0xf0, 0xee, 0xe5, 0x98, 0xef,
+  0x63, 0xfe, 0x35, 0xd2, 0xca, 0x42, 0xeb, 0x6e, 0xc2, 0x73, 0x18, 0xf3,
+  0x7b, 0x38, 0x06, 0xaa, 0x7b, 0x39, 0xe1, 0x31, 0x2c, 0x3c, 0xc4, 0x3d,
+  0xc5, 0x80, 0x18, 0x3f, 0xcc, 0xb1, 0xcf, 0x32, 0xc0, 0x71, 0x90, 0x63,
+  0x9f, 0x61, 0x0e, 0x63, 0x26, 0xc1, 0xb1, 0x3b, 0xb1, 0xd0, 0x47, 0xf5,
+  0xec, 0xe1, 0xf8, 0xc7, 0x30, 0x3b, 0xc4, 0x31, 0x7d, 0xc2, 0x8b, 0x58,
+  0xd8, 0x0f, 0x06, 0x15, 0x7e, 0x82, 0x79, 0x5a, 0x9e, 0xc0, 0x7b, 0x38,
+  0x60, 0x61, 0xfa, 0x39, 0xbe, 0x0f, 0xf3, 0x20, 0x74, 0x54, 0x6e, 0x78,
+  0x19, 0x33, 0x00, 0xe2, 0x67, 0x80, 0x84, 0x15, 0xfe, 0x89, 0x34, 0x30,
+  0xd0, 0xbc, 0x8b, 0x30, 0x01, 0xff, 0xa3, 0x78, 0x3f, 0xc7, 0x0f, 0x60,
+  0xe1, 0x59, 0xe8, 0x6f, 0x2f, 0x30, 0x40, 0x47, 0x3f, 0xe6, 0x85, 0x01,
+  0xcc, 0x03, 0xde, 0x7e, 0x0c, 0x73, 0x78, 0x88, 0xf4, 0x0f, 0x6a, 0x77,
+  0xc3, 0xc4, 0x92, 0x2a, 0xff, 0x08, 0xe6, 0xf7, 0x71, 0xc0, 0xc7, 0x33,
+  0x3f, 0xe2, 0x98, 0x5d, 0x64, 0x04, 0x04, 0x1d, 0x4c, 0x29, 0xa8, 0x61,
+  0x61, 0x38, 0xd0, 0xc2, 0xfe, 0x98, 0x3b, 0x04, 0xca, 0xa1, 0x9b, 0x41,
+  0x4e, 0xc0, 0x02, 0x40, 0x79, 0x84, 0x28, 0x07, 0x36, 0xf6, 0x18, 0x91,
+  0x01, 0x36, 0xe0, 0x82, 0xc9, 0xef, 0x27, 0x03, 0x02, 0x09, 0xe6, 0x39,
+  0xee, 0xa0, 0x82, 0x8c, 0x19, 0x54, 0x90, 0x1d, 0x21, 0x18, 0xa0, 0x63,
+  0xe0, 0x03, 0x11, 0x3a, 0x34, 0xfe, 0x05, 0x22, 0xc2, 0xd3, 0x3a, 0xac,
+  0x9d, 0x83, 0x98, 0xa5, 0xd0, 0x62, 0x2a, 0xb4, 0x23, 0x98, 0x51, 0xf9,
+  0x98, 0x01, 0xd2, 0x2f, 0xe8, 0x13, 0x5e, 0x24, 0x32, 0xa4, 0x95, 0xd2,
+  0x87, 0x49, 0x8f, 0x50, 0x7b, 0x50, 0x01, 0x76, 0x04, 0x34, 0x93, 0x96,
+  0x17, 0x89, 0x04, 0x4f, 0xd5, 0xb1, 0x54, 0x02, 0x54, 0x53, 0xe1, 0x61,
+  0x15, 0xd7, 0x83, 0x0a, 0x2e, 0x3a, 0x69, 0xd0, 0xf4, 0x12, 0x91, 0x60,
+  0x12, 0x72, 0x15, 0x04, 0x64, 0x2e, 0x22, 0x40, 0x50, 0x61, 0x21, 0xae,
+  0xa2, 0x3a, 0xac, 0xf4, 0xce, 0xc8, 0x12, 0x71, 0xca, 0x07, 0x22, 0x3b,
+  0x09, 0x00, 0xa0, 0xbf, 0xc4, 0x0d, 0x29, 0xa0, 0x12, 0x0a, 0xa8, 0xc3,
+  0x4a, 0xef, 0x3f, 0x51, 0x04, 0xf8, 0x39, 0x02, 0x02, 0xe9, 0x6e, 0x48,
+  0x01, 0xc5, 0x52, 0x05, 0xa4, 0xbf, 0x43, 0x4a, 0xff, 0x5f, 0x20, 0x22,
+  0xc3, 0xda, 0x43, 0x60, 0x81, 0x34, 0x4f, 0x24, 0x80, 0xeb, 0xa7, 0x9f,
+  0x27, 0x70, 0x40, 0x01, 0xb5, 0x57, 0x01, 0x45, 0xf8, 0xa1, 0xf6, 0x05,
+  0xfc, 0x0a, 0xa6, 0xbd, 0x2a, 0xa6, 0x83, 0x58, 0xe9, 0x11, 0x96, 0x75,
+  0x41, 0x06, 0xfa, 0x7f, 0x9c, 0x29, 0x88, 0xed, 0xe5, 0x1e, 0x87, 0x3d,
+  0x2d, 0x23, 0xdb, 0xa7, 0x22, 0x23, 0x72, 0x7d, 0x94, 0xe1, 0x98, 0x2a,
+  0x05, 0xf5, 0x67, 0x14, 0x11, 0x80, 0xf2, 0x32, 0x7d, 0xf6, 0x91, 0xe5,
+  0x2d, 0x13, 0x0a, 0x12, 0xcf, 0xa9, 0x02, 0x71, 0xea, 0x01, 0x14, 0x01,
+  0xe1, 0x65, 0xaa, 0x17, 0x50, 0xed, 0x57, 0xb1, 0x0d, 0x63, 0x55, 0x59,
+  0x82, 0xd9, 0xc9, 0x0b, 0x47, 0x67, 0xe5, 0xd8, 0xa3, 0x0c, 0x9f, 0x28,
+  0x88, 0x42, 0x27, 0x3f, 0x64, 0xf6, 0x2b, 0x08, 0x0f, 0xa8, 0x08, 0x15,
+  0xe9, 0xef, 0x71, 0xe0, 0xea, 0x8e, 0xa8, 0xa2, 0xcf, 0x10, 0xf7, 0x31,
+  0x57, 0x8e, 0xdb, 0xa7, 0xe2, 0x1c, 0x52, 0xfa, 0x1a, 0x96, 0x6d, 0x0e,
+  0x0e, 0x84, 0xac, 0x8a, 0xcf, 0x17, 0x53, 0xd0, 0x0e, 0xa9, 0x68, 0x87,
+  0x94, 0xd9, 0x7d, 0x9c, 0x18, 0xe7, 0x0b, 0xe4, 0x64, 0x98, 0xc3, 0x2a,
+  0xcc, 0x21, 0x65, 0x1d, 0x3d, 0x01, 0x1b, 0x7b, 0xe8, 0xf3, 0xe5, 0xf6,
+  0xaa, 0x30, 0x0f, 0x2a, 0x30, 0x87, 0xd4, 0x15, 0xfb, 0x24, 0xf1, 0xb8,
+  0x5f, 0x20, 0xa7, 0xe0, 0x3c, 0xa8, 0xe2, 0xa4, 0x6b, 0x00, 0x34, 0x09,
+  0x4f, 0x41, 0x8f, 0xfb, 0x14, 0x49, 0xf6, 0x4a, 0x92, 0x32, 0xd2, 0x43,
+  0x2a, 0x52, 0xba, 0xd8, 0xc8, 0x3e, 0x7c, 0x9a, 0x13, 0xf6, 0x2a, 0x72,
+  0xcf, 0x7e, 0x46, 0x6c, 0x8f, 0x0a, 0xf4, 0x70, 0x01, 0x28, 0x2b, 0xfb,
+  0xbc, 0xa7, 0xa9, 0x8f, 0xff, 0x5c, 0x31, 0x05, 0xe7, 0xe1, 0x39, 0x38,
+  0xa9, 0xdb, 0x22, 0xdd, 0x25, 0xbe, 0x40, 0x4e, 0x46, 0xf9, 0xd0, 0xac,
+  0x3d, 0x15, 0x2f, 0xf6, 0x14, 0x27, 0xc4, 0x3f, 0x57, 0x2c, 0xa1, 0xa2,
+  0x3c, 0x52, 0x40, 0xc9, 0xcb, 0xae, 0x95, 0x67, 0x61, 0x26, 0xbe, 0x48,
+  0x50, 0xc1, 0x79, 0x64, 0x76, 0xde, 0xf7, 0x53, 0x27, 0xb9, 0x93, 0x4f,
+  0x30, 0x87, 0xc8, 0x79, 0xa3, 0x88, 0x7e, 0x6a, 0x85, 0x1e, 0x62, 0x80,
+  0x39, 0xa1, 0xa0, 0x7d, 0x78, 0x16, 0x2d, 0xec, 0x0f, 0x06, 0x76, 0x21,
+  0x39, 0x5a, 0x85, 0x18, 0x95, 0x7d, 0xb5, 0x20, 0x76, 0x84, 0x3c, 0xe2,
+  0x2a, 0xd4, 0x47, 0x0a, 0x0b, 0x94, 0x3d, 0x40, 0xce, 0x92, 0x83, 0xf4,
+  0xe8, 0xf8, 0x1c, 0x19, 0x79, 0x71, 0xc0, 0x21, 0x5b, 0x40, 0x29, 0x1c,
+  0xe6, 0xf6, 0xc0, 0x56, 0x00, 0xa4, 0xe4, 0xa8, 0x19, 0xbc, 0x32, 0x4c,
+  0x61, 0x98, 0xe9, 0x93, 0x15, 0xec, 0x21, 0xa4, 0xa3, 0x9c, 0xba, 0x97,
+  0x78, 0x58, 0x66, 0xc4, 0x3a, 0xfb, 0xb8, 0xc1, 0x2b, 0xdb, 0x06, 0x56,
+  0x34, 0x95, 0x7c, 0x50, 0x85, 0x7b, 0xb4, 0xb0, 0xef, 0x99, 0xa7, 0xe8,
+  0x89, 0xb3, 0x97, 0x9c, 0xa8, 0x5f, 0x22, 0xab, 0xc0, 0x86, 0x03, 0x67,
+  0xaf, 0xe2, 0x3b, 0x61, 0x98, 0x2c, 0x59, 0xa9, 0x7d, 0x74, 0x39, 0x7c,
+  0xa9, 0x82, 0x3d, 0xb2, 0xc7, 0x22, 0x67, 0x39, 0x85, 0x0e, 0x31, 0x0c,
+  0xfb, 0x34, 0x5d, 0x7e, 0xd0, 0xb2, 0xeb, 0x8b, 0xa5, 0x63, 0x2a, 0xf4,
+  0xbd, 0x1c, 0xd5, 0x41, 0xd6, 0xfb, 0x61, 0xb2, 0x6e, 0x77, 0x92, 0x03,
+  0xe8, 0x4b, 0x85, 0x67, 0xb1, 0xf7, 0xe1, 0x02, 0x7a, 0x38, 0x89, 0x9e,
+  0xa2, 0x87, 0x39, 0x68, 0xfe, 0x52, 0x0d, 0x2a, 0x78, 0x40, 0xab, 0xc2,
+  0x7f, 0x88, 0xec, 0x53, 0x81, 0x1c, 0x6a, 0x5f, 0x22, 0x3d, 0x38, 0x0b,
+  0x7e, 0x67, 0x01, 0x3d, 0x84, 0x4d, 0x4f, 0x28, 0xbd, 0x0b, 0x03, 0x5f,
+  0x26, 0x2f, 0xe3, 0xa7, 0x31, 0x45, 0x01, 0x3e, 0x44, 0x87, 0xe0, 0xd0,
+  0x28, 0x2b, 0xff, 0xa5, 0x0a, 0x54, 0xf8, 0xfd, 0xb3, 0xf0, 0x1f, 0x05,
+  0xf9, 0x1f, 0x10, 0xa1, 0x2f, 0x97, 0xdf, 0xad, 0x0c, 0x00, 0x64, 0x07,
+  0x0a, 0x03, 0x20, 0x31, 0x27, 0xfb, 0x18, 0xf5, 0xab, 0xf1, 0xd9, 0x43,
+  0xed, 0x73, 0x35, 0x14, 0x86, 0xb0, 0x6b, 0x76, 0x08, 0x23, 0x10, 0xda,
+  0xee, 0xe4, 0xe3, 0x64, 0xfb, 0x7d, 0x4a, 0x0d, 0x10, 0x1e, 0xbb, 0x7c,
+  0xf5, 0xef, 0xe2, 0x99, 0x84, 0xaa, 0x8b, 0x06, 0x10, 0x7b, 0xc9, 0xa2,
+  0xe1, 0xd5, 0xd1, 0xbc, 0xa4, 0x44, 0x06, 0xfc, 0x1c, 0x25, 0x97, 0x9f,
+  0x62, 0xfc, 0xa0, 0xa2, 0x29, 0x01, 0xf3, 0xa5, 0x04, 0x25, 0x7b, 0xb9,
+  0xdd, 0x85, 0xf1, 0x5c, 0x51, 0x03, 0x88, 0xa9, 0x07, 0x27, 0x98, 0x70,
+  0xf7, 0x1c, 0x0d, 0xf2, 0x78, 0x9e, 0xa4, 0x6a, 0x12, 0xc4, 0x3f, 0x3c,
+  0x75, 0x85, 0x61, 0x30, 0xe4, 0x80, 0x9e, 0x73, 0x5a, 0xb3, 0xbb, 0x18,
+  0xb6, 0xa0, 0x81, 0x8e, 0xe2, 0x29, 0x05, 0x7f, 0x8c, 0x44, 0x12, 0x9f,
+  0x12, 0x9e, 0x13, 0x1f, 0xfc, 0x50, 0x16, 0x1a, 0x50, 0x81, 0x2b, 0x0b,
+  0x8f, 0x48, 0x5d, 0x3e, 0x83, 0x57, 0x14, 0x92, 0xb1, 0x3e, 0xad, 0x62,
+  0x1d, 0x04, 0xa9, 0xbe, 0xcb, 0xd6, 0xcd, 0x15, 0xa5, 0x14, 0x2b, 0xb3,
+  0x0f, 0x2b, 0x10, 0x07, 0xf1, 0x4f, 0x54, 0x0d, 0x9f, 0x95, 0xeb, 0xc3,
+  0x8a, 0x5c, 0xff, 0xac, 0x6d, 0xf9, 0x87, 0x65, 0x94, 0x44, 0x70, 0x76,
+  0x9f, 0x28, 0xe1, 0x5b, 0xbf, 0x7c, 0x96, 0x17, 0xa4, 0xd4, 0xf5, 0xd1,
+  0x07, 0x52, 0x4a, 0x2f, 0xbb, 0x21, 0xb6, 0xe3, 0x0b, 0xfb, 0xf3, 0xd3,
+  0xa1, 0xe2, 0x0f, 0x54, 0x49, 0x75, 0x35, 0x80, 0x17, 0x96, 0x81, 0xee,
+  0xc6, 0x2f, 0xd2, 0x53, 0x94, 0x7a, 0x86, 0x4f, 0x05, 0xa5, 0x02, 0xb9,
+  0x7f, 0x50, 0xc1, 0x9d, 0x2a, 0x50, 0xf0, 0x5d, 0xd4, 0x83, 0x13, 0x84,
+  0xbb, 0xf1, 0x0b, 0xe4, 0x88, 0x62, 0xa9, 0x47, 0xba, 0x42, 0x04, 0x3c,
+  0xa2, 0xca, 0xaa, 0x70, 0x79, 0x22, 0xaa, 0xe0, 0xdd, 0x85, 0x9f, 0xa7,
+  0xd1, 0x38, 0x28, 0x1c, 0xbc, 0x42, 0xc4, 0xfd, 0x7d, 0x59, 0xb6, 0x6f,
+  0x4e, 0x60, 0xc8, 0x3f, 0xaa, 0x40, 0xde, 0x85, 0x9f, 0x23, 0x96, 0x24,
+  0x46, 0x1b, 0x24, 0x0a, 0xe6, 0xc4, 0xf7, 0x00, 0x07, 0x2e, 0x58, 0x8a,
+  0xe8, 0x2c, 0xe4, 0x3e, 0x22, 0xcc, 0xcb, 0x56, 0xfd, 0x11, 0x9c, 0x39,
+  0x74, 0x67, 0xc3, 0x91, 0x73, 0xc5, 0x0b, 0xc5, 0x51, 0x55, 0x9e, 0x55,
+  0x61, 0x53, 0xf1, 0xc2, 0x6c, 0x3e, 0xc3, 0xf7, 0x91, 0xd3, 0x87, 0xdd,
+  0x47, 0x2e, 0x6f, 0xe4, 0xb0, 0xa5, 0x77, 0x97, 0xd9, 0x7b, 0xcc, 0xa3,
+  0x3c, 0x95, 0x9f, 0x45, 0x4e, 0x0e, 0x11, 0x46, 0xdd, 0x79, 0x02, 0xb3,
+  0x9f, 0x9e, 0xcb, 0xf4, 0x9a, 0xb4, 0x9f, 0x5c, 0xe3, 0x08, 0xef, 0x2c,
+  0xd4, 0xc7, 0x01, 0xe4, 0xf3, 0xe4, 0xbe, 0x3a, 0x44, 0xce, 0xfd, 0xcb,
+  0x6f, 0x5d, 0x8f, 0x51, 0x5e, 0xf9, 0x22, 0x02, 0xb0, 0x1e, 0xa7, 0x86,
+  0xed, 0xc7, 0xc7, 0x49, 0x40, 0x52, 0xb8, 0xc9, 0x41, 0x84, 0xf4, 0x28,
+  0xd9, 0x38, 0x85, 0xee, 0x61, 0x4c, 0xdf, 0xa7, 0xdb, 0xad, 0x1f, 0xbf,
+  0xc6, 0xb1, 0xfb, 0x66, 0xaf, 0x84, 0xb3, 0x9d, 0x82, 0xd9, 0x9f, 0xe3,
+  0x48, 0xf3, 0x7e, 0xe5, 0x3a, 0x09, 0x77, 0xcd, 0x42, 0x37, 0xb4, 0x11,
+  0xec, 0xfd, 0x4b, 0x1a, 0xcb, 0xc8, 0x97, 0xd0, 0xd7, 0x15, 0xdd, 0xb4,
+  0x0d, 0xac, 0xf6, 0x0b, 0x12, 0xe5, 0x92, 0x7b, 0xeb, 0x83, 0x98, 0xfd,
+  0x6f, 0xaa, 0xd6, 0x01, 0x32, 0x2f, 0x3b, 0xf1, 0xab, 0x60, 0xa2, 0x43,
+  0xf4, 0xae, 0x1b, 0xc7, 0xec, 0x7f, 0x55, 0x94, 0xd2, 0x36, 0x30, 0x14,
+  0xdc, 0x8f, 0xe1, 0xf2, 0x05, 0xf7, 0x63, 0x08, 0x29, 0xfe, 0x59, 0x51,
+  0x4a, 0xdb, 0x40, 0xc7, 0x3f, 0xd0, 0x0b, 0xa0, 0x7c, 0xa5, 0xfe, 0xb5,
+  0xaa, 0x74, 0x17, 0x59, 0x27, 0x7d, 0x18, 0xee, 0xe1, 0x10, 0x48, 0x0b,
+  0x0c, 0xbd, 0x88, 0x0b, 0x27, 0x14, 0xad, 0xb4, 0x91, 0x27, 0x5b, 0x0f,
+  0xdc, 0x25, 0xcf, 0xc2, 0x7e, 0xdf, 0x8f, 0xf9, 0x7f, 0x54, 0xd4, 0xd2,
+  0x46, 0x06, 0x96, 0x3b, 0x23, 0x3c, 0x21, 0x5f, 0xfa, 0x21, 0x6a, 0x81,
+  0xeb, 0xb4, 0xa2, 0x78, 0x37, 0xb9, 0x98, 0xe1, 0x63, 0x1c, 0xcb, 0x08,
+  0xcf, 0x92, 0xf7, 0x06, 0xf4, 0x7d, 0x01, 0xcc, 0xc3, 0x2b, 0xb2, 0x37,
+  0xe2, 0x69, 0xfb, 0x8f, 0x60, 0xee, 0x5f, 0xa2, 0xef, 0x18, 0x20, 0x16,
+  0xef, 0x13, 0x5e, 0x26, 0x53, 0xbd, 0x97, 0x27, 0xbe, 0xee, 0x45, 0x5e,
+  0xb8, 0x80, 0x4f, 0xa0, 0x0c, 0x9a, 0x46, 0x7f, 0x8f, 0xee, 0x47, 0xd7,
+  0x44, 0x1b, 0x33, 0x95, 0xdd, 0x95, 0x95, 0x65, 0x65, 0xc6, 0xfc, 0xee,
+  0xfc, 0xeb, 0xa8, 0x27, 0x7a, 0x4d, 0xd4, 0x78, 0x42, 0xa3, 0xbe, 0x2b,
+  0x32, 0xe6, 0x4f, 0xe7, 0x5f, 0x15, 0x4f, 0x3c, 0xc0, 0x9e, 0x11, 0x77,
+  0xbc, 0x37, 0x93, 0x3f, 0xc7, 0x4e, 0x1b, 0xc9, 0x87, 0xe6, 0xfc, 0x7b,
+  0x33, 0x0a, 0x87, 0x78, 0x26, 0x7f, 0x7a, 0xc7, 0xef, 0xd9, 0x8c, 0x31,
+  0x5a, 0x86, 0x1a, 0x51, 0x86, 0x25, 0x05, 0xdb, 0x5d, 0x9a, 0xe9, 0xc9,
+  0xef, 0x9e, 0x99, 0x7d, 0xe7, 0x64, 0x0c, 0xce, 0x2a, 0x8a, 0xce, 0x68,
+  0x32, 0xcd, 0xf8, 0x33, 0x8a, 0x08, 0x17, 0x79, 0xa5, 0x92, 0x29, 0x43,
+  0xe4, 0xaf, 0xf1, 0x52, 0xfe, 0x63, 0x24, 0xd7, 0xd5, 0x97, 0xfb, 0x57,
+  0x6e, 0x85, 0xbf, 0x57, 0x44, 0x92, 0xdf, 0x79, 0x09, 0x4d, 0x7f, 0x0a,
+  0x49, 0x9e, 0x26, 0x84, 0x32, 0x95, 0x6c, 0xb4, 0xbb, 0x0c, 0x9f, 0x68,
+  0xd4, 0x14, 0xaa, 0xcd, 0x4a, 0x27, 0x86, 0x4c, 0x6f, 0x7e, 0x47, 0xfe,
+  0x12, 0x6a, 0x04, 0x15, 0x19, 0x76, 0x67, 0xb4, 0xac, 0xec, 0x8a, 0x55,
+  0xe3, 0xa5, 0xc6, 0xe6, 0xe9, 0xcc, 0x9c, 0xb7, 0x6a, 0x19, 0x3c, 0x83,
+  0xf2, 0xd1, 0xde, 0x8c, 0x38, 0x63, 0xcc, 0xb3, 0x97, 0xc6, 0xde, 0x7b,
+  0xf5, 0xfe, 0xd3, 0x6b, 0xcf, 0xff, 0xe6, 0x81, 0x66, 0x71, 0xdf, 0xeb,
+  0x63, 0x63, 0xd3, 0xdf, 0x79, 0xc0, 0x20, 0x46, 0x35, 0xb3, 0xcc, 0xe2,
+  0x89, 0xde, 0x1d, 0x79, 0xcd, 0x8c, 0x38, 0xfd, 0x40, 0xf6, 0xfc, 0xeb,
+  0xe3, 0xdf, 0xdf, 0xf7, 0x80, 0x38, 0xdd, 0x9c, 0xc9, 0xef, 0xb8, 0xc4,
+  0x4e, 0x6b, 0x0a, 0xa3, 0xe9, 0xcd, 0x66, 0x72, 0xd1, 0x8f, 0xd1, 0x0c,
+  0x9e, 0x66, 0xcf, 0x68, 0x32, 0xc6, 0x13, 0x62, 0xb4, 0x19, 0xdd, 0x8f,
+  0x7f, 0xab, 0xd9, 0x77, 0xc9, 0x38, 0xad, 0x2a, 0xca, 0xff, 0xf6, 0x52,
+  0xe6, 0x92, 0x26, 0xf3, 0x00, 0xfc, 0x35, 0xe6, 0xff, 0x3c, 0xf3, 0x29,
+  0x8b, 0xcc, 0xb5, 0xb9, 0x31, 0x7f, 0x2e, 0xdf, 0xb8, 0xf6, 0xd7, 0x1f,
+  0x6b, 0xba, 0x9b, 0x61, 0x02, 0x14, 0x86, 0xe6, 0xf1, 0xfc, 0x6b, 0xc0,
+  0x80, 0xba, 0xd9, 0x13, 0xc6, 0x99, 0xe6, 0x33, 0xec, 0x89, 0x32, 0xf4,
+  0x00, 0x3b, 0x7d, 0x6d, 0xfe, 0xf5, 0x39, 0x06, 0xfb, 0x35, 0x10, 0xbb,
+  0xd9, 0x68, 0x25, 0xca, 0x68, 0x50, 0x23, 0x2e, 0x7c, 0x50, 0x47, 0xa2,
+  0xce, 0xe4, 0xdc, 0x69, 0x9d, 0xab, 0x21, 0x63, 0xcc, 0x5c, 0x7b, 0xa2,
+  0xe7, 0xd7, 0xe3, 0xaf, 0xef, 0xdc, 0xab, 0x79, 0x4d, 0x73, 0x46, 0x73,
+  0x82, 0x4c, 0x4f, 0x25, 0x4c, 0x50, 0x37, 0x98, 0xec, 0x84, 0x3a, 0x0e,
+  0xf2, 0xed, 0x86, 0xeb, 0xef, 0xd9, 0x6e, 0xfd, 0x6a, 0x8b, 0xaf, 0x65,
+  0x73, 0x7d, 0x67, 0xcb, 0xc6, 0xaf, 0x43, 0xe1, 0xdb, 0xb0, 0x71, 0xd3,
+  0x46, 0xdf, 0xc6, 0xcd, 0x6d, 0x81, 0x95, 0x6a, 0xfb, 0xcd, 0x81, 0x16,
+  0x6b, 0xe8, 0xee, 0x2e, 0xab, 0xb7, 0x65, 0x73, 0xcb, 0xfa, 0x96, 0x95,
+  0x56, 0x35, 0xa9, 0xed, 0x6d, 0x37, 0xfb, 0xdb, 0x7d, 0x6d, 0xb3, 0xf4,
+  0xb9, 0xed, 0xd6, 0x2f, 0x48, 0x7f, 0xe9, 0x76, 0x61, 0x94, 0x7c, 0xe7,
+  0xe9, 0xca, 0x7f, 0xac, 0xef, 0xfe, 0x75, 0xbd, 0x3f, 0x2e, 0xa6, 0x62,
+  0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62,
+  0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62,
+  0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62,
+  0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0x62, 0x2a, 0xa6, 0xff, 0xb7, 0x24, 0x8c,
+  0xa2, 0x31, 0xbd, 0x47, 0x87, 0xf8, 0xd1, 0xd9, 0x27, 0xa7, 0xfc, 0x9f,
+  0x81, 0xda, 0xff, 0x89, 0x12, 0x1f, 0xbd, 0x8b, 0x12, 0xdd, 0x90, 0x3b,
+  0x21, 0x6f, 0xdc, 0xbc, 0xb1, 0xd1, 0xe9, 0x6a, 0x58, 0xf3, 0xd9, 0xff,
+  0x49, 0x80, 0xa9, 0x04, 0xca, 0x90, 0xef, 0x08, 0x0b, 0xa3, 0x4c, 0x50,
+  0x18, 0xe4, 0x63, 0x1a, 0xfa, 0x9b, 0x05, 0x38, 0xa6, 0x47, 0x35, 0xed,
+  0x4c, 0xb2, 0xae, 0x45, 0x87, 0x36, 0x20, 0x94, 0x38, 0x08, 0x7a, 0x30,
+  0x70, 0xd4, 0x79, 0xf0, 0xfb, 0x19, 0xf8, 0xbc, 0x39, 0xb8, 0x76, 0x6c,
+  0x51, 0x03, 0x8a, 0x9f, 0xef, 0xd6, 0xa3, 0xd1, 0xee, 0x15, 0x92, 0xd4,
+  0xee, 0xe9, 0xf2, 0x06, 0xad, 0x83, 0x42, 0x2c, 0xfb, 0x2b, 0xd0, 0x3b,
+  0x56, 0x6e, 0xc5, 0x7b, 0x56, 0x48, 0xf8, 0x14, 0xf9, 0xc6, 0xb1, 0x3d,
+  0x98, 0xcf, 0x73, 0x49, 0x36, 0x6d, 0x09, 0x37, 0xb8, 0x96, 0x23, 0xf9,
+  0x37, 0x54, 0xad, 0x37, 0x6d, 0xdc, 0x54, 0x15, 0x25, 0xfd, 0x96, 0xa4,
+  0x4b, 0xdf, 0xd6, 0x7b, 0xaf, 0xbb, 0x57, 0x6b, 0xd5, 0xc7, 0xb5, 0xf2,
+  0x6f, 0xb3, 0x59, 0x85, 0xb8, 0x26, 0xed, 0x0c, 0x4a, 0x83, 0x4c, 0x9c,
+  0x03, 0x04, 0x35, 0xed, 0xf2, 0xf7, 0x96, 0x9f, 0x07, 0x0c, 0xa3, 0xef,
+  0xca, 0x58, 0x10, 0xc2, 0x09, 0x04, 0xf2, 0x35, 0x0e, 0xf9, 0x5b, 0xc6,
+  0x52, 0xfb, 0xe6, 0xd7, 0xbf, 0x82, 0x2b, 0x1b, 0xd8, 0x6e, 0x9d, 0x47,
+  0xeb, 0xe1, 0xbb, 0x36, 0x54, 0x95, 0xc4, 0xc9, 0x73, 0x6a, 0xdf, 0xa6,
+  0x86, 0x9a, 0x76, 0xf2, 0x4d, 0xe1, 0xa9, 0xc8, 0x54, 0x58, 0x8f, 0xca,
+  0x11, 0x1f, 0xf1, 0x24, 0xd7, 0xda, 0xca, 0x6d, 0x38, 0x56, 0x61, 0x47,
+  0x71, 0x21, 0x7c, 0x1d, 0xfd, 0x54, 0x02, 0x9f, 0x0c, 0x3d, 0x42, 0x88,
+  0xdd, 0x02, 0x3a, 0x58, 0xd3, 0xfa, 0x99, 0x7d, 0xdc, 0xf6, 0x77, 0x5f,
+  0x08, 0x04, 0xd5, 0x7a, 0x2a, 0x06, 0xf6, 0x46, 0x16, 0x89, 0x3c, 0xcd,
+  0xf4, 0x69, 0x92, 0x84, 0x10, 0xa1, 0xf0, 0xf4, 0x49, 0xea, 0x26, 0x29,
+  0x3f, 0xa6, 0x52, 0xcc, 0x94, 0x62, 0x96, 0xc8, 0x37, 0x75, 0xa5, 0x90,
+  0x48, 0xbe, 0xef, 0x88, 0x2a, 0x6c, 0x52, 0xfb, 0xd5, 0x0e, 0xed, 0xb8,
+  0x45, 0x32, 0x79, 0x89, 0x4e, 0xf2, 0x6b, 0xa3, 0xa6, 0xf5, 0x53, 0x71,
+  0x7c, 0xef, 0xcc, 0xf6, 0xa9, 0x08, 0x19, 0x63, 0x39, 0xfa, 0xbc, 0xff,
+  0xf3, 0x01, 0xf3, 0xe3, 0x58, 0xe8, 0x50, 0x47, 0xbb, 0xd5, 0xa1, 0x6f,
+  0xfd, 0xb6, 0x63, 0xea, 0xf6, 0xa9, 0xad, 0xea, 0xc8, 0xa6, 0x42, 0x53,
+  0x41, 0x59, 0x83, 0xcc, 0xc7, 0x27, 0x85, 0x94, 0xa9, 0x95, 0x89, 0x59,
+  0x82, 0xf8, 0x8d, 0x0b, 0x71, 0xd2, 0xae, 0x47, 0x53, 0x41, 0x1d, 0x4a,
+  0xdc, 0x71, 0xdb, 0x08, 0x30, 0x21, 0x14, 0xcd, 0xe7, 0x51, 0x10, 0x21,
+  0x4f, 0xf4, 0xb6, 0x11, 0x06, 0x91, 0x5f, 0x9b, 0x15, 0x50, 0x23, 0x42,
+  0x79, 0x0c, 0x8d, 0xf5, 0x68, 0x24, 0x4f, 0x7e, 0xba, 0x8f, 0xa3, 0xdf,
+  0x03, 0x1c, 0xa5, 0xb4, 0x2a, 0x68, 0xb3, 0x22, 0xf2, 0x85, 0xca, 0xa5,
+  0x68, 0xff, 0xbd, 0xb7, 0x8d, 0x48, 0x8c, 0xc4, 0x90, 0xfa, 0x08, 0xd4,
+  0xb1, 0x15, 0x5b, 0x29, 0xfd, 0x3b, 0xb7, 0x8d, 0x2c, 0x41, 0xdb, 0x18,
+  0xb2, 0x3e, 0x55, 0xdc, 0xc5, 0x54, 0x4c, 0xc5, 0x54, 0x4c, 0xc5, 0xf4,
+  0xef, 0x3c, 0xdf, 0xc9, 0xb7, 0xd7, 0x11, 0x3e, 0x46, 0x3f, 0x8c, 0xa1,
+  0x63, 0x0c, 0x3d, 0xe1, 0x2f, 0xbd, 0x40, 0xcf, 0xce, 0x0c, 0x3a, 0xa6,
+  0x49, 0x09, 0xe9, 0x6b, 0x24, 0xf2, 0x5b, 0xdc, 0x0c, 0xe2, 0x0e, 0x2c,
+  0xa6, 0xbf, 0xdf, 0x2d, 0xd0, 0x5f, 0xaf, 0xa2, 0x12, 0x23, 0xbf, 0x07,
+  0x1e, 0x3c, 0xca, 0xde, 0xc3, 0x10, 0x3d, 0x93, 0x73, 0xf9, 0x35, 0x69,
+  0xfe, 0x6d, 0xf6, 0xb0, 0xde, 0x8b, 0x3e, 0x20, 0xdf, 0xc2, 0x47, 0x9c,
+  0xcc, 0x3f, 0x0a, 0xfc, 0x68, 0x06, 0x1d, 0xf3, 0x40, 0x5f, 0xe6, 0xd1,
+  0x32, 0x8f, 0xb6, 0x81, 0x0d, 0xb1, 0x61, 0x36, 0xc2, 0x76, 0xb1, 0x5b,
+  0xd8, 0xad, 0xec, 0xed, 0xec, 0x1d, 0xec, 0x9d, 0xec, 0xdf, 0xb1, 0xff,
+  0x89, 0xbd, 0x8b, 0xfd, 0x16, 0x7b, 0xb7, 0x06, 0x34, 0xeb, 0x46, 0x57,
+  0x7a, 0x84, 0xd1, 0xbf, 0xf3, 0xb0, 0x10, 0x15, 0xe8, 0x3d, 0xf3, 0x82,
+  0x32, 0x36, 0x8e, 0xe8, 0x99, 0x84, 0x58, 0x01, 0x14, 0x9f, 0x41, 0xa8,
+  0x9b, 0xd4, 0x49, 0x0b, 0x4e, 0xa1, 0x71, 0x3d, 0x72, 0x49, 0x95, 0x70,
+  0x8e, 0xf0, 0xa3, 0x4c, 0x88, 0x4f, 0x2d, 0xb7, 0x71, 0x43, 0x75, 0x36,
+  0x8b, 0x55, 0x43, 0xcf, 0x46, 0xa4, 0xd5, 0x21, 0xd2, 0xf6, 0x42, 0x0c,
+  0xd1, 0x08, 0x01, 0x62, 0x8d, 0x50, 0x5d, 0x8b, 0x1c, 0x6b, 0x10, 0x80,
+  0xf3, 0x01, 0x57, 0x49, 0xcb, 0x46, 0x1f, 0xf9, 0xba, 0xbd, 0xd5, 0xb9,
+  0xb2, 0xc1, 0xad, 0x7e, 0xc7, 0x3e, 0x74, 0xb7, 0xd5, 0xe5, 0x24, 0xdf,
+  0xb1, 0x5f, 0x6b, 0x75, 0xae, 0x59, 0xe7, 0x74, 0xad, 0x5b, 0xbd, 0xb6,
+  0x84, 0x08, 0x9c, 0xee, 0x89, 0x84, 0xdd, 0xfc, 0x1e, 0x6f, 0x10, 0xdf,
+  0xef, 0xb3, 0x86, 0xd7, 0x5c, 0xdc, 0x87, 0x21, 0x52, 0xf1, 0x06, 0x8b,
+  0x2b, 0xab, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98,
+  0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98,
+  0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98,
+  0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0x8a, 0xa9, 0x98, 0xfe, 0x7f, 0xa6,
+  0xff, 0x0b, 0xf2, 0x5f, 0xb2, 0xa3
+};
+
+#define IP_TEMPLATE_COUNT 2
+
+/* Default template is the first entry */
+static const ip_template_entry_t ip_templates[IP_TEMPLATE_COUNT] = {
+  { "lienus", 0xbcfc1cd8UL, 8429, ip_template_data_0 },
+  { "aip", 0x424edc7eUL, 8502, ip_template_data_1 },
 };
 
 #endif /* __IPTMPL_H__ */
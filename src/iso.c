@@ -0,0 +1,1513 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "iso.h"
+
+#include <dirent.h>
+#include <pthread.h>
+
+#include "ip.h"
+#include "cdi.h"
+#include "output.h"
+#include "pool.h"
+#include "vector.h"
+
+// identifiers are limited like with "mkisofs -l" (ISO9660 level 2)
+#define ISO_NAME_MAX 31
+#define ISO_JOLIET_NAME_MAX 64
+
+// file data read ahead by the reader threads
+#define ISO_READ_AHEAD (64 * 1024 * 1024)
+
+// files larger than this are streamed by the writer itself
+#define ISO_STREAM_THRESHOLD (ISO_READ_AHEAD / 4)
+#define ISO_STREAM_CHUNK (1024 * 1024)
+
+#define ISO_WRITE_BUFFER (4 * 1024 * 1024)
+
+#define ISO_SYSTEM_AREA_SECTORS 16
+
+// dummy file moving the data towards the outer edge of the disc
+#define ISO_PADDING_NAME "0PADDING.DAT"
+
+#define ISO_HIERARCHY_PRIMARY 0
+#define ISO_HIERARCHY_JOLIET 1
+
+typedef struct iso_node_t {
+  char *name;
+  char *path;
+  char iso_name[ISO_NAME_MAX + 3];  // with the ";1" version for files
+  uint16_t joliet_name[ISO_JOLIET_NAME_MAX];
+  int joliet_length;
+  int is_dir;
+  uint64_t size;
+  time_t mtime;
+  struct iso_node_t *parent;
+  vector children;
+  uint32_t extent;         // absolute LBA of the file data
+  uint32_t dir_extent[2];  // absolute LBA of the directory, per hierarchy
+  uint32_t dir_size[2];
+  int dir_number[2];       // number in the path table, per hierarchy
+  int padding;             // zero-filled file sized by the layout
+  int placed;              // already ordered by the layout engine
+  uint32_t default_start;  // offset of the data with the default order
+} iso_node_t;
+
+typedef struct iso_writer_t {
+  int fd;
+  char *filename;
+  char *buffer;
+  size_t used;
+  uint64_t written;
+  int error;
+  sector_format_t format;
+  char *raw;               // buffer encoded as raw sectors (if needed)
+  uint32_t lba;            // address of the next sector to be flushed
+} iso_writer_t;
+
+typedef struct iso_image_t {
+  iso_options_t *options;
+  iso_node_t *root;
+  int hierarchies;
+  vector dirs[2];          // directories in path table order
+  vector files;            // regular files in data order
+  uint32_t path_table_size[2];
+  uint32_t path_table_extent[2][2];  // [hierarchy][L, M]
+  uint32_t sectors;        // total size of the image
+  time_t now;
+  char volume_id[33];
+  vector accesses;         // files in the order of the trace (if any)
+} iso_image_t;
+
+typedef enum iso_slot_state_t {
+  ISO_SLOT_PENDING = 0,
+  ISO_SLOT_READY,
+  ISO_SLOT_STREAM,
+  ISO_SLOT_ERROR
+} iso_slot_state_t;
+
+typedef struct iso_reader_t {
+  vector *files;
+  int count;
+  int next;          // next file to be read
+  size_t inflight;   // bytes read but not written yet
+  char **data;
+  iso_slot_state_t *state;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+} iso_reader_t;
+
+/* Low level encoding helpers */
+
+static void
+iso_le16(unsigned char *p, uint16_t v)
+{
+  p[0] = v & 0xff;
+  p[1] = v >> 8;
+}
+
+static void
+iso_be16(unsigned char *p, uint16_t v)
+{
+  p[0] = v >> 8;
+  p[1] = v & 0xff;
+}
+
+static void
+iso_le32(unsigned char *p, uint32_t v)
+{
+  p[0] = v & 0xff;
+  p[1] = (v >> 8) & 0xff;
+  p[2] = (v >> 16) & 0xff;
+  p[3] = v >> 24;
+}
+
+static void
+iso_be32(unsigned char *p, uint32_t v)
+{
+  p[0] = v >> 24;
+  p[1] = (v >> 16) & 0xff;
+  p[2] = (v >> 8) & 0xff;
+  p[3] = v & 0xff;
+}
+
+static void
+iso_both16(unsigned char *p, uint16_t v)
+{
+  iso_le16(p, v);
+  iso_be16(p + 2, v);
+}
+
+static void
+iso_both32(unsigned char *p, uint32_t v)
+{
+  iso_le32(p, v);
+  iso_be32(p + 4, v);
+}
+
+static void
+iso_strpad(unsigned char *p, const char *str, int length)
+{
+  memset(p, ' ', length);
+  memcpy(p, str, (strlen(str) < length) ? strlen(str) : length);
+}
+
+static void
+iso_ucs2pad(unsigned char *p, const char *str, int length)
+{
+  for (int i = 0; i < length / 2; i++) {
+    iso_be16(p + i * 2, (i < strlen(str)) ? (unsigned char) str[i] : ' ');
+  }
+}
+
+static void
+iso_date_record(unsigned char *p, time_t t)
+{
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  p[0] = tm.tm_year;
+  p[1] = tm.tm_mon + 1;
+  p[2] = tm.tm_mday;
+  p[3] = tm.tm_hour;
+  p[4] = tm.tm_min;
+  p[5] = tm.tm_sec;
+  p[6] = 0; // GMT
+}
+
+static void
+iso_date_volume(unsigned char *p, time_t t)
+{
+  char buf[18];
+  struct tm tm;
+
+  if (!t) {
+    // unspecified date
+    memset(p, '0', 16);
+    p[16] = 0;
+    return;
+  }
+
+  gmtime_r(&t, &tm);
+  strftime(buf, sizeof(buf), "%Y%m%d%H%M%S00", &tm);
+  memcpy(p, buf, 16);
+  p[16] = 0;
+}
+
+static uint32_t
+iso_sectors(uint64_t size)
+{
+  return (size + ISO_SECTOR_SIZE - 1) / ISO_SECTOR_SIZE;
+}
+
+/* Output */
+
+static void
+iso_writer_flush(iso_writer_t *w)
+{
+  char *data = w->buffer;
+  size_t size = w->used;
+
+  // the buffer is only flushed on sector boundaries, so it can be encoded
+  // as a whole, in parallel
+  if (w->format != SECTOR_FORMAT_ISO) {
+    uint32_t count = w->used / ISO_SECTOR_SIZE;
+    sector_encode_range(w->format, w->lba, w->buffer, w->raw, count);
+    data = w->raw;
+    size = count * sector_size(w->format);
+  }
+  w->lba += w->used / ISO_SECTOR_SIZE;
+
+  if (!w->error && !file_write_full(w->fd, data, size)) {
+    log_error("unable to write \"%s\": %s\n", w->filename, strerror(errno));
+    w->error = 1;
+  }
+
+  w->used = 0;
+}
+
+static void
+iso_writer_write(iso_writer_t *w, const void *data, size_t size)
+{
+  const char *p = (const char *) data;
+
+  while (size > 0) {
+    size_t length = ISO_WRITE_BUFFER - w->used;
+    if (length > size) {
+      length = size;
+    }
+    memcpy(w->buffer + w->used, p, length);
+    w->used += length;
+    w->written += length;
+    p += length;
+    size -= length;
+    if (w->used == ISO_WRITE_BUFFER) {
+      iso_writer_flush(w);
+    }
+  }
+}
+
+static void
+iso_writer_pad(iso_writer_t *w)
+{
+  static const char zero[ISO_SECTOR_SIZE];
+  size_t remainder = w->written % ISO_SECTOR_SIZE;
+
+  if (remainder) {
+    iso_writer_write(w, zero, ISO_SECTOR_SIZE - remainder);
+  }
+}
+
+/* Names */
+
+static int
+iso_name_make(iso_node_t *node)
+{
+  char *dot = node->is_dir ? NULL : strrchr(node->name, '.');
+  int length = 0;
+
+  // d-characters only, the extension dot is kept for files
+  for (char *p = node->name; *p && length < ISO_NAME_MAX; p++) {
+    char c = toupper((unsigned char) *p);
+    if (p == dot) {
+      c = '.';
+    } else if (!isalnum((unsigned char) c) && c != '_') {
+      c = '_';
+    }
+    node->iso_name[length++] = c;
+  }
+
+  if (!node->is_dir) {
+    if (dot == NULL && length < ISO_NAME_MAX) {
+      node->iso_name[length++] = '.';
+    }
+    strcpy(node->iso_name + length, ";1");
+  } else {
+    node->iso_name[length] = '\0';
+  }
+
+  if (strlen(node->name) > ISO_NAME_MAX) {
+    log_warn("name \"%s\" truncated to \"%s\"\n", node->path, node->iso_name);
+  }
+
+  // Joliet names are UCS-2, decode UTF-8 input (BMP only)
+  const unsigned char *u = (const unsigned char *) node->name;
+  node->joliet_length = 0;
+  while (*u && node->joliet_length < ISO_JOLIET_NAME_MAX) {
+    uint16_t c;
+    if (*u < 0x80) {
+      c = *u++;
+    } else if ((*u & 0xe0) == 0xc0 && u[1]) {
+      c = ((u[0] & 0x1f) << 6) | (u[1] & 0x3f);
+      u += 2;
+    } else if ((*u & 0xf0) == 0xe0 && u[1] && u[2]) {
+      c = ((u[0] & 0x0f) << 12) | ((u[1] & 0x3f) << 6) | (u[2] & 0x3f);
+      u += 3;
+    } else {
+      c = '_';
+      u++;
+    }
+    node->joliet_name[node->joliet_length++] = c;
+  }
+
+  return 1;
+}
+
+static int
+iso_compare_primary(const void *a, const void *b)
+{
+  return strcmp((*(iso_node_t **) a)->iso_name, (*(iso_node_t **) b)->iso_name);
+}
+
+static int
+iso_compare_joliet(const void *a, const void *b)
+{
+  iso_node_t *x = *(iso_node_t **) a;
+  iso_node_t *y = *(iso_node_t **) b;
+  for (int i = 0; i < x->joliet_length && i < y->joliet_length; i++) {
+    if (x->joliet_name[i] != y->joliet_name[i]) {
+      return x->joliet_name[i] - y->joliet_name[i];
+    }
+  }
+  return x->joliet_length - y->joliet_length;
+}
+
+/* Tree */
+
+static void
+iso_node_free(iso_node_t *node)
+{
+  for (int i = 0; i < vector_total(&node->children); i++) {
+    iso_node_free((iso_node_t *) vector_get(&node->children, i));
+  }
+  vector_free(&node->children);
+  free(node->name);
+  free(node->path);
+  free(node);
+}
+
+static iso_node_t *
+iso_node_create(iso_node_t *parent, char *name, char *path, struct stat *stats)
+{
+  iso_node_t *node = (iso_node_t *) calloc(1, sizeof(iso_node_t));
+
+  node->name = strdup(name);
+  node->path = strdup(path);
+  node->parent = parent;
+  node->is_dir = S_ISDIR(stats->st_mode);
+  node->size = node->is_dir ? 0 : stats->st_size;
+  node->mtime = stats->st_mtime;
+  vector_init(&node->children);
+
+  if (parent != NULL) {
+    iso_name_make(node);
+  }
+
+  return node;
+}
+
+static int
+iso_scan(iso_node_t *dir)
+{
+  DIR *dh = opendir(dir->path);
+  struct dirent *entry;
+  int result = 1;
+
+  if (dh == NULL) {
+    log_error("can't open directory \"%s\"\n", dir->path);
+    return 0;
+  }
+
+  while (result && (entry = readdir(dh)) != NULL) {
+    struct stat stats;
+
+    if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+      continue;
+    }
+
+    char *path = (char *) malloc(strlen(dir->path) + strlen(entry->d_name) + 2);
+    sprintf(path, "%s/%s", dir->path, entry->d_name);
+
+    if (stat(path, &stats) == -1) {
+      log_error("can't stat \"%s\"\n", path);
+      result = 0;
+    } else if (S_ISDIR(stats.st_mode) || S_ISREG(stats.st_mode)) {
+      if (S_ISREG(stats.st_mode) && stats.st_size > 0xffffffffLL) {
+        log_error("file \"%s\" is too large\n", path);
+        result = 0;
+      } else {
+        iso_node_t *node = iso_node_create(dir, entry->d_name, path, &stats);
+        vector_add(&dir->children, node);
+        if (node->is_dir) {
+          result = iso_scan(node);
+        }
+      }
+    } else {
+      log_warn("skipping special file \"%s\"\n", path);
+    }
+
+    free(path);
+  }
+
+  closedir(dh);
+
+  if (result) {
+    // identifiers must be sorted and unique in each directory
+    qsort(dir->children.items, vector_total(&dir->children), sizeof(void *),
+      iso_compare_primary);
+
+    for (int i = 1; i < vector_total(&dir->children) && result; i++) {
+      iso_node_t *a = (iso_node_t *) vector_get(&dir->children, i - 1);
+      iso_node_t *b = (iso_node_t *) vector_get(&dir->children, i);
+      if (!strcmp(a->iso_name, b->iso_name)) {
+        log_error("\"%s\" and \"%s\" have the same ISO9660 name\n", a->path, b->path);
+        result = 0;
+      }
+    }
+  }
+
+  return result;
+}
+
+static void
+iso_children_sorted(iso_node_t *dir, int hierarchy, iso_node_t **children)
+{
+  int count = vector_total(&dir->children);
+
+  memcpy(children, dir->children.items, count * sizeof(iso_node_t *));
+  if (hierarchy == ISO_HIERARCHY_JOLIET) {
+    qsort(children, count, sizeof(iso_node_t *), iso_compare_joliet);
+  }
+}
+
+static int
+iso_name_length(iso_node_t *node, int hierarchy)
+{
+  return (hierarchy == ISO_HIERARCHY_JOLIET) ? node->joliet_length * 2 :
+    (int) strlen(node->iso_name);
+}
+
+static int
+iso_record_length(int name_length)
+{
+  return 33 + name_length + ((33 + name_length) & 1);
+}
+
+// Offset of the next record of a directory: records never cross a sector
+// boundary
+static uint32_t
+iso_record_offset(uint32_t offset, int length)
+{
+  if ((offset % ISO_SECTOR_SIZE) + length > ISO_SECTOR_SIZE) {
+    offset += ISO_SECTOR_SIZE - (offset % ISO_SECTOR_SIZE);
+  }
+
+  return offset;
+}
+
+// Bytes used by the records of a directory, in the order they are written
+// for that hierarchy (see iso_write_directory())
+static uint32_t
+iso_directory_length(iso_node_t *dir, int hierarchy)
+{
+  int count = vector_total(&dir->children);
+  iso_node_t **children = (iso_node_t **) malloc((count + 1) * sizeof(iso_node_t *));
+  uint32_t offset = 2 * iso_record_length(1);  // "." and ".."
+
+  iso_children_sorted(dir, hierarchy, children);
+
+  for (int i = 0; i < count; i++) {
+    int length = iso_record_length(iso_name_length(children[i], hierarchy));
+    offset = iso_record_offset(offset, length) + length;
+  }
+
+  free(children);
+
+  return offset;
+}
+
+static void
+iso_collect(iso_image_t *image)
+{
+  // breadth-first order gives the path table order
+  for (int h = 0; h < image->hierarchies; h++) {
+    vector_init(&image->dirs[h]);
+    vector_add(&image->dirs[h], image->root);
+
+    for (int i = 0; i < vector_total(&image->dirs[h]); i++) {
+      iso_node_t *dir = (iso_node_t *) vector_get(&image->dirs[h], i);
+      int count = vector_total(&dir->children);
+      iso_node_t **children = (iso_node_t **) malloc((count + 1) * sizeof(iso_node_t *));
+
+      dir->dir_number[h] = i + 1;
+      iso_children_sorted(dir, h, children);
+
+      for (int j = 0; j < count; j++) {
+        if (children[j]->is_dir) {
+          vector_add(&image->dirs[h], children[j]);
+        } else if (h == ISO_HIERARCHY_PRIMARY) {
+          vector_add(&image->files, children[j]);
+        }
+      }
+
+      free(children);
+    }
+  }
+}
+
+static void
+iso_layout(iso_image_t *image)
+{
+  uint32_t lba = image->options->lba;
+  uint32_t sector = ISO_SYSTEM_AREA_SECTORS;
+
+  // volume descriptors: primary, Joliet (if any) and terminator
+  sector += image->hierarchies + 1;
+
+  // path tables (L and M types)
+  for (int h = 0; h < image->hierarchies; h++) {
+    uint32_t size = 0;
+    for (int i = 0; i < vector_total(&image->dirs[h]); i++) {
+      iso_node_t *dir = (iso_node_t *) vector_get(&image->dirs[h], i);
+      int length = (dir == image->root) ? 1 : iso_name_length(dir, h);
+      size += 8 + length + (length & 1);
+    }
+    image->path_table_size[h] = size;
+    for (int type = 0; type < 2; type++) {
+      image->path_table_extent[h][type] = lba + sector;
+      sector += iso_sectors(size);
+    }
+  }
+
+  // directories
+  for (int h = 0; h < image->hierarchies; h++) {
+    for (int i = 0; i < vector_total(&image->dirs[h]); i++) {
+      iso_node_t *dir = (iso_node_t *) vector_get(&image->dirs[h], i);
+      uint32_t offset = iso_directory_length(dir, h);
+
+      dir->dir_size[h] = iso_sectors(offset) * ISO_SECTOR_SIZE;
+      dir->dir_extent[h] = lba + sector;
+      sector += iso_sectors(offset);
+    }
+  }
+
+  // file data, the padding file moving the other ones to the requested LBA
+  uint32_t data_sectors = 0;
+  for (int i = 0; i < vector_total(&image->files); i++) {
+    iso_node_t *file = (iso_node_t *) vector_get(&image->files, i);
+    if (!file->padding) {
+      data_sectors += iso_sectors(file->size);
+    }
+  }
+
+  for (int i = 0; i < vector_total(&image->files); i++) {
+    iso_node_t *file = (iso_node_t *) vector_get(&image->files, i);
+    if (file->padding) {
+      uint32_t target = image->options->pad_to;
+      if (target == ISO_PAD_OUTER) {
+        uint32_t capacity = image->options->capacity ?
+          image->options->capacity : ISO_CD_CAPACITY;
+        target = (capacity > data_sectors) ? capacity - data_sectors : 0;
+      }
+      file->size = (target > lba + sector) ?
+        (uint64_t) (target - lba - sector) * ISO_SECTOR_SIZE : 0;
+    }
+    file->extent = lba + sector;
+    sector += iso_sectors(file->size);
+  }
+
+  image->sectors = sector;
+}
+
+/* Metadata */
+
+static int
+iso_record(unsigned char *p, iso_node_t *node, int hierarchy, int special)
+{
+  int name_length = special ? 1 : iso_name_length(node, hierarchy);
+  int length = iso_record_length(name_length);
+
+  memset(p, 0, length);
+  p[0] = length;
+  if (node->is_dir) {
+    iso_both32(p + 2, node->dir_extent[hierarchy]);
+    iso_both32(p + 10, node->dir_size[hierarchy]);
+  } else {
+    iso_both32(p + 2, node->size ? node->extent : 0);
+    iso_both32(p + 10, node->size);
+  }
+  iso_date_record(p + 18, node->mtime);
+  p[25] = node->is_dir ? 0x02 : 0x00;
+  iso_both16(p + 28, 1);
+  p[32] = name_length;
+
+  if (special) {
+    p[33] = special - 1; // 0x00 for ".", 0x01 for ".."
+  } else if (hierarchy == ISO_HIERARCHY_JOLIET) {
+    for (int i = 0; i < node->joliet_length; i++) {
+      iso_be16(p + 33 + i * 2, node->joliet_name[i]);
+    }
+  } else {
+    memcpy(p + 33, node->iso_name, name_length);
+  }
+
+  return length;
+}
+
+static void
+iso_write_directory(iso_writer_t *w, iso_node_t *dir, int hierarchy)
+{
+  int count = vector_total(&dir->children);
+  iso_node_t **children = (iso_node_t **) malloc((count + 1) * sizeof(iso_node_t *));
+  unsigned char *data = (unsigned char *) calloc(1, dir->dir_size[hierarchy]);
+  uint32_t offset = 0;
+
+  iso_children_sorted(dir, hierarchy, children);
+
+  offset += iso_record(data + offset, dir, hierarchy, 1);
+  offset += iso_record(data + offset, dir->parent ? dir->parent : dir, hierarchy, 2);
+
+  for (int i = 0; i < count; i++) {
+    int length = iso_record_length(iso_name_length(children[i], hierarchy));
+    offset = iso_record_offset(offset, length);
+    // the extent was sized by iso_directory_length()
+    if (offset + length > dir->dir_size[hierarchy]) {
+      halt("records of directory \"%s\" don't fit in its extent\n", dir->path);
+    }
+    offset += iso_record(data + offset, children[i], hierarchy, 0);
+  }
+
+  iso_writer_write(w, data, dir->dir_size[hierarchy]);
+
+  free(data);
+  free(children);
+}
+
+static void
+iso_write_path_table(iso_writer_t *w, iso_image_t *image, int hierarchy, int msb)
+{
+  uint32_t size = iso_sectors(image->path_table_size[hierarchy]) * ISO_SECTOR_SIZE;
+  unsigned char *data = (unsigned char *) calloc(1, size);
+  unsigned char *p = data;
+
+  for (int i = 0; i < vector_total(&image->dirs[hierarchy]); i++) {
+    iso_node_t *dir = (iso_node_t *) vector_get(&image->dirs[hierarchy], i);
+    int is_root = (dir == image->root);
+    int length = is_root ? 1 : iso_name_length(dir, hierarchy);
+    int parent = is_root ? 1 : dir->parent->dir_number[hierarchy];
+
+    p[0] = length;
+    if (msb) {
+      iso_be32(p + 2, dir->dir_extent[hierarchy]);
+      iso_be16(p + 6, parent);
+    } else {
+      iso_le32(p + 2, dir->dir_extent[hierarchy]);
+      iso_le16(p + 6, parent);
+    }
+
+    if (is_root) {
+      p[8] = 0;
+    } else if (hierarchy == ISO_HIERARCHY_JOLIET) {
+      for (int j = 0; j < dir->joliet_length; j++) {
+        iso_be16(p + 8 + j * 2, dir->joliet_name[j]);
+      }
+    } else {
+      memcpy(p + 8, dir->iso_name, length);
+    }
+
+    p += 8 + length + (length & 1);
+  }
+
+  iso_writer_write(w, data, size);
+  free(data);
+}
+
+static void
+iso_write_volume_descriptor(iso_writer_t *w, iso_image_t *image, int hierarchy)
+{
+  unsigned char d[ISO_SECTOR_SIZE];
+  int joliet = (hierarchy == ISO_HIERARCHY_JOLIET);
+  void (*strpad)(unsigned char *, const char *, int) = joliet ? iso_ucs2pad : iso_strpad;
+
+  memset(d, 0, sizeof(d));
+
+  d[0] = joliet ? 2 : 1;
+  memcpy(d + 1, "CD001", 5);
+  d[6] = 1;
+  strpad(d + 8, "SEGA SEGAKATANA", 32);
+  strpad(d + 40, image->volume_id, 32);
+  iso_both32(d + 80, image->options->lba + image->sectors);
+  if (joliet) {
+    memcpy(d + 88, "%/E", 3); // UCS-2 level 3
+  }
+  iso_both16(d + 120, 1);
+  iso_both16(d + 124, 1);
+  iso_both16(d + 128, ISO_SECTOR_SIZE);
+  iso_both32(d + 132, image->path_table_size[hierarchy]);
+  iso_le32(d + 140, image->path_table_extent[hierarchy][0]);
+  iso_be32(d + 148, image->path_table_extent[hierarchy][1]);
+  iso_record(d + 156, image->root, hierarchy, 1);
+  strpad(d + 190, "", 128);
+  strpad(d + 318, "", 128);
+  strpad(d + 446, "", 128);
+  strpad(d + 574, "MAKEIP", 128);
+  strpad(d + 702, "", 37);
+  strpad(d + 739, "", 37);
+  strpad(d + 776, "", 37);
+  iso_date_volume(d + 813, image->now);
+  iso_date_volume(d + 830, image->now);
+  iso_date_volume(d + 847, 0);
+  iso_date_volume(d + 864, image->now);
+  d[881] = 1;
+
+  iso_writer_write(w, d, sizeof(d));
+}
+
+/* File data */
+
+static int
+iso_read_file(char *path, char *data, size_t size)
+{
+  int fd = open(path, O_RDONLY);
+  size_t done = 0;
+
+  if (fd == -1) {
+    return 0;
+  }
+
+  while (done < size) {
+    ssize_t result = read(fd, data + done, size - done);
+    if (result <= 0) {
+      if (result < 0 && errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    done += result;
+  }
+
+  close(fd);
+
+  return done == size;
+}
+
+static void *
+iso_reader_thread(void *arg)
+{
+  iso_reader_t *reader = (iso_reader_t *) arg;
+
+  pthread_mutex_lock(&reader->lock);
+
+  while (reader->next < reader->count) {
+    int index = reader->next;
+    iso_node_t *file = (iso_node_t *) vector_get(reader->files, index);
+
+    if (file->size > ISO_STREAM_THRESHOLD || file->padding) {
+      // large files are read by the writer in big chunks
+      reader->state[index] = ISO_SLOT_STREAM;
+      reader->next++;
+      pthread_cond_broadcast(&reader->cond);
+      continue;
+    }
+
+    // keep the read-ahead bounded
+    if (reader->inflight > 0 && reader->inflight + file->size > ISO_READ_AHEAD) {
+      pthread_cond_wait(&reader->cond, &reader->lock);
+      continue;
+    }
+
+    reader->next++;
+    reader->inflight += file->size;
+    pthread_mutex_unlock(&reader->lock);
+
+    char *data = (char *) malloc(file->size ? file->size : 1);
+    int result = iso_read_file(file->path, data, file->size);
+
+    pthread_mutex_lock(&reader->lock);
+    reader->data[index] = data;
+    reader->state[index] = result ? ISO_SLOT_READY : ISO_SLOT_ERROR;
+    pthread_cond_broadcast(&reader->cond);
+  }
+
+  pthread_mutex_unlock(&reader->lock);
+
+  return NULL;
+}
+
+static int
+iso_stream_file(iso_writer_t *w, iso_node_t *file)
+{
+  char *chunk;
+  int fd;
+  uint64_t remaining = file->size;
+
+  if (file->padding) {
+    chunk = (char *) calloc(1, ISO_STREAM_CHUNK);
+    while (remaining > 0) {
+      size_t length = (remaining < ISO_STREAM_CHUNK) ? remaining : ISO_STREAM_CHUNK;
+      iso_writer_write(w, chunk, length);
+      remaining -= length;
+    }
+    free(chunk);
+    return 1;
+  }
+
+  chunk = (char *) malloc(ISO_STREAM_CHUNK);
+  fd = open(file->path, O_RDONLY);
+
+  if (fd == -1) {
+    free(chunk);
+    return 0;
+  }
+
+  while (remaining > 0) {
+    size_t length = (remaining < ISO_STREAM_CHUNK) ? remaining : ISO_STREAM_CHUNK;
+    ssize_t result = read(fd, chunk, length);
+    if (result <= 0) {
+      if (result < 0 && errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    iso_writer_write(w, chunk, result);
+    remaining -= result;
+  }
+
+  close(fd);
+  free(chunk);
+
+  return remaining == 0;
+}
+
+static int
+iso_write_files(iso_writer_t *w, iso_image_t *image)
+{
+  iso_reader_t reader;
+  int count = vector_total(&image->files);
+  int threads = pool_threads_get();
+  pthread_t *workers = (pthread_t *) malloc(threads * sizeof(pthread_t));
+  int started = 0, result = 1;
+
+  memset(&reader, 0, sizeof(reader));
+  reader.files = &image->files;
+  reader.count = count;
+  reader.data = (char **) calloc(count + 1, sizeof(char *));
+  reader.state = (iso_slot_state_t *) calloc(count + 1, sizeof(iso_slot_state_t));
+  pthread_mutex_init(&reader.lock, NULL);
+  pthread_cond_init(&reader.cond, NULL);
+
+  // files are read in parallel, but written in order as one sequential stream
+  for (int i = 0; i < threads; i++) {
+    if (!pthread_create(&workers[i], NULL, iso_reader_thread, &reader)) {
+      started++;
+    }
+  }
+
+  if (!started) {
+    halt("unable to create reader threads\n");
+  }
+
+  for (int i = 0; i < count; i++) {
+    iso_node_t *file = (iso_node_t *) vector_get(&image->files, i);
+
+    pthread_mutex_lock(&reader.lock);
+    while (reader.state[i] == ISO_SLOT_PENDING) {
+      pthread_cond_wait(&reader.cond, &reader.lock);
+    }
+    iso_slot_state_t state = reader.state[i];
+    pthread_mutex_unlock(&reader.lock);
+
+    if (state == ISO_SLOT_READY && result) {
+      iso_writer_write(w, reader.data[i], file->size);
+    } else if (state == ISO_SLOT_STREAM && result) {
+      if (!iso_stream_file(w, file)) {
+        state = ISO_SLOT_ERROR;
+      }
+    }
+
+    if (state == ISO_SLOT_ERROR) {
+      log_error("unable to read \"%s\"\n", file->path);
+      result = 0;
+    }
+
+    iso_writer_pad(w);
+
+    pthread_mutex_lock(&reader.lock);
+    if (reader.data[i] != NULL) {
+      free(reader.data[i]);
+      reader.data[i] = NULL;
+      reader.inflight -= file->size;
+    }
+    pthread_cond_broadcast(&reader.cond);
+    pthread_mutex_unlock(&reader.lock);
+  }
+
+  for (int i = 0; i < started; i++) {
+    pthread_join(workers[i], NULL);
+  }
+
+  pthread_mutex_destroy(&reader.lock);
+  pthread_cond_destroy(&reader.cond);
+  free(reader.data);
+  free(reader.state);
+  free(workers);
+
+  return result && !w->error;
+}
+
+/* Layout */
+
+static iso_node_t *
+iso_boot_node(iso_image_t *image)
+{
+  char *boot = image->options->boot_filename;
+
+  for (int i = 0; boot != NULL && i < vector_total(&image->root->children); i++) {
+    iso_node_t *node = (iso_node_t *) vector_get(&image->root->children, i);
+    if (!node->is_dir && !strncasecmp(node->iso_name, boot, strlen(boot)) &&
+        node->iso_name[strlen(boot)] == ';') {
+      return node;
+    }
+  }
+
+  return NULL;
+}
+
+static int
+iso_add_padding(iso_image_t *image)
+{
+  struct stat stats;
+
+  memset(&stats, 0, sizeof(stats));
+  stats.st_mode = S_IFREG;
+  stats.st_mtime = image->now;
+
+  iso_node_t *node = iso_node_create(image->root, ISO_PADDING_NAME, "", &stats);
+  node->padding = 1;
+
+  for (int i = 0; i < vector_total(&image->root->children); i++) {
+    iso_node_t *child = (iso_node_t *) vector_get(&image->root->children, i);
+    if (!strcmp(child->iso_name, node->iso_name)) {
+      log_error("\"%s\" conflicts with the padding file\n", child->path);
+      iso_node_free(node);
+      return 0;
+    }
+  }
+
+  vector_add(&image->root->children, node);
+  qsort(image->root->children.items, vector_total(&image->root->children),
+    sizeof(void *), iso_compare_primary);
+
+  return 1;
+}
+
+static int
+iso_compare_path(const void *a, const void *b)
+{
+  return strcmp((*(const iso_node_t **) a)->path, (*(const iso_node_t **) b)->path);
+}
+
+static int
+iso_trace_load(iso_image_t *image)
+{
+  int count = vector_total(&image->files);
+  iso_node_t **sorted = (iso_node_t **) malloc((count + 1) * sizeof(iso_node_t *));
+  size_t root_length = strlen(image->options->root);
+  char *line = NULL, *path = NULL;
+  size_t capacity = 0;
+  int unknown = 0;
+
+  FILE *fh = fopen(image->options->layout, "r");
+  if (fh == NULL) {
+    log_error("can't open layout file \"%s\"\n", image->options->layout);
+    free(sorted);
+    return 0;
+  }
+
+  // files are searched by their path on the host
+  memcpy(sorted, image->files.items, count * sizeof(iso_node_t *));
+  qsort(sorted, count, sizeof(iso_node_t *), iso_compare_path);
+
+  while (getline(&line, &capacity, fh) != -1) {
+    char *entry = line;
+    size_t length = strlen(entry);
+
+    while (length > 0 && isspace((unsigned char) entry[length - 1])) {
+      entry[--length] = '\0';
+    }
+    while (isspace((unsigned char) *entry)) {
+      entry++;
+    }
+    if (*entry == '\0' || *entry == '#') {
+      continue;
+    }
+    while (!strncmp(entry, "./", 2)) {
+      entry += 2;
+    }
+    while (*entry == '/') {
+      entry++;
+    }
+
+    path = (char *) realloc(path, root_length + strlen(entry) + 2);
+    sprintf(path, "%s/%s", image->options->root, entry);
+
+    iso_node_t key, *key_pointer = &key;
+    key.path = path;
+    iso_node_t **found = (iso_node_t **) bsearch(&key_pointer, sorted, count,
+      sizeof(iso_node_t *), iso_compare_path);
+
+    if (found != NULL) {
+      vector_add(&image->accesses, *found);
+    } else if (unknown++ < 10) {
+      log_warn("file \"%s\" of the layout isn't in the image\n", entry);
+    }
+  }
+
+  fclose(fh);
+  free(line);
+  free(path);
+  free(sorted);
+
+  return 1;
+}
+
+static void
+iso_order(iso_image_t *image)
+{
+  vector order;
+  uint32_t start = 0;
+
+  vector_init(&order);
+
+  // remember where the data would have been, to compare the layouts
+  for (int i = 0; i < vector_total(&image->files); i++) {
+    iso_node_t *file = (iso_node_t *) vector_get(&image->files, i);
+    file->default_start = start;
+    start += iso_sectors(file->size);
+  }
+
+  // padding first, then the boot file, the files in access order, and the
+  // remaining ones in the default order
+  for (int i = 0; i < vector_total(&image->files); i++) {
+    iso_node_t *file = (iso_node_t *) vector_get(&image->files, i);
+    if (file->padding) {
+      file->placed = 1;
+      vector_add(&order, file);
+    }
+  }
+
+  iso_node_t *boot = iso_boot_node(image);
+  if (boot != NULL) {
+    boot->placed = 1;
+    vector_add(&order, boot);
+  }
+
+  for (int pass = 0; pass < 2; pass++) {
+    vector *files = pass ? &image->files : &image->accesses;
+    for (int i = 0; i < vector_total(files); i++) {
+      iso_node_t *file = (iso_node_t *) vector_get(files, i);
+      if (!file->placed) {
+        file->placed = 1;
+        vector_add(&order, file);
+      }
+    }
+  }
+
+  vector_free(&image->files);
+  image->files = order;
+}
+
+static int
+iso_count_seeks(iso_image_t *image, int optimized)
+{
+  int seeks = 0;
+  uint64_t position = UINT64_MAX;
+
+  // a seek happens each time the next file doesn't follow the previous one
+  for (int i = 0; i < vector_total(&image->accesses); i++) {
+    iso_node_t *file = (iso_node_t *) vector_get(&image->accesses, i);
+    uint64_t start = optimized ? file->extent : file->default_start;
+    if (start != position) {
+      seeks++;
+    }
+    position = start + iso_sectors(file->size);
+  }
+
+  return seeks;
+}
+
+/* Public interface */
+
+int
+iso_pad_parse(char *str, uint32_t *lba)
+{
+  long result;
+
+  if (!strcmp(str, "outer")) {
+    *lba = ISO_PAD_OUTER;
+    return 1;
+  }
+
+  if (!long_parse(str, &result) || result <= 0 || result >= ISO_PAD_OUTER) {
+    return 0;
+  }
+
+  *lba = result;
+
+  return 1;
+}
+
+int
+iso_msinfo_parse(char *str, uint32_t *lba)
+{
+  // accepts "<lba>" as well as the "<last>,<next>" cdrecord -msinfo output
+  char *value = strrchr(str, ',');
+  long result;
+
+  if (!long_parse(value ? value + 1 : str, &result) || result < 0) {
+    return 0;
+  }
+
+  *lba = result;
+
+  return 1;
+}
+
+static int
+iso_check_boot_file(iso_image_t *image)
+{
+  char *boot = image->options->boot_filename;
+
+  if (boot == NULL) {
+    return 1;
+  }
+
+  iso_node_t *node = iso_boot_node(image);
+  if (node != NULL) {
+    if (!node->size) {
+      log_error("boot file \"%s\" is empty\n", node->path);
+      return 0;
+    }
+    return 1;
+  }
+
+  log_error("boot file \"%s\" not found in \"%s\"\n", boot, image->options->root);
+
+  return 0;
+}
+
+int
+iso_build(iso_options_t *options, const char *ip, char *fn_out)
+{
+  iso_image_t image;
+  iso_writer_t writer;
+  output_file_t output;
+  cdi_image_t cdi;
+  struct stat stats;
+  int result;
+
+  memset(&image, 0, sizeof(image));
+  image.options = options;
+  image.hierarchies = options->joliet ? 2 : 1;
+  image.now = time(NULL);
+
+  // the volume identifier is made of d-characters only
+  char *volume_id = options->volume_id ? options->volume_id : "CDROM";
+  for (int i = 0; i < 32 && volume_id[i]; i++) {
+    char c = toupper((unsigned char) volume_id[i]);
+    image.volume_id[i] = (isalnum((unsigned char) c) || c == '_') ? c : '_';
+  }
+
+  // without a directory, an empty volume is built
+  if (options->root == NULL) {
+    memset(&stats, 0, sizeof(stats));
+    stats.st_mode = S_IFDIR;
+    stats.st_mtime = image.now;
+  } else if (stat(options->root, &stats) == -1 || !S_ISDIR(stats.st_mode)) {
+    log_error("\"%s\" is not a directory\n", options->root);
+    return 0;
+  }
+
+  image.root = iso_node_create(NULL, "", options->root ? options->root : "", &stats);
+  vector_init(&image.files);
+
+  result = (options->root == NULL || iso_scan(image.root)) &&
+    iso_check_boot_file(&image);
+
+  if (result && options->pad_to) {
+    result = iso_add_padding(&image);
+  }
+
+  vector_init(&image.accesses);
+
+  if (result) {
+    iso_collect(&image);
+
+    if (options->layout != NULL) {
+      result = (options->root != NULL) && iso_trace_load(&image);
+    }
+  }
+
+  if (result) {
+    if (options->layout != NULL || options->pad_to) {
+      iso_order(&image);
+    }
+    iso_layout(&image);
+
+    if (options->layout != NULL) {
+      printf("%s: %d file access(es) in \"%s\", expected seeks: %d (%d with the default layout)\n",
+        fn_out, vector_total(&image.accesses), options->layout,
+        iso_count_seeks(&image, 1), iso_count_seeks(&image, 0));
+    }
+
+    log_notice("building %s image \"%s\" (%d files, %u sectors at LBA %u)\n",
+      options->cdi ? "CDI" : "ISO", fn_out, vector_total(&image.files), image.sectors, options->lba);
+
+    memset(&writer, 0, sizeof(writer));
+    writer.filename = fn_out;
+    result = output_open(&output, fn_out, 0);
+    writer.fd = output.fd;
+  }
+
+  if (result) {
+    writer.buffer = (char *) malloc(ISO_WRITE_BUFFER);
+    writer.format = options->sector_format;
+    writer.lba = options->lba;
+
+    // the image becomes the data track of the second session
+    if (options->cdi) {
+      writer.format = SECTOR_FORMAT_MODE2_2336;
+      cdi_prepare(&cdi, fn_out, options->lba, (image.sectors > options->min_sectors) ?
+        image.sectors : options->min_sectors);
+      if (!cdi_write_lead(&cdi, writer.fd)) {
+        writer.error = 1;
+      }
+    }
+    if (writer.format != SECTOR_FORMAT_ISO) {
+      writer.raw = (char *) malloc(ISO_WRITE_BUFFER / ISO_SECTOR_SIZE *
+        sector_size(writer.format));
+    }
+
+    // the bootstrap is the system area of the image
+    iso_writer_write(&writer, ip, INITIAL_PROGRAM_SIZE);
+
+    for (int h = 0; h < image.hierarchies; h++) {
+      iso_write_volume_descriptor(&writer, &image, h);
+    }
+
+    unsigned char terminator[ISO_SECTOR_SIZE];
+    memset(terminator, 0, sizeof(terminator));
+    terminator[0] = 0xff;
+    memcpy(terminator + 1, "CD001", 5);
+    terminator[6] = 1;
+    iso_writer_write(&writer, terminator, sizeof(terminator));
+
+    for (int h = 0; h < image.hierarchies; h++) {
+      iso_write_path_table(&writer, &image, h, 0);
+      iso_write_path_table(&writer, &image, h, 1);
+    }
+
+    for (int h = 0; h < image.hierarchies; h++) {
+      for (int i = 0; i < vector_total(&image.dirs[h]); i++) {
+        iso_write_directory(&writer, (iso_node_t *) vector_get(&image.dirs[h], i), h);
+      }
+    }
+
+    result = iso_write_files(&writer, &image);
+
+    // padding of the track, outside of the volume
+    if (result) {
+      static const char zero[ISO_SECTOR_SIZE];
+      for (uint32_t i = image.sectors; i < options->min_sectors; i++) {
+        iso_writer_write(&writer, zero, ISO_SECTOR_SIZE);
+      }
+    }
+
+    iso_writer_flush(&writer);
+    free(writer.buffer);
+    free(writer.raw);
+
+    if (options->cdi) {
+      if (!writer.error && !cdi_write_header(&cdi, writer.fd)) {
+        writer.error = 1;
+      }
+      cdi_release(&cdi);
+    }
+
+    if (!result || writer.error) {
+      output_abort(&output);
+      result = 0;
+    } else {
+      result = output_commit(&output);
+    }
+
+    if (result) {
+      log_notice("%s image successfully written to \"%s\"\n",
+        options->cdi ? "CDI" : "ISO", fn_out);
+    }
+  }
+
+  for (int h = 0; h < image.hierarchies; h++) {
+    if (image.dirs[h].items != NULL) {
+      vector_free(&image.dirs[h]);
+    }
+  }
+  vector_free(&image.files);
+  vector_free(&image.accesses);
+  iso_node_free(image.root);
+
+  return result;
+}
+
+/* Bootstrap injection into an existing image */
+
+static uint32_t
+iso_get_le32(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static int
+iso_is_volume_descriptor(const unsigned char *p, int type)
+{
+  return p[0] == type && !memcmp(p + 1, "CD001", 5) && p[6] == 1;
+}
+
+static const unsigned char *
+iso_root_locate(mapped_file_t *map, uint32_t *base)
+{
+  const unsigned char *pvd = (const unsigned char *) map->data +
+    ISO_SYSTEM_AREA_SECTORS * ISO_SECTOR_SIZE;
+  uint32_t root = iso_get_le32(pvd + 156 + 2);
+  uint32_t volume_sectors = iso_get_le32(pvd + 80);
+  uint32_t file_sectors = map->size / ISO_SECTOR_SIZE;
+
+  // extents are absolute: a data track of a multisession disc is stored
+  // without the sectors preceding it, so try the usual start LBAs
+  uint32_t candidates[] = {
+    0,
+    (volume_sectors > file_sectors) ? volume_sectors - file_sectors : 0,
+    ISO_DEFAULT_MSINFO
+  };
+
+  for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++) {
+    if (root < candidates[i] || root - candidates[i] >= file_sectors) {
+      continue;
+    }
+
+    // the "." record of the root directory points to itself
+    const unsigned char *record = (const unsigned char *) map->data +
+      (size_t) (root - candidates[i]) * ISO_SECTOR_SIZE;
+    if (record[0] >= 34 && iso_get_le32(record + 2) == root &&
+        (record[25] & 0x02) && record[32] == 1 && record[33] == 0) {
+      *base = candidates[i];
+      return record;
+    }
+  }
+
+  return NULL;
+}
+
+static int
+iso_find_boot_file(mapped_file_t *map, const unsigned char *root,
+  uint32_t base, char *boot)
+{
+  uint32_t size = iso_get_le32(root + 10);
+  size_t offset = root - (const unsigned char *) map->data;
+  size_t boot_length = strlen(boot);
+
+  if (offset + size > map->size) {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < size; ) {
+    const unsigned char *record = root + i;
+
+    // records never cross sector boundaries
+    if (record[0] == 0) {
+      i = (i / ISO_SECTOR_SIZE + 1) * ISO_SECTOR_SIZE;
+      continue;
+    }
+
+    // the record and its name must fit in the sector of the directory
+    if (record[0] < 34 || (i % ISO_SECTOR_SIZE) + record[0] > ISO_SECTOR_SIZE ||
+        i + record[0] > size || 33 + record[32] > record[0]) {
+      return 0;
+    }
+
+    int name_length = record[32];
+
+    if (!(record[25] & 0x02) && name_length > (int) boot_length &&
+        !strncasecmp((const char *) record + 33, boot, boot_length) &&
+        record[33 + boot_length] == ';') {
+      uint32_t extent = iso_get_le32(record + 2);
+      return extent >= base && iso_get_le32(record + 10) > 0;
+    }
+
+    i += record[0];
+  }
+
+  return 0;
+}
+
+int
+iso_inject(const char *ip, char *fn_iso, char *boot_filename)
+{
+  mapped_file_t map;
+  size_t page_size = page_size_get();
+  int result = 1, dirty_pages = 0;
+
+  // pages larger than the system area are handled as a single block
+  if (page_size > INITIAL_PROGRAM_SIZE) {
+    page_size = INITIAL_PROGRAM_SIZE;
+  }
+
+  if (!file_map(fn_iso, FILE_MAP_WRITE, &map)) {
+    return 0;
+  }
+
+  // the system area is followed at least by the primary volume descriptor
+  // and the volume descriptor set terminator
+  if (map.size < (ISO_SYSTEM_AREA_SECTORS + 2) * ISO_SECTOR_SIZE ||
+      map.size % ISO_SECTOR_SIZE ||
+      !iso_is_volume_descriptor((const unsigned char *) map.data +
+        INITIAL_PROGRAM_SIZE, 1)) {
+    log_error("\"%s\" is not a valid ISO9660 image\n", fn_iso);
+    file_unmap(&map);
+    return 0;
+  }
+
+  if (boot_filename != NULL) {
+    uint32_t base = 0;
+    const unsigned char *root = iso_root_locate(&map, &base);
+
+    if (root == NULL) {
+      log_error("root directory of \"%s\" not found\n", fn_iso);
+      result = 0;
+    } else if (!iso_find_boot_file(&map, root, base, boot_filename)) {
+      log_error("boot file \"%s\" not found in \"%s\"\n", boot_filename, fn_iso);
+      result = 0;
+    } else {
+      log_notice("found boot file \"%s\" in \"%s\" (start LBA %u)\n",
+        boot_filename, fn_iso, base);
+    }
+  }
+
+  // only the pages of the system area which really change are written
+  for (size_t offset = 0; result && offset < INITIAL_PROGRAM_SIZE; offset += page_size) {
+    if (memcmp(map.data + offset, ip + offset, page_size)) {
+      memcpy(map.data + offset, ip + offset, page_size);
+      dirty_pages++;
+    }
+  }
+
+  file_unmap(&map);
+
+  // the pages are in the page cache, flushed as required by --sync
+  if (result && dirty_pages) {
+    int fd = open(fn_iso, O_RDONLY);
+    if (fd == -1 || !output_sync_fd(fd)) {
+      log_error("can't sync \"%s\": %s\n", fn_iso, strerror(errno));
+      result = 0;
+    }
+    if (fd != -1) {
+      close(fd);
+    }
+  }
+
+  if (result) {
+    log_notice("bootstrap injected into \"%s\" (%d page(s) updated)\n",
+      fn_iso, dirty_pages);
+  }
+
+  return result;
+}
@@ -0,0 +1,77 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ISO_H__
+#define __ISO_H__
+
+#include <stdint.h>
+
+#include "global.h"
+
+#include "utils.h"
+#include "sector.h"
+
+#define ISO_SECTOR_SIZE 2048
+
+// LBA of the data session on a standard CD-R selfboot disc (audio session
+// of 302 sectors followed by the lead-out/lead-in gap)
+#define ISO_DEFAULT_MSINFO 11702
+
+// pad the image so that its data ends at the end of the disc
+#define ISO_PAD_OUTER 0xffffffff
+
+// end of a 80 minutes CD-R (first sector after the last one)
+#define ISO_CD_CAPACITY 359850
+
+typedef struct iso_options_t {
+  char *root;           // directory holding the files of the image
+  char *volume_id;      // volume identifier (d-characters)
+  uint32_t lba;         // LBA of the start of the image (multisession)
+  int joliet;           // add Joliet extensions
+  char *boot_filename;  // file which must exist in the root directory
+  sector_format_t sector_format;  // format of the sectors written
+  int cdi;              // wrap the image into a DiscJuggler (CDI) image
+  char *layout;         // access-order trace of the files (if any)
+  uint32_t pad_to;      // LBA of the data after a padding file (if any)
+  uint32_t capacity;    // end of the disc (see ISO_PAD_OUTER)
+  uint32_t min_sectors;  // empty sectors are added up to this length
+} iso_options_t;
+
+int iso_msinfo_parse(char *str, uint32_t *lba);
+int iso_pad_parse(char *str, uint32_t *lba);
+
+int iso_build(iso_options_t *options, const char *ip, char *fn_out);
+
+int iso_inject(const char *ip, char *fn_iso, char *boot_filename);
+
+#endif /* __ISO_H__ */
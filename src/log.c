@@ -0,0 +1,482 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#include "utils.h"
+
+// header of the records in the rings: length (2 bytes), file descriptor
+#define LOG_HEADER_SIZE 3
+
+// vectors of a writev() call (LOG_IOV_MAX of Linux)
+#define LOG_IOV_MAX 1024
+
+// records of a thread; only the thread writes (head), only the flusher
+// reads (tail), so the messages are queued without locks
+typedef struct log_ring_t {
+  struct log_ring_t *next;
+  int used;
+  uint64_t head;
+  uint64_t tail;
+  char data[LOG_RING_SIZE];
+} log_ring_t;
+
+static log_level_t g_log_level = LOG_LEVEL_WARNING;
+static log_format_t g_log_format = LOG_FORMAT_TEXT;
+
+// warnings and errors are not printed by the current thread when set
+static __thread int g_log_silent = 0;
+
+// notices and warnings are printed on stderr when stdout carries data
+static int g_log_stderr = 0;
+
+// the flusher is started by the first record, and stopped at exit
+static pthread_mutex_t g_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_log_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_log_done = PTHREAD_COND_INITIALIZER;
+static pthread_t g_log_flusher;
+static int g_log_started = 0;
+static int g_log_stopping = 0;
+static int g_log_signaled = 0;
+static uint64_t g_log_flush_request = 0;
+static uint64_t g_log_flush_done = 0;
+
+// rings of all the threads; the rings of exited threads are reused
+static log_ring_t *g_log_rings = NULL;
+static pthread_key_t g_log_ring_key;
+static pthread_once_t g_log_ring_once = PTHREAD_ONCE_INIT;
+static __thread log_ring_t *g_log_ring = NULL;
+
+static const char *g_log_level_names[] = { "error", "warning", "notice" };
+
+/* Flusher */
+
+// Writes the gathered records of a file descriptor
+static void
+log_writev(int fd, struct iovec *iov, int *count)
+{
+  while (*count > 0) {
+    ssize_t result = writev(fd, iov, *count);
+    if (result < 0 && errno == EINTR) {
+      continue;
+    }
+    if (result < 0) {
+      break;
+    }
+    // short writes (e.g. pipes) are completed
+    while (*count > 0 && (size_t) result >= iov->iov_len) {
+      result -= iov->iov_len;
+      iov++;
+      (*count)--;
+    }
+    if (*count > 0) {
+      iov->iov_base = (char *) iov->iov_base + result;
+      iov->iov_len -= result;
+    }
+  }
+  *count = 0;
+}
+
+static void
+log_ring_read(log_ring_t *ring, uint64_t position, void *data, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    ((char *) data)[i] = ring->data[(position + i) % LOG_RING_SIZE];
+  }
+}
+
+// Writes the records of all the rings, one writev() per batch of records of
+// the same file descriptor
+static void
+log_drain(void)
+{
+  struct iovec iov[2][LOG_IOV_MAX];
+  int count[2] = { 0, 0 };
+
+  for (log_ring_t *ring = __atomic_load_n(&g_log_rings, __ATOMIC_ACQUIRE);
+       ring != NULL; ring = ring->next) {
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint64_t position = ring->tail;
+
+    while (position < head) {
+      unsigned char header[LOG_HEADER_SIZE];
+      log_ring_read(ring, position, header, LOG_HEADER_SIZE);
+
+      size_t length = header[0] | (header[1] << 8);
+      int index = (header[2] == STDERR_FILENO);
+      size_t offset = (position + LOG_HEADER_SIZE) % LOG_RING_SIZE;
+      size_t first = (offset + length > LOG_RING_SIZE) ? LOG_RING_SIZE - offset : length;
+
+      // a record wrapping around the end of the ring takes two vectors
+      if (count[index] + 2 > LOG_IOV_MAX) {
+        log_writev(header[2], iov[index], &count[index]);
+      }
+      iov[index][count[index]].iov_base = ring->data + offset;
+      iov[index][count[index]++].iov_len = first;
+      if (first < length) {
+        iov[index][count[index]].iov_base = ring->data;
+        iov[index][count[index]++].iov_len = length - first;
+      }
+
+      position += LOG_HEADER_SIZE + length;
+    }
+
+    // the space of the ring is given back once the records are written
+    log_writev(STDOUT_FILENO, iov[0], &count[0]);
+    log_writev(STDERR_FILENO, iov[1], &count[1]);
+    __atomic_store_n(&ring->tail, position, __ATOMIC_RELEASE);
+  }
+}
+
+static void *
+log_flusher(void *context)
+{
+  struct timespec delay = { 0, LOG_FLUSH_DELAY_MS * 1000000L };
+
+  pthread_mutex_lock(&g_log_lock);
+  for (;;) {
+    while (!g_log_signaled && g_log_flush_done == g_log_flush_request &&
+           !g_log_stopping) {
+      pthread_cond_wait(&g_log_wake, &g_log_lock);
+    }
+
+    uint64_t request = g_log_flush_request;
+    int waited = (request != g_log_flush_done) || g_log_stopping;
+    pthread_mutex_unlock(&g_log_lock);
+
+    // the records following the first one are written with it
+    if (!waited) {
+      nanosleep(&delay, NULL);
+    }
+    __atomic_store_n(&g_log_signaled, 0, __ATOMIC_RELEASE);
+
+    log_drain();
+
+    pthread_mutex_lock(&g_log_lock);
+    g_log_flush_done = request;
+    pthread_cond_broadcast(&g_log_done);
+    if (g_log_stopping && g_log_flush_done == g_log_flush_request) {
+      break;
+    }
+  }
+  pthread_mutex_unlock(&g_log_lock);
+
+  return NULL;
+}
+
+static void
+log_stop(void)
+{
+  pthread_mutex_lock(&g_log_lock);
+  g_log_stopping = 1;
+  pthread_cond_signal(&g_log_wake);
+  pthread_mutex_unlock(&g_log_lock);
+
+  pthread_join(g_log_flusher, NULL);
+
+  // the records of the exit handlers are written directly
+  g_log_started = 0;
+}
+
+/* Rings */
+
+static void
+log_ring_release(void *ring)
+{
+  pthread_mutex_lock(&g_log_lock);
+  ((log_ring_t *) ring)->used = 0;
+  pthread_mutex_unlock(&g_log_lock);
+}
+
+static void
+log_ring_initialize(void)
+{
+  pthread_key_create(&g_log_ring_key, log_ring_release);
+}
+
+static log_ring_t *
+log_ring_get(void)
+{
+  log_ring_t *ring = g_log_ring;
+
+  if (ring != NULL) {
+    return ring;
+  }
+
+  pthread_once(&g_log_ring_once, log_ring_initialize);
+
+  pthread_mutex_lock(&g_log_lock);
+  for (ring = g_log_rings; ring != NULL && ring->used; ring = ring->next);
+  if (ring == NULL) {
+    ring = (log_ring_t *) calloc(1, sizeof(log_ring_t));
+    if (ring == NULL) {
+      pthread_mutex_unlock(&g_log_lock);
+      return NULL;
+    }
+    ring->next = g_log_rings;
+    __atomic_store_n(&g_log_rings, ring, __ATOMIC_RELEASE);
+  }
+  ring->used = 1;
+
+  if (!g_log_started && !g_log_stopping) {
+    if (!pthread_create(&g_log_flusher, NULL, log_flusher, NULL)) {
+      g_log_started = 1;
+      atexit(log_stop);
+    }
+  }
+  pthread_mutex_unlock(&g_log_lock);
+
+  pthread_setspecific(g_log_ring_key, ring);
+  g_log_ring = ring;
+
+  return ring;
+}
+
+static void
+log_ring_write(log_ring_t *ring, uint64_t position, const void *data, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    ring->data[(position + i) % LOG_RING_SIZE] = ((const char *) data)[i];
+  }
+}
+
+// Queues a record, written by the flusher; returns 0 if it's to be written
+// directly (no flusher)
+static int
+log_queue(int fd, const char *record, size_t length)
+{
+  log_ring_t *ring = log_ring_get();
+
+  if (ring == NULL || !g_log_started) {
+    return 0;
+  }
+
+  // the thread waits for the flusher when its ring is full
+  while (LOG_RING_SIZE - (ring->head - __atomic_load_n(&ring->tail,
+         __ATOMIC_ACQUIRE)) < LOG_HEADER_SIZE + length) {
+    log_flush();
+  }
+
+  unsigned char header[LOG_HEADER_SIZE] = { length & 0xff, length >> 8, fd };
+  log_ring_write(ring, ring->head, header, LOG_HEADER_SIZE);
+  log_ring_write(ring, ring->head + LOG_HEADER_SIZE, record, length);
+
+  // the record is complete when the flusher sees it
+  __atomic_store_n(&ring->head, ring->head + LOG_HEADER_SIZE + length,
+    __ATOMIC_RELEASE);
+
+  // the flusher is woken by the first record since its last pass
+  if (!__atomic_exchange_n(&g_log_signaled, 1, __ATOMIC_ACQ_REL)) {
+    pthread_mutex_lock(&g_log_lock);
+    pthread_cond_signal(&g_log_wake);
+    pthread_mutex_unlock(&g_log_lock);
+  }
+
+  return 1;
+}
+
+/* Records */
+
+static void
+log_record(log_level_t level, const char *prefix, const char *format, va_list args)
+{
+  char message[LOG_RECORD_MAX];
+  char record[LOG_RECORD_MAX * 2];
+  int fd = (level == LOG_LEVEL_ERROR || g_log_stderr) ? STDERR_FILENO : STDOUT_FILENO;
+  size_t length;
+
+  vsnprintf(message, sizeof(message), format, args);
+
+  if (g_log_format == LOG_FORMAT_JSON) {
+    struct timespec now;
+    buffer_t buf;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    rtrim(message);
+
+    buffer_init(&buf);
+    buffer_printf(&buf, "{\"time\":%lld.%03ld,\"program\":\"%s\",\"level\":\"%s\","
+      "\"thread\":%ld,\"message\":", (long long) now.tv_sec, now.tv_nsec / 1000000,
+      program_name_get(), g_log_level_names[level], (long) syscall(SYS_gettid));
+    buffer_append_json_string(&buf, message);
+    buffer_append(&buf, "}\n", 2);
+
+    length = (buf.size < sizeof(record)) ? buf.size : sizeof(record) - 1;
+    memcpy(record, buf.data, length);
+    buffer_free(&buf);
+  } else {
+    length = snprintf(record, sizeof(record), "%s: %s%s", program_name_get(),
+      prefix, message);
+    if (length >= sizeof(record)) {
+      length = sizeof(record) - 1;
+    }
+  }
+
+  // errors are written at once, after the queued records
+  if (level == LOG_LEVEL_ERROR) {
+    log_flush();
+  } else if (log_queue(fd, record, length)) {
+    return;
+  }
+
+  file_write_full(fd, record, length);
+}
+
+void
+verbose_enable()
+{
+  g_log_level = LOG_LEVEL_NOTICE;
+}
+
+void
+log_silent_set(int silent)
+{
+  g_log_silent = silent;
+}
+
+// Leaves stdout to the data written to the standard output (see is_stdio)
+void
+log_stdout_release(void)
+{
+  g_log_stderr = 1;
+}
+
+int
+log_level_parse(const char *str, log_level_t *level)
+{
+  for (int i = 0; i < sizeof(g_log_level_names) / sizeof(char *); i++) {
+    if (!strcmp(str, g_log_level_names[i])) {
+      *level = (log_level_t) i;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+void
+log_level_set(log_level_t level)
+{
+  g_log_level = level;
+}
+
+int
+log_format_parse(const char *str, log_format_t *format)
+{
+  if (!strcmp(str, "text")) {
+    *format = LOG_FORMAT_TEXT;
+  } else if (!strcmp(str, "json")) {
+    *format = LOG_FORMAT_JSON;
+  } else {
+    return 0;
+  }
+
+  return 1;
+}
+
+void
+log_format_set(log_format_t format)
+{
+  g_log_format = format;
+}
+
+void
+log_notice(const char *format, ...)
+{
+  va_list args;
+
+  if (g_log_level < LOG_LEVEL_NOTICE) {
+    return;
+  }
+
+  va_start(args, format);
+  log_record(LOG_LEVEL_NOTICE, "", format, args);
+  va_end(args);
+}
+
+void
+log_warn(const char *format, ...)
+{
+  va_list args;
+
+  if (g_log_silent || g_log_level < LOG_LEVEL_WARNING) {
+    return;
+  }
+
+  va_start(args, format);
+  log_record(LOG_LEVEL_WARNING, "warning: ", format, args);
+  va_end(args);
+}
+
+void
+log_error(const char *format, ...)
+{
+  va_list args;
+
+  if (g_log_silent) {
+    return;
+  }
+
+  va_start(args, format);
+  log_record(LOG_LEVEL_ERROR, "error: ", format, args);
+  va_end(args);
+}
+
+void
+halt(const char *format, ...)
+{
+  va_list args;
+
+  va_start(args, format);
+  log_record(LOG_LEVEL_ERROR, "fatal: ", format, args);
+  va_end(args);
+
+  exit(EXIT_FAILURE);
+}
+
+// Waits until the queued records are written
+void
+log_flush(void)
+{
+  pthread_mutex_lock(&g_log_lock);
+  if (g_log_started) {
+    uint64_t request = ++g_log_flush_request;
+    pthread_cond_signal(&g_log_wake);
+    while (g_log_flush_done < request) {
+      pthread_cond_wait(&g_log_done, &g_log_lock);
+    }
+  }
+  pthread_mutex_unlock(&g_log_lock);
+}
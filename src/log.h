@@ -0,0 +1,76 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LOG_H__
+#define __LOG_H__
+
+#include <stdint.h>
+
+// size of the buffer of each thread logging records (see log.c)
+#define LOG_RING_SIZE 65536
+
+// longest record, longer messages are truncated
+#define LOG_RECORD_MAX 4096
+
+// records are gathered during this delay before being written
+#define LOG_FLUSH_DELAY_MS 2
+
+typedef enum log_level_t {
+  LOG_LEVEL_ERROR = 0,
+  LOG_LEVEL_WARNING,
+  LOG_LEVEL_NOTICE
+} log_level_t;
+
+typedef enum log_format_t {
+  LOG_FORMAT_TEXT = 0,
+  LOG_FORMAT_JSON
+} log_format_t;
+
+void verbose_enable();
+void log_silent_set(int silent);
+void log_stdout_release(void);
+
+int log_level_parse(const char *str, log_level_t *level);
+void log_level_set(log_level_t level);
+int log_format_parse(const char *str, log_format_t *format);
+void log_format_set(log_format_t format);
+
+void log_notice(const char *format, ...);
+void log_warn(const char *format, ...);
+void log_error(const char *format, ...);
+
+void halt(const char *format, ...);
+
+void log_flush(void);
+
+#endif /* __LOG_H__ */
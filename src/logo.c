@@ -0,0 +1,211 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "logo.h"
+
+#include "ip.h"
+#include "mr.h"
+#include "output.h"
+#include "pool.h"
+#include "scan.h"
+
+typedef struct logo_context_t {
+  vector *files;
+  const char *directory;
+  int png;
+  FILE *out;
+  pthread_mutex_t lock;
+  int failed;
+  int found;
+  int written;
+} logo_context_t;
+
+typedef struct logo_file_t {
+  logo_context_t *ctx;
+  char *filename;
+  buffer_t out;
+  int found;
+  int written;
+  int failed;
+} logo_file_t;
+
+// Stores a logo in the library, named after its contents: a logo already
+// there (from another image or a previous run) isn't written again, and
+// returns 1 if the logo is new
+static int
+logo_store(logo_file_t *file, const unsigned char *data, mr_info_t *info,
+  const char *name)
+{
+  char path[4096];
+  int stored = 0;
+
+  // written whole then linked, so the library never holds a partial file;
+  // another thread or process may have stored it in the meantime
+  snprintf(path, sizeof(path), "%s/%s.mr", file->ctx->directory, name);
+  if (!is_file_exist(path)) {
+    if (output_write(path, data, info->size, OUTPUT_KEEP)) {
+      stored = 1;
+    } else if (errno != EEXIST) {
+      log_error("%s: unable to write \"%s\"\n", file->filename, path);
+      return -1;
+    }
+  }
+
+  // checked on its own, for a library first made without '--png'
+  if (file->ctx->png) {
+    snprintf(path, sizeof(path), "%s/%s.png", file->ctx->directory, name);
+    errno = 0;
+    if (!is_file_exist(path) && !mr_png_write(data, info, path, OUTPUT_KEEP) &&
+        errno != EEXIST) {
+      log_error("%s: unable to write \"%s\"\n", file->filename, path);
+      return -1;
+    }
+  }
+
+  if (stored) {
+    log_notice("%s: new logo %s (%ux%u, %u colors)\n", file->filename, name,
+      info->width, info->height, info->colors);
+  }
+
+  return stored;
+}
+
+static void
+logo_hit(const char *ip, uint64_t offset, scan_sector_t sector, void *context)
+{
+  logo_file_t *file = (logo_file_t *) context;
+  const unsigned char *data = (const unsigned char *) ip + MR_OFFSET;
+  const char *error;
+  char name[17];
+  mr_info_t info;
+  int stored;
+
+  // the logo is bounded by the size field of its header
+  if (!mr_parse(data, INITIAL_PROGRAM_SIZE - MR_OFFSET, &info, &error)) {
+    log_notice("%s: no logo in the bootstrap at %llu (%s)\n", file->filename,
+      (unsigned long long) offset, error);
+    return;
+  }
+
+  snprintf(name, sizeof(name), "%016llx",
+    (unsigned long long) hash_fnv1a(HASH_FNV1A_INIT, data, info.size));
+
+  stored = logo_store(file, data, &info, name);
+  if (stored < 0) {
+    file->failed = 1;
+    return;
+  }
+
+  file->found++;
+  file->written += stored;
+  buffer_printf(&file->out, "%s.mr\t%s\t%llu\n", name, file->filename,
+    (unsigned long long) offset);
+}
+
+static void
+logo_job(int index, void *context)
+{
+  logo_context_t *ctx = (logo_context_t *) context;
+  logo_file_t file;
+  mapped_file_t map;
+
+  file.ctx = ctx;
+  file.filename = VECTOR_GET(*ctx->files, char*, index);
+  file.found = 0;
+  file.written = 0;
+  file.failed = 0;
+  buffer_init(&file.out);
+
+  // IP.BIN files and disc images are handled the same way, the bootstrap
+  // being found at the start of the former
+  if (!file_map(file.filename, FILE_MAP_READ, &map)) {
+    file.failed = 1;
+  } else {
+    if (!scan_map(&map, logo_hit, &file)) {
+      log_error("%s: no bootstrap found\n", file.filename);
+      file.failed = 1;
+    }
+    file_unmap(&map);
+  }
+
+  pthread_mutex_lock(&ctx->lock);
+  if (file.out.size) {
+    fwrite(file.out.data, 1, file.out.size, ctx->out);
+  }
+  ctx->failed += file.failed;
+  ctx->found += file.found;
+  ctx->written += file.written;
+  pthread_mutex_unlock(&ctx->lock);
+
+  buffer_free(&file.out);
+}
+
+/* Public interface */
+
+int
+logo_extract_files(vector *files, const char *directory, int png, FILE *out)
+{
+  logo_context_t ctx;
+  struct stat st;
+
+  if (mkdir(directory, 0755) && errno != EEXIST) {
+    log_error("can't create directory \"%s\": %s\n", directory, strerror(errno));
+    return 1;
+  }
+  if (stat(directory, &st) || !S_ISDIR(st.st_mode)) {
+    log_error("\"%s\" is not a directory\n", directory);
+    return 1;
+  }
+
+  ctx.files = files;
+  ctx.directory = directory;
+  ctx.png = png;
+  ctx.out = out;
+  ctx.failed = 0;
+  ctx.found = 0;
+  ctx.written = 0;
+  pthread_mutex_init(&ctx.lock, NULL);
+
+  pool_run(vector_total(files), logo_job, &ctx);
+
+  pthread_mutex_destroy(&ctx.lock);
+  fflush(out);
+
+  log_notice("%d logo(s) found, %d new in \"%s\"\n", ctx.found, ctx.written,
+    directory);
+
+  return ctx.failed;
+}
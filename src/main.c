@@ -41,11 +41,27 @@
 #include "utils.h"
 #include "vector.h"
 
-#include "iptmpl.h"
 #include "ip.h"
 
 #include "mr.h"
 #include "field.h"
+#include "patch.h"
+#include "extract.h"
+#include "verify.h"
+#include "iso.h"
+#include "sector.h"
+#include "cdi.h"
+#include "gdi.h"
+#include "scramble.h"
+#include "scan.h"
+#include "logo.h"
+#include "server.h"
+#include "output.h"
+#include "watch.h"
+#include "pool.h"
+#include "stats.h"
+#include "trace.h"
+#include "variant.h"
 
 // Output IP.BIN filename
 char *g_filename_out = NULL;
@@ -59,17 +75,197 @@ char *g_filename_image_out = NULL;
 // ip.txt file (if any)
 char *g_filename_in = NULL;
 
+// external IP.TMPL file (if any)
+char *g_filename_template = NULL;
+
+// embedded IP.TMPL name (if any)
+char *g_template_name = NULL;
+
+// master bootstrap image (embedded or memory-mapped IP.TMPL)
+ip_template_t g_ip_template;
+
 // data that will be written to the IP.BIN output file
-char g_ip_data[INITIAL_PROGRAM_SIZE];
+char *g_ip_data = NULL;
 
 // command-line arguments not parsed by getopt
 int g_real_argc = 0;
 VECTOR_DECLARE(g_real_argv);
 
 // options handled by makeip
-#define OPTIONS "a:b:c:d:e:fg:hi:n:l:p:s:t:uv"
+#define OPTIONS "a:b:c:d:e:fg:hi:j:n:l:p:s:t:T:uv"
 char *g_parameterized_options;
 
+// long options (without short equivalent) handled by makeip
+enum {
+  OPTION_PATCH = 256,
+  OPTION_FIELDS,
+  OPTION_EXTRACT,
+  OPTION_FORMAT,
+  OPTION_VERIFY,
+  OPTION_REPORT,
+  OPTION_CRC_BENCHMARK,
+  OPTION_ISO,
+  OPTION_ISO_ROOT,
+  OPTION_MSINFO,
+  OPTION_JOLIET,
+  OPTION_VOLUME_ID,
+  OPTION_INJECT,
+  OPTION_SECTOR_FORMAT,
+  OPTION_CDI,
+  OPTION_CDI_TRACK,
+  OPTION_GDI,
+  OPTION_SCRAMBLE,
+  OPTION_DESCRAMBLE,
+  OPTION_BOOT_OUT,
+  OPTION_LAYOUT,
+  OPTION_PAD_TO,
+  OPTION_SCAN,
+  OPTION_EXTRACT_LOGO,
+  OPTION_PNG,
+  OPTION_SERVER,
+  OPTION_WATCH,
+  OPTION_MD,
+  OPTION_MF,
+  OPTION_SYNC,
+  OPTION_STATS,
+  OPTION_TRACE,
+  OPTION_LOG_LEVEL,
+  OPTION_LOG_FORMAT,
+  OPTION_VARY,
+  OPTION_OUT_PATTERN
+};
+
+struct option g_long_options[] = {
+  { "patch",   no_argument,       NULL, OPTION_PATCH },
+  { "fields",  required_argument, NULL, OPTION_FIELDS },
+  { "extract", no_argument,       NULL, OPTION_EXTRACT },
+  { "format",  required_argument, NULL, OPTION_FORMAT },
+  { "verify",  no_argument,       NULL, OPTION_VERIFY },
+  { "report",  required_argument, NULL, OPTION_REPORT },
+  { "crc-benchmark", no_argument, NULL, OPTION_CRC_BENCHMARK },
+  { "iso",       required_argument, NULL, OPTION_ISO },
+  { "iso-root",  required_argument, NULL, OPTION_ISO_ROOT },
+  { "msinfo",    required_argument, NULL, OPTION_MSINFO },
+  { "joliet",    no_argument,       NULL, OPTION_JOLIET },
+  { "volume-id", required_argument, NULL, OPTION_VOLUME_ID },
+  { "inject",    required_argument, NULL, OPTION_INJECT },
+  { "sector-format", required_argument, NULL, OPTION_SECTOR_FORMAT },
+  { "cdi",       required_argument, NULL, OPTION_CDI },
+  { "cdi-track", required_argument, NULL, OPTION_CDI_TRACK },
+  { "gdi",       required_argument, NULL, OPTION_GDI },
+  { "scramble",   required_argument, NULL, OPTION_SCRAMBLE },
+  { "descramble", required_argument, NULL, OPTION_DESCRAMBLE },
+  { "boot-out",   required_argument, NULL, OPTION_BOOT_OUT },
+  { "layout",     required_argument, NULL, OPTION_LAYOUT },
+  { "pad-to",     required_argument, NULL, OPTION_PAD_TO },
+  { "scan",       no_argument,       NULL, OPTION_SCAN },
+  { "extract-logo", required_argument, NULL, OPTION_EXTRACT_LOGO },
+  { "png",        no_argument,       NULL, OPTION_PNG },
+  { "server",     required_argument, NULL, OPTION_SERVER },
+  { "watch",      no_argument,       NULL, OPTION_WATCH },
+  { "MD",         no_argument,       NULL, OPTION_MD },
+  { "MF",         required_argument, NULL, OPTION_MF },
+  { "sync",       required_argument, NULL, OPTION_SYNC },
+  { "stats",      required_argument, NULL, OPTION_STATS },
+  { "trace",      required_argument, NULL, OPTION_TRACE },
+  { "log-level",  required_argument, NULL, OPTION_LOG_LEVEL },
+  { "log-format", required_argument, NULL, OPTION_LOG_FORMAT },
+  { "vary",       required_argument, NULL, OPTION_VARY },
+  { "out-pattern", required_argument, NULL, OPTION_OUT_PATTERN },
+  { NULL,      0,                 NULL, 0 }
+};
+
+// what makeip is doing for this run
+typedef enum app_mode_t {
+  MODE_GENERATE = 0, // generate a new IP.BIN (and/or convert a logo)
+  MODE_PATCH,        // update existing IP.BIN files in place
+  MODE_EXTRACT,      // dump the fields of existing IP.BIN files
+  MODE_VERIFY,       // check existing IP.BIN files
+  MODE_SCAN,         // find IP.BIN inside disc images of any format
+  MODE_LOGO,         // copy the logos of IP.BIN files/disc images to a library
+  MODE_SERVER        // generate IP.BIN files for the clients of a local socket
+} app_mode_t;
+
+app_mode_t g_mode = MODE_GENERATE;
+
+// input files for the batch modes (i.e. all modes except MODE_GENERATE)
+VECTOR_DECLARE(g_batch_files);
+
+// file names read from "@list" arguments
+VECTOR_DECLARE(g_listed_files);
+
+// output format of the extract mode
+extract_format_t g_extract_format = EXTRACT_FORMAT_TXT;
+
+// logo library of the extract logo mode, and PNG copies of the logos
+char *g_logo_directory = NULL;
+int g_logo_png = 0;
+
+// regenerate the bootstrap when its inputs are changed
+int g_watch = 0;
+
+// stages of the bootstrap generation run again by the watch mode
+#define WATCH_FIELDS   (1 << 0)
+#define WATCH_LOGO     (1 << 1)
+#define WATCH_TEMPLATE (1 << 2)
+
+// make rule listing the inputs of the outputs (-MD, and its name set by -MF)
+int g_depfile = 0;
+char *g_filename_depfile = NULL;
+
+// timings and counters of the run, as JSON-Lines (see stats.c)
+char *g_filename_stats = NULL;
+
+// spans of the phases for each thread, in the Chrome trace format (trace.c)
+char *g_filename_trace = NULL;
+
+// matrix of bootstraps (--vary), named after the output pattern
+variant_matrix_t g_variants;
+char *g_output_pattern = NULL;
+
+// switches of the fields, also the placeholders of the output pattern
+typedef struct field_switch_t {
+  char option;
+  field_kind_t index;
+} field_switch_t;
+
+static const field_switch_t g_field_switches[] = {
+  { 'a', AREA_SYMBOLS },
+  { 'b', BOOT_FILENAME },
+  { 'c', SW_MAKER_NAME },
+  { 'd', RELEASE_DATE },
+  { 'e', VERSION },
+  { 'g', GAME_TITLE },
+  { 'i', DEVICE_INFO },
+  { 'n', PRODUCT_NO },
+  { 'p', PERIPHERALS },
+};
+
+// Unix domain socket of the server mode
+char *g_server_socket = NULL;
+
+// machine-readable report of the verify mode (if any)
+char *g_filename_report = NULL;
+
+// ISO image to build from a directory (if any)
+char *g_filename_iso_out = NULL;
+iso_options_t g_iso_options;
+
+// DiscJuggler image to build and its data track (if any)
+char *g_filename_cdi_out = NULL;
+char *g_filename_cdi_track = NULL;
+
+// GD-ROM image descriptor to build (if any)
+char *g_filename_gdi_out = NULL;
+
+// boot executable to (de)scramble and its output file (if any)
+scramble_mode_t g_scramble_mode = SCRAMBLE_NONE;
+char *g_filename_scramble_in = NULL;
+char *g_filename_boot_out = NULL;
+
+// existing ISO images receiving the bootstrap in their system area
+VECTOR_DECLARE(g_inject_files);
+
 // fields input from command-line
 char *g_field_inputs[NUM_FIELDS];
 
@@ -77,8 +273,18 @@ void
 app_finalize(void)
 {
   field_finalize();
+  if (g_ip_data != NULL) {
+    ip_destroy(g_ip_data);
+  }
+  ip_template_release(&g_ip_template);
   program_name_finalize();
   VECTOR_FREE(g_real_argv);
+  for(int i = 0; i < VECTOR_TOTAL(g_listed_files); i++) {
+    free(VECTOR_GET(g_listed_files, char*, i));
+  }
+  VECTOR_FREE(g_listed_files);
+  VECTOR_FREE(g_batch_files);
+  VECTOR_FREE(g_inject_files);
   free(g_parameterized_options);
   for(int i = 0; i < NUM_FIELDS; i++) {
     if (g_field_inputs[i] != NULL) {
@@ -101,11 +307,13 @@ app_initialize(char *argv0)
   // initialize default values for fields
   field_initialize();
 
-  // initializing IP default data
-  memcpy(g_ip_data, default_ip_data, INITIAL_PROGRAM_SIZE);
-
   // initialize the array for real argv values
   VECTOR_INIT(g_real_argv);
+  VECTOR_INIT(g_batch_files);
+  VECTOR_INIT(g_listed_files);
+  VECTOR_INIT(g_inject_files);
+
+  variant_init(&g_variants);
 
   // retrieve parameterized options
   g_parameterized_options = retrieve_parameterized_options(OPTIONS);
@@ -119,20 +327,72 @@ usage(int print_field_information)
   printf("Usage:\n");
   printf("\t%s [options] [ip_fields] <IP.BIN>\n", program_name_get());
   printf("\t%s [options] [ip_fields] <ip.txt> <IP.BIN>\n", program_name_get());
-  printf("\t%s -l <iplogo_in> -s <iplogo.mr>\n\n", program_name_get());
+  printf("\t%s -l <iplogo_in> -s <iplogo.mr>\n", program_name_get());
+  printf("\t%s --patch [options] [ip_fields] <IP.BIN> [<IP.BIN> ...]\n", program_name_get());
+  printf("\t%s [options] [ip_fields] --iso-root <dir> --iso <image.iso> [<IP.BIN>]\n", program_name_get());
+  printf("\t%s [options] [ip_fields] --inject <image.iso> [<IP.BIN>]\n", program_name_get());
+  printf("\t%s [options] [ip_fields] --iso-root <dir> --gdi <disc.gdi> [<IP.BIN>]\n", program_name_get());
+  printf("\t%s [options] [ip_fields] --cdi-track <track.iso> --cdi <image.cdi> [<IP.BIN>]\n", program_name_get());
+  printf("\t%s --extract [--format <txt|jsonl>] <IP.BIN> [<IP.BIN> ...]\n", program_name_get());
+  printf("\t%s --verify [--report <report.jsonl>] <IP.BIN> [<IP.BIN> ...]\n", program_name_get());
+  printf("\t%s --scan [--format <txt|jsonl>] <image> [<image> ...]\n", program_name_get());
+  printf("\t%s --extract-logo <dir> [--png] <IP.BIN|image> [<IP.BIN|image> ...]\n", program_name_get());
+  printf("\t%s --server <socket> [options] [ip_fields]\n\n", program_name_get());
   if (!print_field_information) {
     printf("Options:\n");
     printf("\t-f                 Force overwrite output file if already exist\n");
     printf("\t-h                 Print usage information (you\'re looking at it)\n");
+    printf("\t-j <threads>       Number of threads used by batch modes (default: all CPUs)\n");
     printf("\t-l <infilename>    Load/insert an image into bootstrap (%s)\n", mr_get_friendly_supported_format());
     printf("\t-t <tmplfilename>  Use an external IP.TMPL file (override default)\n");
+    printf("\t-T <tmplname>      Use an embedded IP.TMPL (%s)\n", ip_template_get_names());
     printf("\t-u                 Print field usage information\n");
     printf("\t-s <outfilename>   Save image from <infilename> to MR format (see \'-l\')\n");
     printf("\t-v                 Enable verbose mode\n");
+    printf("\t--fields <ip.txt>  Read fields from <ip.txt> (same as the <ip.txt> argument)\n");
+    printf("\t--patch            Update fields/logo of existing IP.BIN files in place\n");
+    printf("\t--extract          Print the fields of existing IP.BIN files\n");
+    printf("\t--format <format>  Output format of \'--extract\', \'--scan\': txt (ip.txt), jsonl\n");
+    printf("\t--scan             Find the bootstraps inside disc images (BIN, CDI, NRG...)\n");
+    printf("\t--extract-logo <dir> Copy the logos of IP.BIN files/disc images to <dir>\n");
+    printf("\t--png              Save the logos of \'--extract-logo\' as PNG too\n");
+    printf("\t--server <socket>  Generate bootstraps for the clients of <socket> (see makeipc)\n");
+    printf("\t--verify           Check fields, CRC and logo of existing IP.BIN files\n");
+    printf("\t--report <file>    Write the \'--verify\' results to <file> (JSON-Lines)\n");
+    printf("\t--iso <image.iso>  Build an ISO9660 image with the bootstrap (see \'--iso-root\')\n");
+    printf("\t--iso-root <dir>   Directory holding the files of the ISO image\n");
+    printf("\t--msinfo <lba>     Start LBA of the ISO image (e.g. 11702, default: 0)\n");
+    printf("\t--joliet           Add Joliet extensions to the ISO image\n");
+    printf("\t--volume-id <id>   Volume identifier of the ISO image (default: game title)\n");
+    printf("\t--inject <iso>     Write the bootstrap into an existing ISO image\n");
+    printf("\t--sector-format <f> Sectors written: iso (2048), mode1, mode2 (2352)\n");
+    printf("\t--layout <trace>   Place the files of the image in the access order of <trace>\n");
+    printf("\t--pad-to <lba>     Move the data of the image to <lba> (or \'outer\') with a dummy file\n");
+    printf("\t--cdi <image.cdi>  Build a selfboot DiscJuggler image (see \'--cdi-track\')\n");
+    printf("\t--cdi-track <iso>  Data track of the CDI image (default: from \'--iso-root\')\n");
+    printf("\t--gdi <disc.gdi>   Build a GD-ROM image (tracks next to <disc.gdi>, see \'--iso-root\')\n");
+    printf("\t--scramble <file>  Scramble the boot executable <file> (see \'--boot-out\')\n");
+    printf("\t--descramble <file> Descramble the boot executable <file> (see \'--boot-out\')\n");
+    printf("\t--boot-out <file>  Output of \'--scramble\' (default: Boot Filename next to IP.BIN)\n");
+    printf("\t--watch            Regenerate <IP.BIN> when ip.txt, logo or template change\n");
+    printf("\t--sync <policy>    Durability of the outputs: none (default), file, batch\n");
+    printf("\t-MD                Write a make rule listing the inputs to <output>.d\n");
+    printf("\t-MF <file>         Write the rule of \'-MD\' to <file>\n");
+    printf("\t--stats <file>     Write timings, counters and peak memory to <file> (JSON)\n");
+    printf("\t--trace <file>     Write the spans of each thread to <file> (Chrome trace)\n");
+    printf("\t--vary <s>=<v1>,<v2>... Generate a bootstrap for each value of field '-<s>'\n");
+    printf("\t--out-pattern <name> Names of the '--vary' bootstraps, '%%<s>' is the value\n");
+    printf("\t--log-level <level> Messages printed: error, warning (default), notice ('-v')\n");
+    printf("\t--log-format <format> Format of the messages: text (default), json\n");
+    printf("\t--crc-benchmark    Check and benchmark the CRC implementations\n");
+    printf("\nIn batch modes, an argument like @<file> reads file names from <file>.\n");
+    printf("A file name of \"-\" reads ip.txt or the logo from the standard input, or\n");
+    printf("writes IP.BIN or the MR file ('-s') to the standard output.\n");
 	printf("\nExamples:\n");
 	printf("\t%s -l iplogo.mr ip.txt IP.BIN\n", program_name_get());
 	printf("\t%s -g \"MY INCREDIBLE GAME\" -c \"INDIE DEV\" -t IP.TMPL -v -f IP.BIN\n", program_name_get());
 	printf("\t%s -l iplogo.png -s iplogo.mr -v -f \n", program_name_get());
+	printf("\t%s --patch -e V1.001 -l iplogo.png IP.BIN\n", program_name_get());
   } else {
     printf("IP (Initial Program) fields:\n");
     printf("\t-a <areasymbols>   Area sym (J)apan, (U)SA, (E)urope (default: %s)\n", field_get_pretty_value(AREA_SYMBOLS));
@@ -147,6 +407,13 @@ usage(int print_field_information)
   }
 }
 
+void
+add_batch_file(char *filename)
+{
+  VECTOR_ADD(g_listed_files, filename);
+  VECTOR_ADD(g_batch_files, filename);
+}
+
 void
 parse_real_args(int argc, char *argv[])
 {
@@ -156,9 +423,29 @@ parse_real_args(int argc, char *argv[])
 
   g_real_argc = VECTOR_TOTAL(g_real_argv);
 
+  // in batch modes, all the arguments are the files to process
+  if (g_mode != MODE_GENERATE) {
+    for (int i = 0; i < g_real_argc; i++) {
+      char *arg = VECTOR_GET(g_real_argv, char*, i);
+      if (arg[0] == '@') {
+        if (file_list_load(arg + 1, add_batch_file) < 0) {
+          exit(EXIT_FAILURE);
+        }
+      } else {
+        VECTOR_ADD(g_batch_files, arg);
+      }
+    }
+    return;
+  }
+
   switch(g_real_argc) {
     case 1:
-      g_filename_out = VECTOR_GET(g_real_argv, char*, 0);
+      // the bootstraps of a matrix are named by the output pattern
+      if (g_output_pattern != NULL) {
+        g_filename_in = VECTOR_GET(g_real_argv, char*, 0);
+      } else {
+        g_filename_out = VECTOR_GET(g_real_argv, char*, 0);
+      }
       break;
     case 2:
       g_filename_in = VECTOR_GET(g_real_argv, char*, 0);
@@ -173,10 +460,489 @@ set_input_value(int index, char *optarg)
   g_field_inputs[index] = strdup(optarg);
 }
 
+// Checks the use of "-" for the inputs and outputs: there is only one
+// standard input/output, and the notices can't be mixed with the data
+void
+check_stdio(void)
+{
+  int readers = is_stdio(g_filename_in) + is_stdio(g_filename_image_in);
+  int writers = is_stdio(g_filename_out) + is_stdio(g_filename_image_out) +
+    is_stdio(g_filename_depfile) + is_stdio(g_filename_stats) +
+    is_stdio(g_filename_trace);
+
+  if (readers > 1) {
+    halt("only one input can be read from the standard input\n");
+  }
+  if (writers > 1) {
+    halt("only one output can be written to the standard output\n");
+  }
+  if ((readers || writers) && g_watch) {
+    halt("the standard input/output can't be used with \"--watch\"\n");
+  }
+
+  if (writers) {
+    log_stdout_release();
+  }
+}
+
+int
+load_field_inputs(void)
+{
+  uint64_t start = stats_start();
+  int result = 0;
+
+  // assign field values from the ip template file
+  // use an 'IP.TXT' file for input
+  if (g_filename_in == NULL || field_load_file(g_filename_in)) {
+    // assign field values from the command-line options
+    for (int i = 0; i < NUM_FIELDS; i++) {
+      if (g_field_inputs[i] != NULL) {
+        field_set_value(i, g_field_inputs[i]);
+      }
+    }
+    result = !field_erroneous();
+  }
+
+  stats_stop(STATS_FIELDS, start);
+
+  return result;
+}
+
+void
+apply_field_inputs(void)
+{
+  if (!load_field_inputs()) {
+    // stop if an error was detected when setting a field value
+    if (field_erroneous()) {
+      halt("field error; fix incorrect value(s) and try again\n");
+    }
+    exit(EXIT_FAILURE);
+  }
+}
+
+int
+patch_files(void)
+{
+  mr_output_t logo;
+  int failed = 0;
+
+  // the logo is converted once for all the files
+  mr_init(&logo);
+  if (g_filename_image_in != NULL) {
+    mr_load(g_filename_image_in, &logo);
+    if (logo.size > MR_MAX_SIZE) {
+      halt("MR data is larger than %d bytes, can't patch bootstrap\n", MR_MAX_SIZE);
+    }
+    if (g_filename_image_out != NULL) {
+      mr_dump(&logo, g_filename_image_out);
+    }
+  }
+
+  int total = VECTOR_TOTAL(g_batch_files);
+  for (int i = 0; i < total; i++) {
+    char *filename = VECTOR_GET(g_batch_files, char*, i);
+    stats_record_begin();
+    if (!patch_file(filename, (g_filename_image_in != NULL) ? &logo : NULL)) {
+      failed++;
+    }
+    stats_record(filename);
+  }
+
+  mr_destroy(&logo);
+
+  if (failed) {
+    log_error("%d of %d bootstrap file(s) not patched\n", failed, total);
+  }
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+void
+load_template(void)
+{
+  if (g_filename_template != NULL) {
+    ip_template_load(&g_ip_template, g_filename_template);
+  } else if (g_template_name != NULL) {
+    if (!ip_template_embedded(&g_ip_template, g_template_name)) {
+      exit(EXIT_FAILURE);
+    }
+  } else {
+    ip_template_default(&g_ip_template);
+  }
+}
+
+int
+serve(void)
+{
+  mr_output_t logo;
+  int result;
+
+  // the options give the defaults of the requests
+  load_template();
+  apply_field_inputs();
+
+  mr_init(&logo);
+  if (g_filename_image_in != NULL) {
+    mr_load(g_filename_image_in, &logo);
+    if (logo.size > MR_MAX_SIZE) {
+      halt("MR data is larger than %d bytes, can't serve bootstraps\n", MR_MAX_SIZE);
+    }
+  }
+
+  result = server_run(g_server_socket, &g_ip_template,
+    (g_filename_image_in != NULL) ? &logo : NULL);
+
+  mr_destroy(&logo);
+
+  return result;
+}
+
+// Adds a field to the matrix, e.g. "a=J,U,E" (--vary)
+void
+add_variant(char *arg)
+{
+  int count = sizeof(g_field_switches) / sizeof(field_switch_t);
+  int i;
+
+  for (i = 0; i < count && arg[0] != g_field_switches[i].option; i++);
+
+  if (i == count || arg[1] != '=') {
+    halt("invalid matrix field \"%s\" (e.g. \"a=J,U,E\")\n", arg);
+  }
+
+  if (!variant_add(&g_variants, arg[0], g_field_switches[i].index, arg + 2)) {
+    exit(EXIT_FAILURE);
+  }
+}
+
+// Writes the bootstraps of the matrix: the bootstrap (template, fields,
+// logo) is generated once, then only the varied fields are patched
+int
+generate_variants(void)
+{
+  if (g_output_pattern == NULL) {
+    halt("no name for the bootstraps of the matrix (see \"--out-pattern\")\n");
+  }
+  if (g_real_argc > 1) {
+    halt("too many arguments\n");
+  }
+  if (g_filename_iso_out != NULL || g_filename_cdi_out != NULL ||
+      g_filename_gdi_out != NULL || VECTOR_TOTAL(g_inject_files) ||
+      g_scramble_mode != SCRAMBLE_NONE || g_watch || g_depfile) {
+    halt("disc images, \"--scramble\", \"--watch\" and \"-MD\" can't be used"
+      " with \"--out-pattern\"\n");
+  }
+
+  load_template();
+  g_ip_data = ip_create(&g_ip_template);
+
+  apply_field_inputs();
+  field_write(g_ip_data);
+
+  // the logo is converted once for all the bootstraps
+  ip_write(g_ip_data, NULL, g_filename_image_in, g_filename_image_out);
+
+  int result = variant_generate(&g_variants, g_ip_data, g_output_pattern,
+    g_iso_options.sector_format, g_iso_options.lba);
+
+  variant_release(&g_variants);
+
+  return result;
+}
+
+// Ends the run, once the outputs are durable (see --sync)
+int
+finish(int status)
+{
+  if (!output_flush()) {
+    return EXIT_FAILURE;
+  }
+
+  return status;
+}
+
+int
+write_bootstrap(void)
+{
+  if (g_iso_options.sector_format == SECTOR_FORMAT_ISO) {
+    return output_write(g_filename_out, g_ip_data, INITIAL_PROGRAM_SIZE, 0);
+  }
+
+  return sector_file_write(g_filename_out, g_iso_options.sector_format,
+    g_iso_options.lba, g_ip_data, INITIAL_PROGRAM_SIZE);
+}
+
+int
+write_depfile(void)
+{
+  char *inputs[] = { g_filename_in, g_filename_template, g_filename_image_in };
+  char *target = g_filename_out;
+  char *filename = g_filename_depfile;
+  int result;
+
+  // the rule is for the main output, i.e. the bootstrap or the first image
+  if (target == NULL) {
+    target = (g_filename_iso_out != NULL) ? g_filename_iso_out :
+      (g_filename_cdi_out != NULL) ? g_filename_cdi_out :
+      (g_filename_gdi_out != NULL) ? g_filename_gdi_out :
+      VECTOR_GET(g_inject_files, char*, 0);
+  }
+
+  if (filename == NULL) {
+    if (is_stdio(target)) {
+      halt("no dependency file name for the standard output (see \"-MF\")\n");
+    }
+    filename = (char *) malloc(strlen(target) + 3);
+    sprintf(filename, "%s.d", target);
+  }
+
+  result = output_write_depfile(filename, target, inputs,
+    sizeof(inputs) / sizeof(char *));
+
+  if (filename != g_filename_depfile) {
+    free(filename);
+  }
+
+  return result;
+}
+
+// Runs again the stages of the generation whose inputs are changed, then
+// rewrites the bootstrap; the results of the other stages are kept
+int
+watch_inputs(void)
+{
+  watch_t watch;
+  mr_output_t logo;
+  int pending = 0;
+
+  if (g_filename_out == NULL) {
+    halt("no output bootstrap file to regenerate (see \"--watch\")\n");
+  }
+
+  if (!watch_init(&watch) ||
+      (g_filename_in != NULL && !watch_add(&watch, g_filename_in, WATCH_FIELDS)) ||
+      (g_filename_image_in != NULL && !watch_add(&watch, g_filename_image_in, WATCH_LOGO)) ||
+      (g_filename_template != NULL && !watch_add(&watch, g_filename_template, WATCH_TEMPLATE))) {
+    return 0;
+  }
+
+  if (!watch.count) {
+    halt("no input file to watch (ip.txt, '-l' or '-t')\n");
+  }
+
+  // the logo written by ip_write() is converted again once, then kept
+  mr_init(&logo);
+  if (g_filename_image_in != NULL && !mr_load_file(g_filename_image_in, &logo)) {
+    return 0;
+  }
+
+  // the bootstrap is now ours to replace
+  output_overwrite_set(1);
+  if (!output_flush()) {
+    return 0;
+  }
+
+  printf("watching the inputs of \"%s\" (Ctrl+C to stop)\n", g_filename_out);
+  fflush(stdout);
+
+  for (;;) {
+    struct timespec start, end;
+    int changed = watch_wait(&watch);
+
+    if (!changed) {
+      break;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    // stages which failed are run again with the next change
+    pending |= changed;
+
+    if (pending & WATCH_TEMPLATE) {
+      ip_template_t tmpl;
+      if (!ip_template_open(&tmpl, g_filename_template)) {
+        continue;
+      }
+      ip_template_release(&g_ip_template);
+      g_ip_template = tmpl;
+      memcpy(g_ip_data, g_ip_template.data, INITIAL_PROGRAM_SIZE);
+    }
+
+    if (pending & WATCH_FIELDS) {
+      field_initialize();
+      if (!load_field_inputs()) {
+        continue;
+      }
+    }
+
+    if (pending & WATCH_LOGO) {
+      mr_output_t loaded;
+      mr_init(&loaded);
+      if (!mr_load_file(g_filename_image_in, &loaded)) {
+        mr_destroy(&loaded);
+        continue;
+      }
+      if (loaded.size > MR_MAX_SIZE) {
+        log_error("MR data is larger than %d bytes\n", MR_MAX_SIZE);
+        mr_destroy(&loaded);
+        continue;
+      }
+      mr_destroy(&logo);
+      logo = loaded;
+      if (g_filename_image_out != NULL) {
+        mr_dump(&logo, g_filename_image_out);
+      }
+    }
+
+    // patch the bootstrap: the template copy holds neither fields nor logo
+    if (pending & (WATCH_FIELDS | WATCH_TEMPLATE)) {
+      field_write(g_ip_data);
+      update_crc(g_ip_data);
+    }
+
+    if (pending & (WATCH_LOGO | WATCH_TEMPLATE)) {
+      memcpy(g_ip_data + MR_OFFSET, g_ip_template.data + MR_OFFSET, MR_MAX_SIZE);
+      if (logo.data != NULL) {
+        mr_write(g_ip_data, &logo);
+      }
+    }
+
+    if (!write_bootstrap() || !output_flush()) {
+      continue;
+    }
+    pending = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("\"%s\" regenerated (%.2f ms)\n", g_filename_out,
+      (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+    fflush(stdout);
+  }
+
+  mr_destroy(&logo);
+  watch_release(&watch);
+
+  return 0;
+}
+
+int
+scramble_boot_file(int overwrite)
+{
+  char *filename = g_filename_boot_out;
+  int result;
+
+  // by default, the scrambled binary is stored next to the bootstrap, with
+  // the name given in the Boot Filename field
+  if (filename == NULL) {
+    if (g_scramble_mode == SCRAMBLE_DECODE) {
+      halt("no output file given for the descrambled binary (see \"--boot-out\")\n");
+    }
+    char *boot = field_get_value(BOOT_FILENAME);
+    char *separator = (g_filename_out != NULL) ? strrchr(g_filename_out, '/') : NULL;
+    size_t length = (separator != NULL) ? separator - g_filename_out + 1 : 0;
+    filename = (char *) malloc(length + strlen(boot) + 1);
+    memcpy(filename, g_filename_out, length);
+    strcpy(filename + length, boot);
+  }
+
+  if (!overwrite && is_file_exist(filename)) {
+    log_error("output boot file \"%s\" already exist\n", filename);
+    result = 0;
+  } else {
+    result = scramble_file(g_scramble_mode, g_filename_scramble_in, filename);
+  }
+
+  if (filename != g_filename_boot_out) {
+    free(filename);
+  }
+
+  return result;
+}
+
+int
+write_images(int overwrite)
+{
+  // the boot file must be present on the disc
+  g_iso_options.boot_filename = field_get_value(BOOT_FILENAME);
+  if (g_iso_options.volume_id == NULL) {
+    g_iso_options.volume_id = field_get_value(GAME_TITLE);
+  }
+
+  if (g_filename_iso_out != NULL) {
+    if (g_iso_options.root == NULL) {
+      halt("no directory given for the ISO image (see \"--iso-root\")\n");
+    }
+    if (!overwrite && is_file_exist(g_filename_iso_out)) {
+      halt("output image file \"%s\" already exist\n", g_filename_iso_out);
+    }
+
+    if (!iso_build(&g_iso_options, g_ip_data, g_filename_iso_out)) {
+      return 0;
+    }
+  }
+
+  if (g_filename_cdi_out != NULL) {
+    iso_options_t options = g_iso_options;
+
+    if (!overwrite && is_file_exist(g_filename_cdi_out)) {
+      halt("output image file \"%s\" already exist\n", g_filename_cdi_out);
+    }
+
+    // the data track is always in the second session
+    options.cdi = 1;
+    if (!options.lba) {
+      options.lba = ISO_DEFAULT_MSINFO;
+    }
+
+    if (g_filename_cdi_track != NULL) {
+      if (!cdi_convert(g_ip_data, g_filename_cdi_track, g_filename_cdi_out, options.lba)) {
+        return 0;
+      }
+    } else if (options.root != NULL) {
+      if (!iso_build(&options, g_ip_data, g_filename_cdi_out)) {
+        return 0;
+      }
+    } else {
+      halt("no data track for the CDI image (see \"--iso-root\" or \"--cdi-track\")\n");
+    }
+  }
+
+  if (g_filename_gdi_out != NULL) {
+    if (g_iso_options.root == NULL) {
+      halt("no directory given for the GDI image (see \"--iso-root\")\n");
+    }
+    if (!overwrite && is_file_exist(g_filename_gdi_out)) {
+      halt("output image file \"%s\" already exist\n", g_filename_gdi_out);
+    }
+
+    if (!gdi_build(&g_iso_options, g_ip_data, g_filename_gdi_out)) {
+      return 0;
+    }
+  }
+
+  if (VECTOR_TOTAL(g_inject_files) && g_iso_options.sector_format != SECTOR_FORMAT_ISO) {
+    halt("bootstrap can only be injected into 2048 bytes sectors images\n");
+  }
+
+  int failed = 0;
+  for (int i = 0; i < VECTOR_TOTAL(g_inject_files); i++) {
+    char *filename = VECTOR_GET(g_inject_files, char*, i);
+    if (!iso_inject(g_ip_data, filename, field_get_value(BOOT_FILENAME))) {
+      failed++;
+    }
+  }
+
+  if (failed) {
+    log_error("bootstrap not injected into %d image(s)\n", failed);
+    return 0;
+  }
+
+  return 1;
+}
+
 int
 main(int argc, char *argv[])
 {
-  int c, overwrite = 0, export_logo_only = 0;
+  int c, overwrite = 0, export_logo_only = 0, image_output = 0;
+  long threads;
 
   app_initialize(argv[0]);
 
@@ -185,9 +951,18 @@ main(int argc, char *argv[])
     exit(EXIT_FAILURE);
   }
 
+  // the gcc-like dependency options are handled as long options
+  for (int i = 1; i < argc && strcmp(argv[i], "--"); i++) {
+    if (!strcmp(argv[i], "-MD")) {
+      argv[i] = "--MD";
+    } else if (!strcmp(argv[i], "-MF")) {
+      argv[i] = "--MF";
+    }
+  }
+
   // read the options
   opterr = 0; // suppress default getopt error messages
-  while ((c = getopt(argc, argv, OPTIONS)) != -1) {
+  while ((c = getopt_long(argc, argv, OPTIONS, g_long_options, NULL)) != -1) {
     switch (c) {
       case 'a':
         set_input_value(AREA_SYMBOLS, optarg);
@@ -217,6 +992,12 @@ main(int argc, char *argv[])
       case 'i':
         set_input_value(DEVICE_INFO, optarg);
         break;
+      case 'j':
+        if (!long_parse(optarg, &threads) || threads < 1) {
+          halt("invalid number of threads \"%s\"\n", optarg);
+        }
+        pool_threads_set(threads);
+        break;
       case 'n':
         set_input_value(PRODUCT_NO, optarg);
         break;
@@ -230,7 +1011,10 @@ main(int argc, char *argv[])
         g_filename_image_out = optarg;
         break;
       case 't':
-        ip_read(g_ip_data, optarg);
+        g_filename_template = optarg;
+        break;
+      case 'T':
+        g_template_name = optarg;
         break;
       case 'u':
         usage(1);
@@ -239,8 +1023,148 @@ main(int argc, char *argv[])
       case 'v':
         verbose_enable();
 	break;
+      case OPTION_PATCH:
+        g_mode = MODE_PATCH;
+        break;
+      case OPTION_EXTRACT:
+        g_mode = MODE_EXTRACT;
+        break;
+      case OPTION_ISO:
+        g_filename_iso_out = optarg;
+        break;
+      case OPTION_ISO_ROOT:
+        g_iso_options.root = optarg;
+        break;
+      case OPTION_MSINFO:
+        if (!iso_msinfo_parse(optarg, &g_iso_options.lba)) {
+          halt("invalid LBA \"%s\"\n", optarg);
+        }
+        break;
+      case OPTION_JOLIET:
+        g_iso_options.joliet = 1;
+        break;
+      case OPTION_VOLUME_ID:
+        g_iso_options.volume_id = optarg;
+        break;
+      case OPTION_INJECT:
+        VECTOR_ADD(g_inject_files, optarg);
+        break;
+      case OPTION_CDI:
+        g_filename_cdi_out = optarg;
+        break;
+      case OPTION_CDI_TRACK:
+        g_filename_cdi_track = optarg;
+        break;
+      case OPTION_GDI:
+        g_filename_gdi_out = optarg;
+        break;
+      case OPTION_SCRAMBLE:
+      case OPTION_DESCRAMBLE:
+        g_scramble_mode = (c == OPTION_SCRAMBLE) ? SCRAMBLE_ENCODE : SCRAMBLE_DECODE;
+        g_filename_scramble_in = optarg;
+        break;
+      case OPTION_BOOT_OUT:
+        g_filename_boot_out = optarg;
+        break;
+      case OPTION_LAYOUT:
+        g_iso_options.layout = optarg;
+        break;
+      case OPTION_PAD_TO:
+        if (!iso_pad_parse(optarg, &g_iso_options.pad_to)) {
+          halt("invalid padding \"%s\" (LBA or \"outer\")\n", optarg);
+        }
+        break;
+      case OPTION_SECTOR_FORMAT:
+        if (!sector_format_parse(optarg, &g_iso_options.sector_format)) {
+          halt("invalid sector format \"%s\" (iso, mode1, mode2)\n", optarg);
+        }
+        break;
+      case OPTION_CRC_BENCHMARK:
+        exit(crc_benchmark(64 * 1024 * 1024) ? EXIT_SUCCESS : EXIT_FAILURE);
+        break;
+      case OPTION_SCAN:
+        g_mode = MODE_SCAN;
+        break;
+      case OPTION_EXTRACT_LOGO:
+        g_mode = MODE_LOGO;
+        g_logo_directory = optarg;
+        break;
+      case OPTION_PNG:
+        g_logo_png = 1;
+        break;
+      case OPTION_SYNC:
+        {
+          output_sync_t policy;
+          if (!output_sync_parse(optarg, &policy)) {
+            halt("invalid sync policy \"%s\" (none, file, batch)\n", optarg);
+          }
+          output_sync_set(policy);
+        }
+        break;
+      case OPTION_STATS:
+        g_filename_stats = optarg;
+        break;
+      case OPTION_TRACE:
+        g_filename_trace = optarg;
+        break;
+      case OPTION_LOG_LEVEL:
+        {
+          log_level_t level;
+          if (!log_level_parse(optarg, &level)) {
+            halt("invalid log level \"%s\" (error, warning, notice)\n", optarg);
+          }
+          log_level_set(level);
+        }
+        break;
+      case OPTION_VARY:
+        add_variant(optarg);
+        break;
+      case OPTION_OUT_PATTERN:
+        g_output_pattern = optarg;
+        break;
+      case OPTION_LOG_FORMAT:
+        {
+          log_format_t format;
+          if (!log_format_parse(optarg, &format)) {
+            halt("invalid log format \"%s\" (text, json)\n", optarg);
+          }
+          log_format_set(format);
+        }
+        break;
+      case OPTION_MD:
+        g_depfile = 1;
+        break;
+      case OPTION_MF:
+        g_depfile = 1;
+        g_filename_depfile = optarg;
+        break;
+      case OPTION_WATCH:
+        g_watch = 1;
+        break;
+      case OPTION_SERVER:
+        g_mode = MODE_SERVER;
+        g_server_socket = optarg;
+        break;
+      case OPTION_VERIFY:
+        g_mode = MODE_VERIFY;
+        break;
+      case OPTION_REPORT:
+        g_filename_report = optarg;
+        break;
+      case OPTION_FORMAT:
+        if (!extract_format_parse(optarg, &g_extract_format)) {
+          halt("unknown format \"%s\"\n", optarg);
+        }
+        break;
+      case OPTION_FIELDS:
+        g_filename_in = optarg;
+        break;
       case '?':
-        if (is_in_char_array(optopt, g_parameterized_options)) {
+        if (optopt >= OPTION_PATCH) {
+          halt("option \"%s\" requires an argument\n", argv[optind - 1]);
+        } else if (!optopt) {
+          halt("unknown option \"%s\"\n", argv[optind - 1]);
+        } else if (is_in_char_array(optopt, g_parameterized_options)) {
           halt("option \"-%c\" requires an argument\n", optopt);
         } else if (isprint(optopt)) {
           halt("unknown option \"-%c\"\n", optopt);
@@ -253,11 +1177,67 @@ main(int argc, char *argv[])
   }  
 
   // get extra arguments which are not parsed
-  parse_real_args(argc, argv);  
+  parse_real_args(argc, argv);
+
+  // existing outputs are never replaced without '-f', even if created after
+  // the checks below
+  output_overwrite_set(overwrite);
+
+  check_stdio();
+
+  if ((g_filename_stats != NULL && !stats_open(g_filename_stats)) ||
+      (g_filename_trace != NULL && !trace_open(g_filename_trace))) {
+    exit(EXIT_FAILURE);
+  }
+
+  if (g_mode == MODE_SERVER && VECTOR_TOTAL(g_batch_files)) {
+    halt("too many arguments\n");
+  } else if (g_mode != MODE_GENERATE && g_mode != MODE_SERVER &&
+             !VECTOR_TOTAL(g_batch_files)) {
+    halt("too few arguments\n");
+  }
+
+  switch (g_mode) {
+    case MODE_PATCH:
+      apply_field_inputs();
+      return finish(patch_files());
+    case MODE_EXTRACT:
+      return extract_files(&g_batch_files, g_extract_format, stdout) ?
+        EXIT_FAILURE : EXIT_SUCCESS;
+    case MODE_SCAN:
+      return scan_files(&g_batch_files, g_extract_format, stdout) ?
+        EXIT_FAILURE : EXIT_SUCCESS;
+    case MODE_LOGO:
+      return finish(logo_extract_files(&g_batch_files, g_logo_directory, g_logo_png,
+        stdout) ? EXIT_FAILURE : EXIT_SUCCESS);
+    case MODE_SERVER:
+      return serve() ? EXIT_SUCCESS : EXIT_FAILURE;
+    case MODE_VERIFY:
+      return verify_files(&g_batch_files, g_filename_report) ?
+        EXIT_FAILURE : EXIT_SUCCESS;
+    default:
+      break;
+  }
   
+  if (g_output_pattern != NULL || g_variants.count) {
+    return finish(generate_variants() ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+
+  // the bootstrap may be generated only to be stored in a disc image
+  image_output = (g_filename_iso_out != NULL) || (g_filename_cdi_out != NULL) ||
+    (g_filename_gdi_out != NULL) ||
+    VECTOR_TOTAL(g_inject_files);
+
   // check if we just want to export the logo
-  export_logo_only = !g_real_argc && g_filename_image_in != NULL &&
-    g_filename_image_out != NULL;
+  export_logo_only = !g_real_argc && !image_output &&
+    g_filename_image_in != NULL && g_filename_image_out != NULL;
+
+  // the boot executable may be (de)scrambled on its own
+  if (!g_real_argc && !image_output && !export_logo_only &&
+      g_scramble_mode != SCRAMBLE_NONE) {
+    apply_field_inputs();
+    return finish(scramble_boot_file(overwrite) ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
   
   // we don't know how to deal with that  
   if (g_real_argc > 2) {
@@ -265,49 +1245,70 @@ main(int argc, char *argv[])
   }
   
   // no arguments was passed... but if we just want to export the logo, it's ok  
-  if (g_real_argc < 1 && !export_logo_only) {    
+  if (g_real_argc < 1 && !export_logo_only && !image_output) {    
     halt("too few arguments\n");
   }
   
   if (!export_logo_only) {
-  
-    // assign field values from the ip template file
-    // use an 'IP.TXT' file for input
-    if (g_filename_in != NULL) {
-      field_load(g_filename_in);
-    }
 
-    // assign field values from the command-line options
-    for (int i = 0; i < NUM_FIELDS; i++) {
-      if (g_field_inputs[i] != NULL) {
-        field_set_value(i, g_field_inputs[i]);
-      }
-    }
+    // load the master bootstrap image then make our own copy of it
+    load_template();
+    g_ip_data = ip_create(&g_ip_template);
 
-    // stop if an error was detected when setting a field value
-    if (field_erroneous()) {
-      halt("field error; fix incorrect value(s) and try again\n");
-    }
+    apply_field_inputs();
 
     // write data to the ip data
     field_write(g_ip_data);
 
     // check if the output IP.BIN is writable
-    if (!overwrite && is_file_exist(g_filename_out)) {
+    if (g_filename_out != NULL && !overwrite && !is_stdio(g_filename_out) &&
+        is_file_exist(g_filename_out)) {
       halt("output bootstrap file \"%s\" already exist\n", g_filename_out);
     }
 
     // writing the file onto disk
-    log_notice("writing bootstrap to \"%s\"\n", g_filename_out);
-    ip_write(g_ip_data, g_filename_out, g_filename_image_in, g_filename_image_out);
+    if (g_filename_out != NULL) {
+      log_notice("writing bootstrap to \"%s\"\n", g_filename_out);
+    }
+    if (g_iso_options.sector_format == SECTOR_FORMAT_ISO) {
+      ip_write(g_ip_data, g_filename_out, g_filename_image_in, g_filename_image_out);
+    } else {
+      // raw sectors addressed from the start of the data track
+      ip_write(g_ip_data, NULL, g_filename_image_in, g_filename_image_out);
+      if (g_filename_out != NULL && !sector_file_write(g_filename_out,
+          g_iso_options.sector_format, g_iso_options.lba, g_ip_data,
+          INITIAL_PROGRAM_SIZE)) {
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    if (g_filename_out != NULL) {
+      log_notice("bootstrap successfully written to \"%s\"\n", g_filename_out);
+    }
+
+    // the boot executable may have to be stored in the disc images
+    if (g_scramble_mode != SCRAMBLE_NONE && !scramble_boot_file(overwrite)) {
+      exit(EXIT_FAILURE);
+    }
 
-    log_notice("bootstrap successfully written to \"%s\"\n", g_filename_out);
+    if (!write_images(overwrite)) {
+      exit(EXIT_FAILURE);
+    }
+
+    if (g_depfile && !write_depfile()) {
+      exit(EXIT_FAILURE);
+    }
+
+    if (g_watch) {
+      return finish(watch_inputs() ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
 	
   } else {
     log_notice("entering in MR image conversion only mode\n");
 	
     // check if the output MR logo is writable
-    if (!overwrite && is_file_exist(g_filename_image_out)) {
+    if (!overwrite && !is_stdio(g_filename_image_out) &&
+        is_file_exist(g_filename_image_out)) {
       halt("output MR file \"%s\" already exist\n", g_filename_image_out);
     }
 	
@@ -315,5 +1316,5 @@ main(int argc, char *argv[])
 	mr_export(g_filename_image_in, g_filename_image_out);
   }
 
-  return EXIT_SUCCESS;
+  return finish(EXIT_SUCCESS);
 }
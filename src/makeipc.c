@@ -0,0 +1,333 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* makeipc: client of the makeip server mode (see server.h)
+ *
+ * Sends the fields, template and logo given on the command line to a running
+ * "makeip --server <socket>" and stores the generated bootstrap, without the
+ * start-up cost of makeip for each IP.BIN.
+ */
+
+#include <getopt.h>
+#include <limits.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "global.h"
+#include "utils.h"
+#include "output.h"
+#include "server.h"
+
+#define OPTIONS "a:b:c:d:e:fg:hi:l:L:n:p:S:t:T:vw"
+
+typedef struct client_field_t {
+  char option;
+  field_kind_t index;
+} client_field_t;
+
+static const client_field_t client_fields[] = {
+  { 'a', AREA_SYMBOLS },
+  { 'b', BOOT_FILENAME },
+  { 'c', SW_MAKER_NAME },
+  { 'd', RELEASE_DATE },
+  { 'e', VERSION },
+  { 'g', GAME_TITLE },
+  { 'i', DEVICE_INFO },
+  { 'n', PRODUCT_NO },
+  { 'p', PERIPHERALS },
+};
+
+void
+usage(void)
+{
+  printf("IP creator client (makeipc) v%s\n\n", MAKEIP_VERSION);
+  printf("Generates a bootstrap (i.e. IP.BIN) with a running \'makeip --server\'.\n\n");
+  printf("Usage:\n");
+  printf("\t%s -S <socket> [options] [ip_fields] <IP.BIN>\n\n", program_name_get());
+  printf("Options:\n");
+  printf("\t-f                 Force overwrite output file if already exist\n");
+  printf("\t-h                 Print usage information (you\'re looking at it)\n");
+  printf("\t-l <logo>          Logo file (MR; PNG) read by the server (cached)\n");
+  printf("\t-L <logo>          Logo file (MR; PNG) sent to the server (cached)\n");
+  printf("\t-S <socket>        Socket of the server\n");
+  printf("\t-t <tmplfilename>  IP.TMPL file read by the server (cached)\n");
+  printf("\t-T <tmplname>      Embedded IP.TMPL (default: server default)\n");
+  printf("\t-v                 Enable verbose mode\n");
+  printf("\t-w                 Let the server write <IP.BIN> (same file system)\n");
+  printf("\nIP fields (default: server defaults, see \'makeip -u\'):\n");
+  printf("\t-a -b -c -d -e -g -i -n -p\n");
+}
+
+static void
+client_record(buffer_t *request, int tag, const void *data, size_t size)
+{
+  unsigned char header[SERVER_RECORD_HEADER_SIZE];
+
+  server_put16(header, tag);
+  server_put32(header + 2, size);
+  buffer_append(request, header, sizeof(header));
+  buffer_append(request, data, size);
+}
+
+static void
+client_string(buffer_t *request, int tag, const char *value)
+{
+  client_record(request, tag, value, strlen(value));
+}
+
+// The server doesn't run in the directory of the client
+static void
+client_path(buffer_t *request, int tag, const char *path)
+{
+  char resolved[PATH_MAX];
+  char *copy, *directory;
+
+  if (realpath(path, resolved) != NULL) {
+    client_string(request, tag, resolved);
+    return;
+  }
+
+  // the output may not exist yet: its directory is resolved instead
+  copy = strdup(path);
+  directory = dirname(copy);
+  if (realpath(directory, resolved) == NULL) {
+    halt("can't resolve \"%s\": %s\n", path, strerror(errno));
+  }
+  free(copy);
+
+  copy = strdup(path);
+  strncat(resolved, "/", sizeof(resolved) - strlen(resolved) - 1);
+  strncat(resolved, basename(copy), sizeof(resolved) - strlen(resolved) - 1);
+  free(copy);
+
+  client_string(request, tag, resolved);
+}
+
+static void
+client_file(buffer_t *request, int tag, char *filename)
+{
+  mapped_file_t map;
+
+  if (!file_map(filename, FILE_MAP_READ, &map)) {
+    halt("can't open \"%s\"\n", filename);
+  }
+  client_record(request, tag, map.data, map.size);
+  file_unmap(&map);
+}
+
+static int
+client_connect(const char *path)
+{
+  struct sockaddr_un address;
+  int fd;
+
+  if (strlen(path) >= sizeof(address.sun_path)) {
+    halt("socket path \"%s\" is too long\n", path);
+  }
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, path);
+
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (struct sockaddr *) &address, sizeof(address))) {
+    halt("can't connect to \"%s\": %s\n", path, strerror(errno));
+  }
+
+  return fd;
+}
+
+// Halts on a failed read of the response, errno is 0 at the end of the stream
+static void
+client_read_error(void)
+{
+  if (errno) {
+    halt("can't read the response: %s\n", strerror(errno));
+  }
+  halt("connection closed by the server\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *socket_path = NULL, *output;
+  int c, overwrite = 0, server_write = 0, fd;
+  unsigned char header[SERVER_MESSAGE_HEADER_SIZE];
+  unsigned char *response;
+  uint32_t size, status = SERVER_STATUS_ERROR;
+  const unsigned char *data = NULL;
+  buffer_t request;
+
+  program_name_initialize(argv[0]);
+
+  // room for the length, set once the request is complete
+  memset(header, 0, sizeof(header));
+  buffer_init(&request);
+  buffer_append(&request, header, sizeof(header));
+
+  opterr = 0;
+  while ((c = getopt(argc, argv, OPTIONS)) != -1) {
+    int found = 0;
+
+    for (int i = 0; i < sizeof(client_fields) / sizeof(client_field_t); i++) {
+      if (client_fields[i].option == c) {
+        client_string(&request, SERVER_TAG_FIELD + client_fields[i].index, optarg);
+        found = 1;
+      }
+    }
+    if (found) {
+      continue;
+    }
+
+    switch (c) {
+      case 'f':
+        overwrite = 1;
+        break;
+      case 'h':
+        usage();
+        exit(EXIT_SUCCESS);
+      case 'l':
+        client_path(&request, SERVER_TAG_LOGO_FILE, optarg);
+        break;
+      case 'L':
+        client_file(&request, SERVER_TAG_LOGO, optarg);
+        break;
+      case 'S':
+        socket_path = optarg;
+        break;
+      case 't':
+        client_path(&request, SERVER_TAG_TEMPLATE_FILE, optarg);
+        break;
+      case 'T':
+        client_string(&request, SERVER_TAG_TEMPLATE, optarg);
+        break;
+      case 'v':
+        verbose_enable();
+        break;
+      case 'w':
+        server_write = 1;
+        break;
+      default:
+        if (optopt && strchr(OPTIONS, optopt) != NULL) {
+          halt("option \"-%c\" requires an argument\n", optopt);
+        }
+        halt("unknown option \"%s\"\n", argv[optind - 1]);
+    }
+  }
+
+  if (socket_path == NULL) {
+    halt("no server socket given (see \"-S\")\n");
+  }
+  if (argc - optind != 1) {
+    usage();
+    exit(EXIT_FAILURE);
+  }
+
+  output = argv[optind];
+  if (!overwrite && is_file_exist(output)) {
+    halt("output bootstrap file \"%s\" already exist\n", output);
+  }
+  if (server_write) {
+    client_path(&request, SERVER_TAG_OUTPUT, output);
+  }
+
+  server_put32((unsigned char *) request.data, request.size - sizeof(header));
+
+  fd = client_connect(socket_path);
+  if (!file_write_full(fd, request.data, request.size)) {
+    halt("can't send the request: %s\n", strerror(errno));
+  }
+  buffer_free(&request);
+
+  errno = 0;
+  if (!file_read_full(fd, header, sizeof(header))) {
+    client_read_error();
+  }
+
+  size = server_get32(header);
+  if (size > SERVER_MESSAGE_MAX) {
+    halt("invalid response from the server\n");
+  }
+  response = (unsigned char *) malloc(size ? size : 1);
+  errno = 0;
+  if (!file_read_full(fd, response, size)) {
+    client_read_error();
+  }
+  close(fd);
+
+  for (uint32_t offset = 0; offset + SERVER_RECORD_HEADER_SIZE <= size; ) {
+    uint16_t tag = server_get16(response + offset);
+    uint32_t length = server_get32(response + offset + 2);
+    const unsigned char *value = response + offset + SERVER_RECORD_HEADER_SIZE;
+
+    offset += SERVER_RECORD_HEADER_SIZE;
+    if (length > size - offset) {
+      halt("invalid response from the server\n");
+    }
+    offset += length;
+
+    switch (tag) {
+      case SERVER_TAG_STATUS:
+        status = (length == 4) ? server_get32(value) : SERVER_STATUS_ERROR;
+        break;
+      case SERVER_TAG_MESSAGE:
+        log_error("%.*s\n", (int) length, value);
+        break;
+      case SERVER_TAG_DATA:
+        if (length == INITIAL_PROGRAM_SIZE) {
+          data = value;
+        }
+        break;
+    }
+  }
+
+  if (status == SERVER_STATUS_OK && !server_write) {
+    if (data == NULL) {
+      halt("no bootstrap in the response of the server\n");
+    }
+    // output_write() reports the error
+    output_overwrite_set(overwrite);
+    if (!output_write(output, data, INITIAL_PROGRAM_SIZE, 0)) {
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  if (status == SERVER_STATUS_OK) {
+    log_notice("bootstrap successfully written to \"%s\"\n", output);
+  }
+
+  free(response);
+  program_name_finalize();
+
+  return (status == SERVER_STATUS_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,176 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Bootstrap templates registry generator
+ *
+ * Builds the "iptmpl.h" header embedded in makeip from raw IP.TMPL files.
+ * Each template is stored compressed with zlib along with its index entry
+ * (name, CRC-32 of the uncompressed data and bounds of the MR logo slot).
+ *
+ * Usage: mktmpl <name>=<IP.TMPL> [<name>=<IP.TMPL> ...] > iptmpl.h
+ * The first template passed is the default one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zlib.h>
+
+#include "global.h"
+#include "mr.h"
+
+#define BYTES_PER_LINE 12
+
+typedef struct template_t {
+  char *name;
+  char *filename;
+  unsigned char data[INITIAL_PROGRAM_SIZE];
+  unsigned char *compressed;
+  uLongf compressed_size;
+  uLong crc;
+} template_t;
+
+static int
+template_read(template_t *t)
+{
+  FILE *fh = fopen(t->filename, "rb");
+
+  if (fh == NULL) {
+    fprintf(stderr, "mktmpl: can't open \"%s\"\n", t->filename);
+    return 0;
+  }
+
+  int result = fread(t->data, 1, INITIAL_PROGRAM_SIZE, fh) == INITIAL_PROGRAM_SIZE
+    && fgetc(fh) == EOF;
+
+  fclose(fh);
+
+  if (!result) {
+    fprintf(stderr, "mktmpl: \"%s\" is not a %d bytes template\n", t->filename,
+      INITIAL_PROGRAM_SIZE);
+  }
+
+  return result;
+}
+
+static void
+template_analyze(template_t *t)
+{
+  t->crc = crc32(crc32(0L, Z_NULL, 0), t->data, INITIAL_PROGRAM_SIZE);
+}
+
+static int
+template_compress(template_t *t)
+{
+  t->compressed_size = compressBound(INITIAL_PROGRAM_SIZE);
+  t->compressed = (unsigned char *) malloc(t->compressed_size);
+
+  return compress2(t->compressed, &t->compressed_size, t->data,
+    INITIAL_PROGRAM_SIZE, Z_BEST_COMPRESSION) == Z_OK;
+}
+
+static void
+template_dump(template_t *t, int index)
+{
+  printf("/* %s (%s) */\n", t->name, t->filename);
+  printf("static const unsigned char ip_template_data_%d[%lu] = {", index,
+    (unsigned long) t->compressed_size);
+
+  for (uLongf i = 0; i < t->compressed_size; i++) {
+    if (i % BYTES_PER_LINE == 0) {
+      printf("\n ");
+    }
+    printf(" 0x%02x%s", t->compressed[i], (i + 1 < t->compressed_size) ? "," : "");
+  }
+
+  printf("\n};\n\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int count = argc - 1;
+
+  if (count < 1) {
+    fprintf(stderr, "usage: mktmpl <name>=<IP.TMPL> [<name>=<IP.TMPL> ...]\n");
+    return EXIT_FAILURE;
+  }
+
+  template_t *templates = (template_t *) calloc(count, sizeof(template_t));
+
+  for (int i = 0; i < count; i++) {
+    template_t *t = &templates[i];
+    char *sep = strchr(argv[i + 1], '=');
+
+    if (sep == NULL) {
+      fprintf(stderr, "mktmpl: missing template name in \"%s\"\n", argv[i + 1]);
+      return EXIT_FAILURE;
+    }
+
+    *sep = '\0';
+    t->name = argv[i + 1];
+    t->filename = sep + 1;
+
+    if (!template_read(t) || !template_compress(t)) {
+      return EXIT_FAILURE;
+    }
+    template_analyze(t);
+  }
+
+  printf("/* Generated by mktmpl, do not edit (see \"make templates\") */\n\n");
+  printf("#ifndef __IPTMPL_H__\n#define __IPTMPL_H__\n\n");
+  printf("#include \"ip.h\"\n\n");
+
+  for (int i = 0; i < count; i++) {
+    template_dump(&templates[i], i);
+  }
+
+  printf("#define IP_TEMPLATE_COUNT %d\n\n", count);
+  printf("/* Default template is the first entry */\n");
+  printf("static const ip_template_entry_t ip_templates[IP_TEMPLATE_COUNT] = {\n");
+  for (int i = 0; i < count; i++) {
+    template_t *t = &templates[i];
+    printf("  { \"%s\", 0x%08lxUL, %lu, ip_template_data_%d },\n",
+      t->name, (unsigned long) t->crc, (unsigned long) t->compressed_size, i);
+  }
+  printf("};\n\n");
+  printf("#endif /* __IPTMPL_H__ */\n");
+
+  for (int i = 0; i < count; i++) {
+    free(templates[i].compressed);
+  }
+  free(templates);
+
+  return EXIT_SUCCESS;
+}
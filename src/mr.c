@@ -33,10 +33,11 @@
 
 #include "mr.h"
 
-#define MR_MAX_SIZE 8192
-#define MR_MAX_PALETTE_COLORS 128
+#include "output.h"
+#include "pngload.h"
+#include "stats.h"
+#include "trace.h"
 
-#define MR_OFFSET 0x3820
 
 typedef struct image_t {
   unsigned int size;
@@ -65,17 +66,108 @@ typedef struct mr_t {
   char *data;
 } mr_t;
 
-typedef struct mr_output_t {
-  unsigned int size;
-  unsigned char *data;
-} mr_output_t;
-
 char *
 mr_get_friendly_supported_format(void)
 {
   return MR_FRIENDLY_SUPPORTED_FORMAT;
 }
 
+static unsigned int
+read_le32(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int) p[3] << 24);
+}
+
+// Decodes the compressed pixels (palette indexes) of a parsed MR image;
+// pixels may be NULL to only check the data stream
+int
+mr_decode(const unsigned char *data, mr_info_t *info, unsigned char *pixels)
+{
+  const unsigned char *p = data + info->offset;
+  const unsigned char *end = data + info->size;
+  unsigned int total = info->width * info->height;
+  unsigned int position = 0;
+
+  // encoders usually emit some extra bytes after the last pixel, so the
+  // stream is only decoded until the image is complete
+  while (p < end && position < total) {
+    unsigned int run;
+    unsigned char value;
+
+    if (*p < 0x80) {
+      run = 1;
+      value = *p++;
+    } else if (*p == 0x81) {
+      if (end - p < 3) {
+        return 0;
+      }
+      run = p[1];
+      value = p[2];
+      p += 3;
+    } else if (*p == 0x82 && end - p > 1 && p[1] >= 0x80) {
+      if (end - p < 3) {
+        return 0;
+      }
+      run = (p[1] & 0x7f) + 0x100;
+      value = p[2];
+      p += 3;
+    } else {
+      if (end - p < 2) {
+        return 0;
+      }
+      run = *p & 0x7f;
+      value = p[1];
+      p += 2;
+    }
+
+    if (value >= info->colors) {
+      return 0;
+    }
+
+    for (unsigned int i = 0; i < run && position < total; i++, position++) {
+      if (pixels != NULL) {
+        pixels[position] = value;
+      }
+    }
+  }
+
+  return position == total;
+}
+
+// Checks the structure of a MR image stored in a buffer of avail bytes
+int
+mr_parse(const unsigned char *data, size_t avail, mr_info_t *info,
+  const char **error)
+{
+  *error = NULL;
+
+  if (avail < MR_HEADER_SIZE || memcmp(data, "MR", 2)) {
+    *error = "bad MR signature";
+  } else {
+    info->size = read_le32(data + 2);
+    info->offset = read_le32(data + 10);
+    info->width = read_le32(data + 14);
+    info->height = read_le32(data + 18);
+    info->colors = read_le32(data + 26);
+
+    if (info->size > avail || info->size < MR_HEADER_SIZE) {
+      *error = "MR size out of bounds";
+    } else if (!info->colors || info->colors > MR_MAX_PALETTE_COLORS) {
+      *error = "invalid MR palette size";
+    } else if (info->offset != MR_HEADER_SIZE + info->colors * 4 ||
+               info->offset > info->size) {
+      *error = "invalid MR data offset";
+    } else if (!info->width || !info->height ||
+               info->width > MR_MAX_WIDTH || info->height > MR_MAX_HEIGHT) {
+      *error = "invalid MR dimensions";
+    } else if (!mr_decode(data, info, NULL)) {
+      *error = "corrupted MR data";
+    }
+  }
+
+  return *error == NULL;
+}
+
 int
 mr_compress(char *in, char *out, int size)
 {
@@ -127,9 +219,12 @@ mr_convert_raw(image_t *image, mr_output_t *output)
   palette.count = 0;
 
   uncompressed_size = image->width * image->height;
+  stats_add(STATS_PIXELS, uncompressed_size);
 
   data = (int *)image->data;
 
+  uint64_t start = stats_start();
+
   raw_output = (char *)malloc(uncompressed_size);
   compressed_output = (char *)malloc(uncompressed_size);
 
@@ -147,6 +242,8 @@ mr_convert_raw(image_t *image, mr_output_t *output)
 
     if ((!found) && (c == MR_MAX_PALETTE_COLORS)) {
       log_error("reduce the number of colors to <= %d and try again\n", MR_MAX_PALETTE_COLORS);
+      free(raw_output);
+      free(compressed_output);
       return 0;
 	}
 
@@ -158,13 +255,19 @@ mr_convert_raw(image_t *image, mr_output_t *output)
     raw_output[i] = c;
   }
 
+  stats_stop(STATS_PALETTE, start);
+  stats_add(STATS_COLORS, palette.count);
+
   log_notice("found %d colors\n", palette.count);
 
   mr.width = image->width;
   mr.height = image->height;
   mr.colors = palette.count;
 
+  start = stats_start();
   compressed_size = mr_compress(raw_output, compressed_output, uncompressed_size);
+  stats_stop(STATS_MR_COMPRESS, start);
+  stats_add(STATS_COMPRESSED_BYTES, compressed_size);
 
   log_notice("compressed %d bytes to %d bytes\n", uncompressed_size, compressed_size);
 
@@ -237,8 +340,8 @@ mr_read(char *file_name, mr_output_t *output)
   return result;
 }
 
-int
-png_read(char *file_name, mr_output_t *output)
+static int
+png_read_stream(FILE *fp, mr_output_t *output)
 {
    image_t pngimg;
    png_structp png_ptr;
@@ -246,102 +349,213 @@ png_read(char *file_name, mr_output_t *output)
    unsigned int sig_read = 0;
    png_uint_32 width, height, row;
    int bit_depth, color_type, interlace_type;
-   FILE *fp;
    png_color_16 *image_background;
+   // freed when libpng jumps back on error
+   png_bytep *volatile row_pointers = NULL;
+   uint64_t start = stats_start();
+   const pngload_t *png = pngload_get();
 
-   if ((fp = fopen(file_name, "rb")) == NULL)
+   if (png == NULL) {
      return 0;
+   }
 
-   png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING,
+   png_ptr = png->create_read_struct(PNG_LIBPNG_VER_STRING,
       NULL, NULL, NULL);
 
    if (png_ptr == NULL) {
-     fclose(fp);
      return 0;
    }
 
-   info_ptr = png_create_info_struct(png_ptr);
+   info_ptr = png->create_info_struct(png_ptr);
    if (info_ptr == NULL) {
-     fclose(fp);
-     png_destroy_read_struct(&png_ptr, (png_infopp)NULL, (png_infopp)NULL);
+     png->destroy_read_struct(&png_ptr, (png_infopp)NULL, (png_infopp)NULL);
      return 0;
    }
 
-   if (setjmp(png_jmpbuf(png_ptr))) {
-     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
-     fclose(fp);
+   pngimg.data = NULL;
+
+   if (setjmp(PNGLOAD_JMPBUF(png, png_ptr))) {
+     png->destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
+     free(row_pointers);
+     free(pngimg.data);
      return 0;
    }
 
-   png_init_io(png_ptr, fp);
+   png->init_io(png_ptr, fp);
 
-   png_set_sig_bytes(png_ptr, sig_read);
+   png->set_sig_bytes(png_ptr, sig_read);
 
-   png_read_info(png_ptr, info_ptr);
+   png->read_info(png_ptr, info_ptr);
 
-   png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type,
+   png->get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type,
      &interlace_type, NULL, NULL);
 
+   // the image comes from the user or a client of the server: its size is
+   // checked before allocating anything from it
+   if (width < 1 || height < 1 || width > MR_MAX_WIDTH || height > MR_MAX_HEIGHT) {
+     log_error("PNG image is %ux%u, must be %dx%d or less\n", (unsigned int) width,
+       (unsigned int) height, MR_MAX_WIDTH, MR_MAX_HEIGHT);
+     png->destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
+     return 0;
+   }
+
    pngimg.width = width;
    pngimg.height = height;
 
-   pngimg.data = (unsigned char *) malloc(width*height*4);
+   pngimg.data = (unsigned char *) malloc((size_t) width * height * 4);
 
    // Tell libpng to strip 16 bit/color files down to 8 bits/color
-   png_set_strip_16(png_ptr);
+   png->set_strip_16(png_ptr);
 
    // Extract multiple pixels with bit depths of 1, 2, and 4 from a single byte
    // into separate bytes (useful for paletted and grayscale images).
-   png_set_packing(png_ptr);
+   png->set_packing(png_ptr);
 
    // Expand paletted colors into true RGB triplets
    if (color_type == PNG_COLOR_TYPE_PALETTE)
-      png_set_expand(png_ptr);
+      png->set_expand(png_ptr);
 
    // Expand grayscale images to the full 8 bits from 1, 2, or 4 bits/pixel
    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
-      png_set_expand(png_ptr);
+      png->set_expand(png_ptr);
 
    // Expand paletted or RGB images with transparency to full alpha channels so
    // the data will be available as RGBA quartets.
-   if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
-      png_set_expand(png_ptr);
+   if (png->get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
+      png->set_expand(png_ptr);
 
-   if (png_get_bKGD(png_ptr, info_ptr, &image_background))
-      png_set_background(png_ptr, image_background,
+   if (png->get_bKGD(png_ptr, info_ptr, &image_background))
+      png->set_background(png_ptr, image_background,
                          PNG_BACKGROUND_GAMMA_FILE, 1, 1.0);
 
    // Add filler (or alpha) byte (before/after each RGB triplet)
-   png_set_filler(png_ptr, 0xff, PNG_FILLER_AFTER);
+   png->set_filler(png_ptr, 0xff, PNG_FILLER_AFTER);
 
-   png_read_update_info(png_ptr, info_ptr);
+   png->read_update_info(png_ptr, info_ptr);
 
-   {
-     png_bytep row_pointers[height];
+   row_pointers = (png_bytep *) malloc(height * sizeof(png_bytep));
 
-     for (row = 0; row < height; row++)
-	   row_pointers[row] = pngimg.data + pngimg.width * 4 * row;
+   for (row = 0; row < height; row++)
+     row_pointers[row] = pngimg.data + pngimg.width * 4 * row;
 
-     png_read_image(png_ptr, row_pointers);
-   }
+   png->read_image(png_ptr, row_pointers);
+
+   free(row_pointers);
+   row_pointers = NULL;
 
-   png_read_end(png_ptr, info_ptr);
+   png->read_end(png_ptr, info_ptr);
 
-   png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
+   png->destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
 
-   fclose(fp);
+   stats_stop(STATS_PNG_DECODE, start);
 
+   start = trace_start();
    int result = mr_convert_raw(&pngimg, output);
+   trace_stop("mr_convert_raw", start);
 
    free(pngimg.data);
 
    return result;
 }
 
+int
+png_read(char *file_name, mr_output_t *output)
+{
+  FILE *fp = fopen(file_name, "rb");
+
+  if (fp == NULL) {
+    return 0;
+  }
+
+  int result = png_read_stream(fp, output);
+
+  fclose(fp);
+
+  return result;
+}
+
+static void
+mr_png_write_data(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+  buffer_append((buffer_t *) pngload_get()->get_io_ptr(png_ptr), data, length);
+}
+
+static void
+mr_png_flush(png_structp png_ptr)
+{
+}
+
+// Writes a parsed MR image to a paletted PNG file: encoded in memory, then
+// written by output_write() with the flags given
+int
+mr_png_write(const unsigned char *data, mr_info_t *info, const char *file_name,
+  int flags)
+{
+  png_structp png_ptr;
+  png_infop info_ptr;
+  png_color palette[MR_MAX_PALETTE_COLORS];
+  png_bytep row_pointers[MR_MAX_HEIGHT];
+  unsigned char *pixels;
+  buffer_t encoded;
+  int result;
+  const pngload_t *png = pngload_get();
+
+  if (png == NULL) {
+    return 0;
+  }
+
+  pixels = (unsigned char *) malloc(info->width * info->height);
+  if (!mr_decode(data, info, pixels)) {
+    free(pixels);
+    return 0;
+  }
+
+  // the MR palette is stored as BGRx quartets
+  for (unsigned int i = 0; i < info->colors; i++) {
+    const unsigned char *color = data + MR_HEADER_SIZE + i * 4;
+    palette[i].blue = color[0];
+    palette[i].green = color[1];
+    palette[i].red = color[2];
+  }
+
+  for (unsigned int row = 0; row < info->height; row++) {
+    row_pointers[row] = pixels + info->width * row;
+  }
+
+  buffer_init(&encoded);
+
+  png_ptr = png->create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+  info_ptr = (png_ptr != NULL) ? png->create_info_struct(png_ptr) : NULL;
+
+  if (info_ptr == NULL || setjmp(PNGLOAD_JMPBUF(png, png_ptr))) {
+    png->destroy_write_struct(&png_ptr, &info_ptr);
+    buffer_free(&encoded);
+    free(pixels);
+    return 0;
+  }
+
+  png->set_write_fn(png_ptr, &encoded, mr_png_write_data, mr_png_flush);
+  png->set_IHDR(png_ptr, info_ptr, info->width, info->height, 8,
+    PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+    PNG_FILTER_TYPE_DEFAULT);
+  png->set_PLTE(png_ptr, info_ptr, palette, info->colors);
+  png->write_info(png_ptr, info_ptr);
+  png->write_image(png_ptr, row_pointers);
+  png->write_end(png_ptr, info_ptr);
+
+  png->destroy_write_struct(&png_ptr, &info_ptr);
+  free(pixels);
+
+  result = output_write(file_name, encoded.data, encoded.size, flags);
+  buffer_free(&encoded);
+
+  return result;
+}
+
 void
 mr_init(mr_output_t *output)
 {
-  memset(&output, 0, sizeof(output));
+  memset(output, 0, sizeof(mr_output_t));
 }
 
 void
@@ -356,54 +570,101 @@ mr_destroy(mr_output_t *output)
 void
 mr_dump(mr_output_t *output, char *outfn)
 {
-  FILE *mr = fopen(outfn, "wb");
-
-  if (mr == NULL) {
-    log_error("can't open MR file \"%s\"\n", outfn);
-    return;
-  }
-
-  if (!fwrite(output->data, output->size, 1, mr)) {
+  if (!output_write(outfn, output->data, output->size, 0)) {
     log_error("unable to write MR file\n");
   } else {
     log_notice("successfully dumped MR data to \"%s\"\n", outfn);
   }
-
-  fclose(mr);
 }
 
-void
-mr_load(char *fn_imgin, mr_output_t *output)
+// Loads a logo file (MR or PNG), returns 0 on error
+int
+mr_load_file(char *fn_imgin, mr_output_t *output)
 {
-  file_type_t ftype = detect_file_type(fn_imgin);
-
   int result = 0;
 
-  switch(ftype) {
-    case MR:
-      log_notice("file \"%s\" format is MR\n", fn_imgin);
-	  result = mr_read(fn_imgin, output);
-      break;
-    case PNG:
-      log_notice("file \"%s\" is Portable Network Graphics (PNG)\n", fn_imgin);
-	  result = png_read(fn_imgin, output);
-      break;
-    case UNSUPPORTED:
-      halt("unsupported file format\n");
-      break;
-    case INVALID:
-      halt("invalid file\n");
+  if (is_stdio(fn_imgin)) {
+    // the logo is piped, its format is told by the data
+    buffer_t buf;
+    buffer_init(&buf);
+    if (!file_read_stream(STDIN_FILENO, &buf)) {
+      log_error("can't read logo from the standard input: %s\n", strerror(errno));
+    } else {
+      result = mr_load_data((unsigned char *) buf.data, buf.size, output);
+    }
+    buffer_free(&buf);
+  } else {
+    switch(detect_file_type(fn_imgin)) {
+      case MR:
+        log_notice("file \"%s\" format is MR\n", fn_imgin);
+        result = mr_read(fn_imgin, output);
+        break;
+      case PNG:
+        log_notice("file \"%s\" is Portable Network Graphics (PNG)\n", fn_imgin);
+        result = png_read(fn_imgin, output);
+        break;
+      case UNSUPPORTED:
+        log_error("unsupported file format\n");
+        return 0;
+      case INVALID:
+        log_error("invalid file\n");
+        return 0;
+    }
   }
 
-  if (result) {
+  if (!result) {
+    log_error("unable to process logo from \"%s\"\n", fn_imgin);
+  } else if (output->size < 1) {
+    log_error("empty logo file\n");
+    result = 0;
+  } else {
     log_notice("successfully loaded logo from \"%s\"\n", fn_imgin);
     log_notice("MR total size is %d bytes\n", output->size);
+  }
+
+  return result;
+}
+
+// Loads a logo (MR or PNG) stored in memory, returns 0 on error
+int
+mr_load_data(const unsigned char *data, size_t size, mr_output_t *output)
+{
+  int result = 0;
+
+  if (size >= 2 && !memcmp(data, "MR", 2)) {
+    const char *error;
+    mr_info_t info;
+
+    if (!mr_parse(data, size, &info, &error)) {
+      log_error("invalid MR logo: %s\n", error);
+    } else {
+      output->size = info.size;
+      output->data = (unsigned char *) malloc(info.size);
+      memcpy(output->data, data, info.size);
+      result = 1;
+    }
+  } else if (size >= 4 && !memcmp(data + 1, "PNG", 3)) {
+    FILE *fp = fmemopen((void *) data, size, "rb");
+
+    if (fp != NULL) {
+      result = png_read_stream(fp, output);
+      fclose(fp);
+    }
+    if (!result) {
+      log_error("unable to process PNG logo\n");
+    }
   } else {
-    halt("unable to process logo from \"%s\"\n", fn_imgin);
+    log_error("unsupported logo format\n");
   }
 
-  if (output->size < 1) {
-    halt("empty logo file\n");
+  return result;
+}
+
+void
+mr_load(char *fn_imgin, mr_output_t *output)
+{
+  if (!mr_load_file(fn_imgin, output)) {
+    exit(EXIT_FAILURE);
   }
 
   if (output->size > MR_MAX_SIZE) {
@@ -424,6 +685,14 @@ mr_export(char *fn_imgin, char *fn_imgout)
   mr_destroy(&output);
 }
 
+void
+mr_write(char *ip, mr_output_t *output)
+{
+  memcpy(ip + MR_OFFSET, output->data, output->size);
+
+  log_notice("successfully inserted logo in bootstrap\n");
+}
+
 void
 mr_inject(char *ip, char *fn_imgin, char *fn_imgout)
 {
@@ -432,10 +701,7 @@ mr_inject(char *ip, char *fn_imgin, char *fn_imgout)
   mr_init(&output);
 
   mr_load(fn_imgin, &output);
-
-  memcpy(ip + MR_OFFSET, output.data, output.size);
-
-  log_notice("successfully inserted logo in bootstrap\n");
+  mr_write(ip, &output);
 
   if (fn_imgout != NULL) {
     mr_dump(&output, fn_imgout);
@@ -40,9 +40,45 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include <png.h>
+#define MR_MAX_SIZE 8192
+
+#define MR_OFFSET 0x3820
+
+#define MR_HEADER_SIZE 30
+#define MR_MAX_WIDTH 320
+#define MR_MAX_HEIGHT 90
+#define MR_MAX_PALETTE_COLORS 128
+
+typedef struct mr_output_t {
+  unsigned int size;
+  unsigned char *data;
+} mr_output_t;
+
+typedef struct mr_info_t {
+  unsigned int size;
+  unsigned int offset;
+  unsigned int width;
+  unsigned int height;
+  unsigned int colors;
+} mr_info_t;
 
 char * mr_get_friendly_supported_format(void);
+
+int mr_parse(const unsigned char *data, size_t avail, mr_info_t *info,
+  const char **error);
+int mr_decode(const unsigned char *data, mr_info_t *info, unsigned char *pixels);
+int mr_png_write(const unsigned char *data, mr_info_t *info, const char *file_name,
+  int flags);
+
+void mr_init(mr_output_t *output);
+void mr_load(char *fn_imgin, mr_output_t *output);
+int mr_load_file(char *fn_imgin, mr_output_t *output);
+int mr_load_data(const unsigned char *data, size_t size, mr_output_t *output);
+void mr_dump(mr_output_t *output, char *outfn);
+void mr_destroy(mr_output_t *output);
+
+void mr_write(char *ip, mr_output_t *output);
+
 void mr_export(char *fn_imgin, char *fn_imgout);
 void mr_inject(char *ip, char *fn_imgin, char *fn_imgout);
 
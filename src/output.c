@@ -0,0 +1,467 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// renameat2() and syncfs()
+#define _GNU_SOURCE
+
+#include <pthread.h>
+
+#include "output.h"
+#include "stats.h"
+
+static output_sync_t g_output_sync = OUTPUT_SYNC_NONE;
+
+// existing outputs are replaced by default (e.g. '-f' of makeip)
+static int g_output_overwrite = 1;
+
+// permissions of new files (umask isn't read from threads)
+static mode_t g_output_mode;
+static pthread_once_t g_output_mode_once = PTHREAD_ONCE_INIT;
+
+// file systems holding the outputs of the batch (OUTPUT_SYNC_BATCH)
+static pthread_mutex_t g_output_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_output_filesystems[OUTPUT_MAX_FILESYSTEMS];
+static dev_t g_output_devices[OUTPUT_MAX_FILESYSTEMS];
+static int g_output_filesystem_count = 0;
+
+static void
+output_mode_initialize(void)
+{
+  mode_t mask = umask(0);
+  umask(mask);
+  g_output_mode = 0666 & ~mask;
+}
+
+static char *
+output_directory(const char *filename)
+{
+  char *separator = strrchr(filename, '/');
+  size_t length = (separator != NULL) ? separator - filename + 1 : 0;
+  char *directory;
+
+  if (!length) {
+    return strdup(".");
+  }
+
+  directory = (char *) malloc(length + 1);
+  memcpy(directory, filename, length);
+  directory[length] = '\0';
+
+  return directory;
+}
+
+// Remembers the file system of fd, synced once by output_flush()
+static int
+output_batch_add(int fd)
+{
+  struct stat stats;
+  int result = 1, known = 0;
+
+  if (fstat(fd, &stats)) {
+    return 0;
+  }
+
+  pthread_mutex_lock(&g_output_lock);
+  for (int i = 0; i < g_output_filesystem_count; i++) {
+    known = known || g_output_devices[i] == stats.st_dev;
+  }
+  if (!known) {
+    if (g_output_filesystem_count == OUTPUT_MAX_FILESYSTEMS) {
+      // too many file systems, this one is synced right now
+      result = !fsync(fd);
+    } else {
+      int copy = dup(fd);
+      if (copy == -1) {
+        result = !fsync(fd);
+      } else {
+        g_output_filesystems[g_output_filesystem_count] = copy;
+        g_output_devices[g_output_filesystem_count++] = stats.st_dev;
+      }
+    }
+  }
+  pthread_mutex_unlock(&g_output_lock);
+
+  return result;
+}
+
+static int
+output_syncfs(int fd)
+{
+#ifdef __linux__
+  return !syncfs(fd);
+#else
+  // no way to sync a single file system
+  sync();
+  return 1;
+#endif
+}
+
+static int
+output_rename(const char *from, const char *to, int replace)
+{
+  if (replace) {
+    return rename(from, to);
+  }
+
+#ifdef RENAME_NOREPLACE
+  if (!renameat2(AT_FDCWD, from, AT_FDCWD, to, RENAME_NOREPLACE)) {
+    return 0;
+  }
+  if (errno != EINVAL && errno != ENOSYS) {
+    return -1;
+  }
+#endif
+
+  // no renameat2() (e.g. on some file systems): link() doesn't replace
+  // an existing file either
+  if (link(from, to)) {
+    return -1;
+  }
+  unlink(from);
+
+  return 0;
+}
+
+// Checks if a file already holds the given data (it may then be left
+// untouched, so its date doesn't trigger the rebuild of what depends on it)
+static int
+output_unchanged(const char *filename, const void *data, size_t size)
+{
+  struct stat stats;
+  int result = 0;
+  int fd = open(filename, O_RDONLY);
+
+  if (fd == -1) {
+    return 0;
+  }
+
+  if (!fstat(fd, &stats) && S_ISREG(stats.st_mode) && stats.st_size == size) {
+    if (!size) {
+      result = 1;
+    } else {
+      void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED) {
+        result = !memcmp(map, data, size);
+        munmap(map, size);
+      }
+    }
+  }
+
+  close(fd);
+
+  return result;
+}
+
+static void
+output_make_escape(buffer_t *buf, const char *path)
+{
+  for (const char *p = path; *p; p++) {
+    switch (*p) {
+      case ' ':
+      case '#':
+        buffer_append(buf, "\\", 1);
+        buffer_append(buf, p, 1);
+        break;
+      case '$':
+        buffer_append(buf, "$$", 2);
+        break;
+      default:
+        buffer_append(buf, p, 1);
+    }
+  }
+}
+
+/* Public interface */
+
+int
+output_sync_parse(const char *str, output_sync_t *policy)
+{
+  static const char *names[] = { "none", "file", "batch" };
+
+  for (int i = 0; i < sizeof(names) / sizeof(char *); i++) {
+    if (!strcmp(str, names[i])) {
+      *policy = (output_sync_t) i;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+void
+output_sync_set(output_sync_t policy)
+{
+  g_output_sync = policy;
+}
+
+void
+output_overwrite_set(int overwrite)
+{
+  g_output_overwrite = overwrite;
+}
+
+// Starts writing an output: the data goes to a temporary file of the same
+// directory which replaces the output in output_commit(), so readers (or a
+// crash) never see a partially written file
+int
+output_open(output_file_t *file, const char *filename, int flags)
+{
+  char *separator = strrchr(filename, '/');
+  size_t length = (separator != NULL) ? separator - filename + 1 : 0;
+  struct stat stats;
+  mode_t mode;
+
+  // streamed outputs need a file to be replaced (see output_write())
+  if (is_stdio(filename)) {
+    log_error("this output can't be written to the standard output\n");
+    return 0;
+  }
+
+  pthread_once(&g_output_mode_once, output_mode_initialize);
+
+  file->filename = filename;
+  file->flags = flags;
+  file->temp = (char *) malloc(length + strlen(filename + length) + 9);
+  memcpy(file->temp, filename, length);
+  sprintf(file->temp + length, ".%s.XXXXXX", filename + length);
+
+  file->fd = mkstemp(file->temp);
+  if (file->fd == -1) {
+    log_error("can't create temporary file for \"%s\": %s\n", filename, strerror(errno));
+    free(file->temp);
+    file->temp = NULL;
+    return 0;
+  }
+
+  // mkstemp() creates private files, the output keeps its own permissions
+  mode = stat(filename, &stats) ? g_output_mode : (stats.st_mode & 07777);
+  fchmod(file->fd, mode);
+
+  return 1;
+}
+
+static int
+output_close(output_file_t *file)
+{
+  int replace = !(file->flags & OUTPUT_KEEP) &&
+    (g_output_overwrite || (file->flags & OUTPUT_REPLACE));
+  int result = 1;
+
+  switch (g_output_sync) {
+    case OUTPUT_SYNC_FILE:
+      result = !fdatasync(file->fd);
+      break;
+    case OUTPUT_SYNC_BATCH:
+      result = output_batch_add(file->fd);
+      break;
+    default:
+      break;
+  }
+
+  if (close(file->fd)) {
+    result = 0;
+  }
+  file->fd = -1;
+
+  if (!result) {
+    log_error("output write error on \"%s\": %s\n", file->filename, strerror(errno));
+  } else if (output_rename(file->temp, file->filename, replace)) {
+    if (errno == EEXIST) {
+      if (!(file->flags & OUTPUT_KEEP)) {
+        log_error("output file \"%s\" already exist\n", file->filename);
+      }
+    } else {
+      log_error("can't replace \"%s\": %s\n", file->filename, strerror(errno));
+    }
+    result = 0;
+  }
+
+  // the new directory entry must be durable too
+  if (result && g_output_sync == OUTPUT_SYNC_FILE) {
+    char *directory = output_directory(file->filename);
+    int fd = open(directory, O_RDONLY);
+    if (fd != -1) {
+      fsync(fd);
+      close(fd);
+    }
+    free(directory);
+  }
+
+  if (!result) {
+    unlink(file->temp);
+  }
+  free(file->temp);
+  file->temp = NULL;
+
+  return result;
+}
+
+// Completes an output (see output_open()); the file is closed
+int
+output_commit(output_file_t *file)
+{
+  uint64_t start = stats_start();
+  int result = output_close(file);
+  stats_stop(STATS_OUTPUT, start);
+
+  return result;
+}
+
+// Drops an output (see output_open()), the existing file is kept
+void
+output_abort(output_file_t *file)
+{
+  if (file->fd != -1) {
+    close(file->fd);
+    file->fd = -1;
+  }
+  if (file->temp != NULL) {
+    unlink(file->temp);
+    free(file->temp);
+    file->temp = NULL;
+  }
+}
+
+// Applies the sync policy to a file updated in place
+int
+output_sync_fd(int fd)
+{
+  switch (g_output_sync) {
+    case OUTPUT_SYNC_FILE:
+      return !fdatasync(fd);
+    case OUTPUT_SYNC_BATCH:
+      return output_batch_add(fd);
+    default:
+      return 1;
+  }
+}
+
+// Ends a batch: the file systems of its outputs are synced (once each)
+int
+output_flush(void)
+{
+  uint64_t start = stats_start();
+  int result = 1;
+
+  pthread_mutex_lock(&g_output_lock);
+  for (int i = 0; i < g_output_filesystem_count; i++) {
+    if (!output_syncfs(g_output_filesystems[i])) {
+      log_error("can't sync outputs: %s\n", strerror(errno));
+      result = 0;
+    }
+    close(g_output_filesystems[i]);
+  }
+  g_output_filesystem_count = 0;
+  pthread_mutex_unlock(&g_output_lock);
+
+  stats_stop(STATS_OUTPUT, start);
+
+  return result;
+}
+
+// Writes a whole output, unless it already holds that data
+static int
+output_write_data(const char *filename, const void *data, size_t size, int flags)
+{
+  output_file_t file;
+
+  // "-": the data is written as is, e.g. to the next process of a pipeline
+  if (is_stdio(filename)) {
+    if (!(flags & OUTPUT_TEXT) && isatty(STDOUT_FILENO)) {
+      log_error("refusing to write binary data to a terminal\n");
+      return 0;
+    }
+    if (!file_write_full(STDOUT_FILENO, data, size)) {
+      log_error("write error on the standard output: %s\n", strerror(errno));
+      return 0;
+    }
+    return 1;
+  }
+
+  if (output_unchanged(filename, data, size)) {
+    log_notice("\"%s\" is unchanged, not rewritten\n", filename);
+    return 1;
+  }
+
+  if (!output_open(&file, filename, flags)) {
+    return 0;
+  }
+
+  if (!file_write_full(file.fd, data, size)) {
+    log_error("output write error on \"%s\": %s\n", filename, strerror(errno));
+    output_abort(&file);
+    return 0;
+  }
+
+  return output_close(&file);
+}
+
+int
+output_write(const char *filename, const void *data, size_t size, int flags)
+{
+  uint64_t start = stats_start();
+  int result = output_write_data(filename, data, size, flags);
+  stats_stop(STATS_OUTPUT, start);
+
+  return result;
+}
+
+// Writes a make rule listing the files read to produce target (the NULL
+// inputs are skipped), like "gcc -MD" does
+int
+output_write_depfile(const char *filename, const char *target, char **inputs,
+  int count)
+{
+  buffer_t buf;
+  int result;
+
+  buffer_init(&buf);
+
+  output_make_escape(&buf, target);
+  buffer_append(&buf, ":", 1);
+  for (int i = 0; i < count; i++) {
+    // the standard input isn't a prerequisite make can check
+    if (inputs[i] != NULL && !is_stdio(inputs[i])) {
+      buffer_append(&buf, " ", 1);
+      output_make_escape(&buf, inputs[i]);
+    }
+  }
+  buffer_append(&buf, "\n", 1);
+
+  // like with gcc, the dependency file is always replaced
+  result = output_write(filename, buf.data, buf.size, OUTPUT_REPLACE);
+
+  buffer_free(&buf);
+
+  return result;
+}
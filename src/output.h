@@ -0,0 +1,84 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __OUTPUT_H__
+#define __OUTPUT_H__
+
+#include "global.h"
+
+#include "utils.h"
+
+// largest number of file systems synced at the end of a batch
+#define OUTPUT_MAX_FILESYSTEMS 16
+
+// output_open() flags: replace the output even without overwrite allowed
+// (i.e. files owned by makeip, like dependency files)
+#define OUTPUT_REPLACE (1 << 0)
+
+// never replace the output, even with overwrite allowed: an existing file
+// already holds the data (i.e. files named after their contents); the
+// output then fails with errno set to EEXIST, without an error message
+#define OUTPUT_KEEP (1 << 1)
+
+// the data is text, which may be written to a terminal (i.e. reports)
+#define OUTPUT_TEXT (1 << 2)
+
+typedef enum output_sync_t {
+  OUTPUT_SYNC_NONE = 0, // left to the system (default)
+  OUTPUT_SYNC_FILE,     // each file is synced before replacing the output
+  OUTPUT_SYNC_BATCH     // the file systems are synced once, by output_flush()
+} output_sync_t;
+
+// output being written, in a temporary file until output_commit()
+typedef struct output_file_t {
+  const char *filename;
+  char *temp;
+  int fd;
+  int flags;
+} output_file_t;
+
+int output_sync_parse(const char *str, output_sync_t *policy);
+void output_sync_set(output_sync_t policy);
+void output_overwrite_set(int overwrite);
+
+int output_open(output_file_t *file, const char *filename, int flags);
+int output_commit(output_file_t *file);
+void output_abort(output_file_t *file);
+int output_sync_fd(int fd);
+int output_flush(void);
+
+int output_write(const char *filename, const void *data, size_t size, int flags);
+int output_write_depfile(const char *filename, const char *target, char **inputs,
+  int count);
+
+#endif /* __OUTPUT_H__ */
@@ -0,0 +1,159 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "patch.h"
+
+#include "ip.h"
+#include "output.h"
+
+// changed areas closer than this are written in a single pwrite call
+#define PATCH_RANGE_GAP 16
+
+typedef struct patch_region_t {
+  int offset;
+  int size;
+} patch_region_t;
+
+static int
+patch_read(int fd, char *ip, patch_region_t *region)
+{
+  ssize_t result = pread(fd, ip + region->offset, region->size, region->offset);
+  return result == region->size;
+}
+
+static int
+patch_flush(int fd, char *ip, char *orig, patch_region_t *region, int *written)
+{
+  int end = region->offset + region->size;
+  int i = region->offset;
+
+  while (i < end) {
+    // skip unchanged bytes
+    while (i < end && ip[i] == orig[i]) {
+      i++;
+    }
+    if (i >= end) {
+      break;
+    }
+
+    // extend the changed range while the unchanged gaps are small
+    int start = i, last = i;
+    while (i < end && i - last <= PATCH_RANGE_GAP) {
+      if (ip[i] != orig[i]) {
+        last = i;
+      }
+      i++;
+    }
+
+    int size = last - start + 1;
+    if (pwrite(fd, ip + start, size, start) != size) {
+      return 0;
+    }
+    *written += size;
+  }
+
+  return 1;
+}
+
+int
+patch_file(char *fn_ip, mr_output_t *logo)
+{
+  struct stat stats;
+  char ip[INITIAL_PROGRAM_SIZE];
+  char orig[INITIAL_PROGRAM_SIZE];
+  patch_region_t regions[2] = {
+    { 0, IP_FIELDS_SIZE },
+    { MR_OFFSET, MR_MAX_SIZE }
+  };
+  int count = (logo != NULL) ? 2 : 1;
+  int result = 1, written = 0;
+
+  int fd = open(fn_ip, O_RDWR);
+  if (fd == -1) {
+    log_error("can't open bootstrap \"%s\": %s\n", fn_ip, strerror(errno));
+    return 0;
+  }
+
+  if (fstat(fd, &stats) == -1 || stats.st_size != INITIAL_PROGRAM_SIZE) {
+    log_error("\"%s\" is not a valid bootstrap (wrong file size)\n", fn_ip);
+    close(fd);
+    return 0;
+  }
+
+  // only the areas that may be modified are read from the file
+  for (int i = 0; i < count && result; i++) {
+    result = patch_read(fd, ip, &regions[i]);
+  }
+
+  if (!result) {
+    log_error("unable to read bootstrap \"%s\"\n", fn_ip);
+  } else if (memcmp(ip, IP_HARDWARE_ID, strlen(IP_HARDWARE_ID))) {
+    log_error("\"%s\" is not a valid bootstrap (bad hardware ID)\n", fn_ip);
+    result = 0;
+  }
+
+  if (result) {
+    for (int i = 0; i < count; i++) {
+      memcpy(orig + regions[i].offset, ip + regions[i].offset, regions[i].size);
+    }
+
+    // apply the fields passed by the user, keep the others untouched
+    for (int i = 0; i < NUM_FIELDS; i++) {
+      if (field_is_modified(i)) {
+        field_write_value(ip, i);
+      }
+    }
+
+    if (logo != NULL) {
+      memset(ip + MR_OFFSET, 0, MR_MAX_SIZE);
+      mr_write(ip, logo);
+    }
+
+    update_crc(ip);
+
+    for (int i = 0; i < count && result; i++) {
+      result = patch_flush(fd, ip, orig, &regions[i], &written);
+    }
+    result = result && output_sync_fd(fd);
+
+    if (!result) {
+      log_error("unable to write bootstrap \"%s\": %s\n", fn_ip, strerror(errno));
+    } else {
+      log_notice("patched \"%s\" (%d bytes written)\n", fn_ip, written);
+    }
+  }
+
+  close(fd);
+
+  return result;
+}
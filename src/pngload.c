@@ -0,0 +1,84 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dlfcn.h>
+#include <pthread.h>
+
+#include "pngload.h"
+
+// name of the library matching png.h, e.g. "libpng16.so.16"
+#define PNGLOAD_STRING(x) #x
+#define PNGLOAD_SONAME(major, minor, sonum) \
+  "libpng" PNGLOAD_STRING(major) PNGLOAD_STRING(minor) ".so." PNGLOAD_STRING(sonum)
+#define PNGLOAD_LIBRARY \
+  PNGLOAD_SONAME(PNG_LIBPNG_VER_MAJOR, PNG_LIBPNG_VER_MINOR, PNG_LIBPNG_VER_SONUM)
+
+static pngload_t g_pngload;
+static int g_pngload_loaded = 0;
+static pthread_once_t g_pngload_once = PTHREAD_ONCE_INIT;
+
+static void
+pngload_initialize(void)
+{
+  // most runs only handle fields or MR logos, they don't pay for libpng
+  void *library = dlopen(PNGLOAD_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+
+  if (library == NULL) {
+    log_error("can't load %s, PNG images are not supported: %s\n",
+      PNGLOAD_LIBRARY, dlerror());
+    return;
+  }
+
+#define PNGLOAD(name) \
+  if ((*(void **) &g_pngload.name = dlsym(library, "png_" #name)) == NULL) { \
+    log_error("can't find png_%s in %s\n", #name, PNGLOAD_LIBRARY); \
+    dlclose(library); \
+    return; \
+  }
+  PNGLOAD_FUNCTIONS
+#undef PNGLOAD
+
+  log_notice("loaded %s\n", PNGLOAD_LIBRARY);
+
+  g_pngload_loaded = 1;
+}
+
+// Loads libpng on first use; returns NULL (the error is reported) if the
+// library is missing
+const pngload_t *
+pngload_get(void)
+{
+  pthread_once(&g_pngload_once, pngload_initialize);
+
+  return g_pngload_loaded ? &g_pngload : NULL;
+}
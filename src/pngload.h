@@ -0,0 +1,88 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __PNGLOAD_H__
+#define __PNGLOAD_H__
+
+#include "global.h"
+
+#include <setjmp.h>
+
+#include <png.h>
+
+#include "utils.h"
+
+// libpng is only loaded when a PNG image is read or written (see pngload.c),
+// its functions are called through this table
+#define PNGLOAD_FUNCTIONS \
+  PNGLOAD(create_read_struct) \
+  PNGLOAD(create_write_struct) \
+  PNGLOAD(create_info_struct) \
+  PNGLOAD(destroy_read_struct) \
+  PNGLOAD(destroy_write_struct) \
+  PNGLOAD(set_longjmp_fn) \
+  PNGLOAD(init_io) \
+  PNGLOAD(set_write_fn) \
+  PNGLOAD(get_io_ptr) \
+  PNGLOAD(set_sig_bytes) \
+  PNGLOAD(read_info) \
+  PNGLOAD(read_update_info) \
+  PNGLOAD(read_image) \
+  PNGLOAD(read_end) \
+  PNGLOAD(get_IHDR) \
+  PNGLOAD(get_bKGD) \
+  PNGLOAD(get_valid) \
+  PNGLOAD(set_strip_16) \
+  PNGLOAD(set_packing) \
+  PNGLOAD(set_expand) \
+  PNGLOAD(set_background) \
+  PNGLOAD(set_filler) \
+  PNGLOAD(set_IHDR) \
+  PNGLOAD(set_PLTE) \
+  PNGLOAD(write_info) \
+  PNGLOAD(write_image) \
+  PNGLOAD(write_end)
+
+typedef struct pngload_t {
+#define PNGLOAD(name) __typeof__(png_##name) *name;
+  PNGLOAD_FUNCTIONS
+#undef PNGLOAD
+} pngload_t;
+
+// png_jmpbuf() of the loaded library
+#define PNGLOAD_JMPBUF(png, png_ptr) \
+  (*(png)->set_longjmp_fn((png_ptr), longjmp, sizeof(jmp_buf)))
+
+const pngload_t * pngload_get(void);
+
+#endif /* __PNGLOAD_H__ */
@@ -0,0 +1,111 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pool.h"
+
+// number of threads used by the pool (0 means one per online processor)
+int g_pool_threads = 0;
+
+typedef struct pool_t {
+  int count;
+  int next;
+  pool_job_t job;
+  void *context;
+} pool_t;
+
+void
+pool_threads_set(int count)
+{
+  g_pool_threads = count;
+}
+
+int
+pool_threads_get(void)
+{
+  if (g_pool_threads < 1) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    g_pool_threads = (online > 0) ? online : 1;
+  }
+  return g_pool_threads;
+}
+
+static void *
+pool_worker(void *arg)
+{
+  pool_t *pool = (pool_t *) arg;
+  int index;
+
+  // jobs are handed out one by one, so slow items don't stall a whole slice
+  while ((index = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->count) {
+    pool->job(index, pool->context);
+  }
+
+  return NULL;
+}
+
+void
+pool_run(int count, pool_job_t job, void *context)
+{
+  pool_t pool = { count, 0, job, context };
+  int threads = pool_threads_get();
+
+  if (threads > count) {
+    threads = count;
+  }
+
+  // the calling thread is one of the workers
+  pthread_t *workers = NULL;
+  int started = 0;
+
+  if (threads > 1) {
+    workers = (pthread_t *) malloc((threads - 1) * sizeof(pthread_t));
+    for (int i = 0; i < threads - 1; i++) {
+      if (pthread_create(&workers[i], NULL, pool_worker, &pool)) {
+        log_warn("unable to create worker thread, continuing with %d\n", started + 1);
+        break;
+      }
+      started++;
+    }
+  }
+
+  pool_worker(&pool);
+
+  for (int i = 0; i < started; i++) {
+    pthread_join(workers[i], NULL);
+  }
+
+  free(workers);
+
+  // the messages of the jobs come before what follows
+  log_flush();
+}
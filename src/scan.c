@@ -0,0 +1,283 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "scan.h"
+
+#include "ip.h"
+#include "mr.h"
+#include "pool.h"
+
+// signature searched for: the Hardware ID field, at the start of IP.BIN
+#define SCAN_SIGNATURE IP_HARDWARE_ID
+#define SCAN_SIGNATURE_SIZE 16
+
+#define SCAN_SECTORS (INITIAL_PROGRAM_SIZE / 2048)
+
+// media type in the Device Info field (after the CRC)
+#define SCAN_DEVICE_TYPE 0x25
+
+typedef struct scan_context_t {
+  vector *files;
+  extract_format_t format;
+  FILE *out;
+  pthread_mutex_t lock;
+  int failed;
+} scan_context_t;
+
+typedef struct scan_file_t {
+  char *filename;
+  extract_format_t format;
+  buffer_t out;
+} scan_file_t;
+
+static const unsigned char scan_sync[12] = {
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00
+};
+
+/* Search */
+
+static const char *
+scan_find(const char *data, size_t size, const char *needle, size_t length)
+{
+  size_t i = 0;
+
+#ifdef __SSE2__
+  // compare the first and the last bytes of the needle at 16 positions at
+  // once, then check the candidates only
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i last = _mm_set1_epi8(needle[length - 1]);
+
+  for (; i + length - 1 + 16 <= size; i += 16) {
+    __m128i a = _mm_loadu_si128((const __m128i *) (data + i));
+    __m128i b = _mm_loadu_si128((const __m128i *) (data + i + length - 1));
+    unsigned int mask = _mm_movemask_epi8(
+      _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+
+    while (mask) {
+      int bit = __builtin_ctz(mask);
+      if (!memcmp(data + i + bit + 1, needle + 1, length - 2)) {
+        return data + i + bit;
+      }
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  while (i + length <= size) {
+    const char *p = (const char *) memchr(data + i, needle[0], size - i - length + 1);
+    if (p == NULL) {
+      break;
+    }
+    if (!memcmp(p, needle, length)) {
+      return p;
+    }
+    i = p - data + 1;
+  }
+
+  return NULL;
+}
+
+static scan_sector_t
+scan_detect_sector(const unsigned char *data, size_t size, size_t offset, size_t *start,
+  size_t *stride)
+{
+  const unsigned char *p = data + offset;
+
+  // raw sectors start with the sync pattern, followed by the header
+  if (offset >= 24 && !memcmp(p - 24, scan_sync, sizeof(scan_sync)) && p[-24 + 15] == 2) {
+    *start = offset - 24;
+    *stride = 2352;
+    return SCAN_SECTOR_MODE2_2352;
+  }
+
+  if (offset >= 16 && !memcmp(p - 16, scan_sync, sizeof(scan_sync)) && p[-1] == 1) {
+    *start = offset - 16;
+    *stride = 2352;
+    return SCAN_SECTOR_MODE1_2352;
+  }
+
+  // Mode 2 sectors without header: the subheader is repeated, in this sector
+  // and in the next one
+  if (offset >= 8 && offset + 2336 <= size && !memcmp(p - 8, p - 4, 4) &&
+      !memcmp(p - 8, p - 8 + 2336, 8)) {
+    *start = offset - 8;
+    *stride = 2336;
+    return SCAN_SECTOR_MODE2_2336;
+  }
+
+  *start = offset;
+  *stride = 2048;
+  return SCAN_SECTOR_2048;
+}
+
+/* Public interface */
+
+const char *
+scan_sector_name(scan_sector_t sector)
+{
+  static const char *names[] = { "2048", "mode1/2352", "mode2/2352", "mode2/2336" };
+  return names[sector];
+}
+
+int
+scan_map(mapped_file_t *map, scan_hit_t hit, void *context)
+{
+  const char *data = map->data;
+  size_t size = map->size, offset = 0;
+  char *ip = (char *) malloc(INITIAL_PROGRAM_SIZE);
+  int hits = 0;
+
+  // the image is read once, from start to end
+  if (data != NULL) {
+    madvise(map->data, map->size, MADV_SEQUENTIAL);
+  }
+
+  while (data != NULL && offset < size) {
+    const char *found = scan_find(data + offset, size - offset, SCAN_SIGNATURE,
+      SCAN_SIGNATURE_SIZE);
+    if (found == NULL) {
+      break;
+    }
+
+    size_t position = found - data, start, stride;
+    scan_sector_t sector = scan_detect_sector((const unsigned char *) data, size,
+      position, &start, &stride);
+    size_t user = position - start;
+
+    // the bootstrap is spread over 16 sectors; the Hardware ID alone isn't
+    // enough (e.g. it's also the system identifier of the ISO9660 volume),
+    // so the Device Info field is checked too
+    if (start + (SCAN_SECTORS - 1) * stride + user + 2048 <= size) {
+      for (int i = 0; i < SCAN_SECTORS; i++) {
+        memcpy(ip + i * 2048, data + start + i * stride + user, 2048);
+      }
+      if (!memcmp(ip + SCAN_DEVICE_TYPE, "CD-ROM", 6) ||
+          !memcmp(ip + SCAN_DEVICE_TYPE, "GD-ROM", 6)) {
+        hit(ip, position, sector, context);
+        hits++;
+      }
+    }
+
+    offset = position + 1;
+  }
+
+  free(ip);
+
+  return hits;
+}
+
+static void
+scan_hit(const char *ip, uint64_t offset, scan_sector_t sector, void *context)
+{
+  scan_file_t *file = (scan_file_t *) context;
+  char value[64];
+  const char *error;
+  mr_info_t info;
+
+  extract_record_begin(&file->out, file->filename, file->format);
+
+  snprintf(value, sizeof(value), "%llu", (unsigned long long) offset);
+  extract_record_value(&file->out, file->format, "Offset", value);
+  extract_record_value(&file->out, file->format, "Sector", scan_sector_name(sector));
+
+  if (mr_parse((const unsigned char *) ip + MR_OFFSET, INITIAL_PROGRAM_SIZE - MR_OFFSET,
+      &info, &error)) {
+    snprintf(value, sizeof(value), "%ux%u, %u colors, %u bytes", info.width,
+      info.height, info.colors, info.size);
+  } else {
+    snprintf(value, sizeof(value), "none");
+  }
+  extract_record_value(&file->out, file->format, "Logo", value);
+
+  extract_record_fields(ip, file->format, &file->out);
+  extract_record_end(&file->out, file->format);
+}
+
+static void
+scan_job(int index, void *context)
+{
+  scan_context_t *ctx = (scan_context_t *) context;
+  scan_file_t file;
+  mapped_file_t map;
+  int hits = 0;
+
+  file.filename = VECTOR_GET(*ctx->files, char*, index);
+  file.format = ctx->format;
+  buffer_init(&file.out);
+
+  if (file_map(file.filename, FILE_MAP_READ, &map)) {
+    hits = scan_map(&map, scan_hit, &file);
+    file_unmap(&map);
+    if (!hits) {
+      log_error("%s: no bootstrap found\n", file.filename);
+    }
+  }
+
+  // all the records of an image are written at once
+  pthread_mutex_lock(&ctx->lock);
+  if (file.out.size) {
+    fwrite(file.out.data, 1, file.out.size, ctx->out);
+  }
+  if (!hits) {
+    ctx->failed++;
+  }
+  pthread_mutex_unlock(&ctx->lock);
+
+  buffer_free(&file.out);
+}
+
+int
+scan_files(vector *files, extract_format_t format, FILE *out)
+{
+  scan_context_t ctx;
+
+  ctx.files = files;
+  ctx.format = format;
+  ctx.out = out;
+  ctx.failed = 0;
+  pthread_mutex_init(&ctx.lock, NULL);
+
+  pool_run(vector_total(files), scan_job, &ctx);
+
+  pthread_mutex_destroy(&ctx.lock);
+  fflush(out);
+
+  return ctx.failed;
+}
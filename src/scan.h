@@ -0,0 +1,61 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SCAN_H__
+#define __SCAN_H__
+
+#include <stdint.h>
+
+#include "global.h"
+
+#include "utils.h"
+#include "vector.h"
+#include "extract.h"
+
+typedef enum scan_sector_t {
+  SCAN_SECTOR_2048 = 0,    // user data only (ISO, CDI 2048...)
+  SCAN_SECTOR_MODE1_2352,  // raw Mode 1 sectors
+  SCAN_SECTOR_MODE2_2352,  // raw Mode 2 Form 1 sectors
+  SCAN_SECTOR_MODE2_2336   // Mode 2 Form 1 sectors without sync/header
+} scan_sector_t;
+
+// called for each bootstrap found, reassembled in a 0x8000 bytes buffer
+typedef void (*scan_hit_t)(const char *ip, uint64_t offset, scan_sector_t sector,
+  void *context);
+
+const char * scan_sector_name(scan_sector_t sector);
+
+int scan_map(mapped_file_t *map, scan_hit_t hit, void *context);
+int scan_files(vector *files, extract_format_t format, FILE *out);
+
+#endif /* __SCAN_H__ */
@@ -0,0 +1,226 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/stat.h>
+
+#include "scramble.h"
+
+#include "output.h"
+#include "pool.h"
+
+// data processed at once: the memory used doesn't depend on the file size
+#define SCRAMBLE_WINDOW (16 * 1024 * 1024)
+
+// a window holds full size chunks, plus at most one of each smaller size
+#define SCRAMBLE_WINDOW_CHUNKS (SCRAMBLE_WINDOW / SCRAMBLE_MAX_CHUNK + 17)
+
+typedef struct scramble_chunk_t {
+  size_t offset;       // offset of the chunk in the window
+  uint32_t slices;
+  uint16_t *table;     // slice k of the scrambled chunk is slice table[k]
+} scramble_chunk_t;
+
+typedef struct scramble_state_t {
+  scramble_mode_t mode;
+  uint32_t seed;
+  uint64_t remaining;  // bytes not assigned to a chunk yet
+  size_t chunk_size;   // current chunk size
+  unsigned char *in;
+  unsigned char *out;
+  uint16_t *tables;
+  uint16_t *work;
+  scramble_chunk_t chunks[SCRAMBLE_WINDOW_CHUNKS];
+  int count;
+} scramble_state_t;
+
+/* Permutations */
+
+static uint32_t
+scramble_rand(scramble_state_t *state)
+{
+  state->seed = (state->seed * 2109 + 9273) & 0x7fff;
+  return (state->seed + 0xc000) & 0xffff;
+}
+
+static void
+scramble_table(scramble_state_t *state, uint16_t *table, uint32_t slices)
+{
+  uint16_t *index = state->work;
+
+  // each slice is swapped with a random one while going backwards, the
+  // random sequence continuing from one chunk to the next
+  for (uint32_t i = 0; i < slices; i++) {
+    index[i] = i;
+  }
+
+  for (int i = slices - 1, k = 0; i >= 0; i--, k++) {
+    uint32_t x = (scramble_rand(state) * (uint32_t) i) >> 16;
+    uint16_t swap = index[i];
+    index[i] = index[x];
+    index[x] = swap;
+    table[k] = index[i];
+  }
+}
+
+static size_t
+scramble_next_chunk(scramble_state_t *state)
+{
+  // 2 MB chunks for as long as possible, then smaller and smaller ones
+  while (state->chunk_size >= SCRAMBLE_SLICE && state->remaining < state->chunk_size) {
+    state->chunk_size >>= 1;
+  }
+
+  return (state->chunk_size >= SCRAMBLE_SLICE) ? state->chunk_size : 0;
+}
+
+static void
+scramble_chunk_job(int index, void *context)
+{
+  scramble_state_t *state = (scramble_state_t *) context;
+  scramble_chunk_t *chunk = &state->chunks[index];
+  const unsigned char *in = state->in + chunk->offset;
+  unsigned char *out = state->out + chunk->offset;
+
+  if (state->mode == SCRAMBLE_ENCODE) {
+    for (uint32_t k = 0; k < chunk->slices; k++) {
+      memcpy(out + k * SCRAMBLE_SLICE, in + chunk->table[k] * SCRAMBLE_SLICE, SCRAMBLE_SLICE);
+    }
+  } else {
+    for (uint32_t k = 0; k < chunk->slices; k++) {
+      memcpy(out + chunk->table[k] * SCRAMBLE_SLICE, in + k * SCRAMBLE_SLICE, SCRAMBLE_SLICE);
+    }
+  }
+}
+
+/* Public interface */
+
+int
+scramble_file(scramble_mode_t mode, char *fn_in, char *fn_out)
+{
+  scramble_state_t *state;
+  struct stat stats, stats_out;
+  int result = 1;
+
+  int in = open(fn_in, O_RDONLY);
+  if (in == -1 || fstat(in, &stats) == -1) {
+    log_error("can't open \"%s\": %s\n", fn_in, strerror(errno));
+    if (in != -1) {
+      close(in);
+    }
+    return 0;
+  }
+
+  if (stat(fn_out, &stats_out) == 0 && stats_out.st_dev == stats.st_dev &&
+      stats_out.st_ino == stats.st_ino) {
+    log_error("\"%s\" can't be %s in place\n", fn_in,
+      (mode == SCRAMBLE_ENCODE) ? "scrambled" : "descrambled");
+    close(in);
+    return 0;
+  }
+
+  output_file_t output;
+  if (!output_open(&output, fn_out, 0)) {
+    close(in);
+    return 0;
+  }
+  int out = output.fd;
+
+  log_notice("%s \"%s\" to \"%s\"\n",
+    (mode == SCRAMBLE_ENCODE) ? "scrambling" : "descrambling", fn_in, fn_out);
+
+  state = (scramble_state_t *) calloc(1, sizeof(scramble_state_t));
+  state->mode = mode;
+  state->seed = stats.st_size & 0xffff;
+  state->remaining = stats.st_size;
+  state->chunk_size = SCRAMBLE_MAX_CHUNK;
+  state->in = (unsigned char *) malloc(SCRAMBLE_WINDOW);
+  state->out = (unsigned char *) malloc(SCRAMBLE_WINDOW);
+  state->tables = (uint16_t *) malloc(SCRAMBLE_WINDOW / SCRAMBLE_SLICE * sizeof(uint16_t));
+  state->work = (uint16_t *) malloc(SCRAMBLE_MAX_CHUNK / SCRAMBLE_SLICE * sizeof(uint16_t));
+
+  while (result && state->remaining > 0) {
+    size_t window = 0, chunk_size;
+
+    // the permutations of a window are computed in file order, since the
+    // random sequence runs through the whole file, then applied in parallel
+    state->count = 0;
+    while ((chunk_size = scramble_next_chunk(state)) != 0 &&
+           window + chunk_size <= SCRAMBLE_WINDOW) {
+      scramble_chunk_t *chunk = &state->chunks[state->count++];
+      chunk->offset = window;
+      chunk->slices = chunk_size / SCRAMBLE_SLICE;
+      chunk->table = state->tables + window / SCRAMBLE_SLICE;
+      scramble_table(state, chunk->table, chunk->slices);
+      window += chunk_size;
+      state->remaining -= chunk_size;
+    }
+
+    // the final incomplete slice is left as is
+    size_t tail = 0;
+    if (chunk_size == 0) {
+      tail = state->remaining;
+      state->remaining = 0;
+    }
+
+    if (!file_read_full(in, state->in, window + tail)) {
+      log_error("unable to read \"%s\"\n", fn_in);
+      result = 0;
+      break;
+    }
+
+    pool_run(state->count, scramble_chunk_job, state);
+    memcpy(state->out + window, state->in + window, tail);
+
+    if (!file_write_full(out, state->out, window + tail)) {
+      log_error("unable to write \"%s\": %s\n", fn_out, strerror(errno));
+      result = 0;
+    }
+  }
+
+  if (result) {
+    result = output_commit(&output);
+  } else {
+    output_abort(&output);
+  }
+  close(in);
+
+  free(state->in);
+  free(state->out);
+  free(state->tables);
+  free(state->work);
+  free(state);
+
+  return result;
+}
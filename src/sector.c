@@ -0,0 +1,326 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+
+#include "sector.h"
+
+#include "crc.h"
+#include "output.h"
+#include "pool.h"
+
+// sectors encoded by each job of the pool
+#define SECTOR_JOB_SIZE 256
+
+// offsets in a raw sector
+#define SECTOR_HEADER 12
+#define SECTOR_MODE1_DATA 16
+#define SECTOR_MODE1_EDC 2064
+#define SECTOR_MODE2_SUBHEADER 16
+#define SECTOR_MODE2_DATA 24
+#define SECTOR_MODE2_EDC 2072
+#define SECTOR_ECC_P 2076
+#define SECTOR_ECC_Q 2248
+
+// P parity: 86 columns of 24 bytes, Q parity: 52 diagonals of 43 bytes
+#define SECTOR_P_COLUMNS 86
+#define SECTOR_P_ROWS 24
+#define SECTOR_Q_DIAGONALS 52
+#define SECTOR_Q_LENGTH 43
+#define SECTOR_Q_SIZE (SECTOR_Q_DIAGONALS * SECTOR_Q_LENGTH)
+
+// Mode 2 Form 1 subheader: file 0, channel 0, data submode, no coding
+#define SECTOR_SUBMODE_DATA 0x08
+
+// GF(2^8) tables of the Reed-Solomon product code (polynomial 0x11d):
+// multiplication by alpha, and division by (1 + alpha)
+static unsigned char ecc_f_table[256];
+static unsigned char ecc_b_table[256];
+
+static pthread_once_t sector_tables_once = PTHREAD_ONCE_INIT;
+
+static const unsigned char sector_sync[12] = {
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00
+};
+
+static void
+sector_tables_initialize(void)
+{
+  for (int i = 0; i < 256; i++) {
+    int f = (i << 1) ^ ((i & 0x80) ? 0x11d : 0);
+    ecc_f_table[i] = f;
+    ecc_b_table[i ^ f] = i;
+  }
+}
+
+/* Reed-Solomon Product Code */
+
+// multiply eight GF(2^8) elements at once by alpha
+static inline uint64_t
+ecc_mul_alpha8(uint64_t v)
+{
+  return ((v & 0x7f7f7f7f7f7f7f7fULL) << 1) ^
+    (((v >> 7) & 0x0101010101010101ULL) * 0x1d);
+}
+
+static void
+ecc_compute_p(const unsigned char *src, unsigned char *dest)
+{
+  // the 86 columns are contiguous in each row, so they are computed side by
+  // side: eight columns per 64-bit word, the last six one byte at a time
+  uint64_t a[SECTOR_P_COLUMNS / 8], b[SECTOR_P_COLUMNS / 8];
+  unsigned char a_tail[SECTOR_P_COLUMNS % 8], b_tail[SECTOR_P_COLUMNS % 8];
+  int words = SECTOR_P_COLUMNS / 8, tail = words * 8;
+
+  memset(a, 0, sizeof(a));
+  memset(b, 0, sizeof(b));
+  memset(a_tail, 0, sizeof(a_tail));
+  memset(b_tail, 0, sizeof(b_tail));
+
+  for (int row = 0; row < SECTOR_P_ROWS; row++) {
+    const unsigned char *p = src + row * SECTOR_P_COLUMNS;
+    for (int i = 0; i < words; i++) {
+      uint64_t v;
+      memcpy(&v, p + i * 8, sizeof(v));
+      b[i] ^= v;
+      a[i] = ecc_mul_alpha8(a[i] ^ v);
+    }
+    for (int i = 0; i < SECTOR_P_COLUMNS - tail; i++) {
+      b_tail[i] ^= p[tail + i];
+      a_tail[i] = ecc_f_table[a_tail[i] ^ p[tail + i]];
+    }
+  }
+
+  unsigned char ecc_a[SECTOR_P_COLUMNS], ecc_b[SECTOR_P_COLUMNS];
+  memcpy(ecc_a, a, sizeof(a));
+  memcpy(ecc_b, b, sizeof(b));
+  memcpy(ecc_a + tail, a_tail, sizeof(a_tail));
+  memcpy(ecc_b + tail, b_tail, sizeof(b_tail));
+
+  for (int i = 0; i < SECTOR_P_COLUMNS; i++) {
+    unsigned char parity = ecc_b_table[ecc_f_table[ecc_a[i]] ^ ecc_b[i]];
+    dest[i] = parity;
+    dest[i + SECTOR_P_COLUMNS] = parity ^ ecc_b[i];
+  }
+}
+
+static void
+ecc_compute_q(const unsigned char *src, unsigned char *dest)
+{
+  for (int major = 0; major < SECTOR_Q_DIAGONALS; major++) {
+    int index = (major >> 1) * SECTOR_P_COLUMNS + (major & 1);
+    unsigned char ecc_a = 0, ecc_b = 0;
+
+    for (int minor = 0; minor < SECTOR_Q_LENGTH; minor++) {
+      unsigned char v = src[index];
+      index += SECTOR_P_COLUMNS + 2;
+      if (index >= SECTOR_Q_SIZE) {
+        index -= SECTOR_Q_SIZE;
+      }
+      ecc_b ^= v;
+      ecc_a = ecc_f_table[ecc_a ^ v];
+    }
+
+    ecc_a = ecc_b_table[ecc_f_table[ecc_a] ^ ecc_b];
+    dest[major] = ecc_a;
+    dest[major + SECTOR_Q_DIAGONALS] = ecc_a ^ ecc_b;
+  }
+}
+
+static void
+ecc_generate(unsigned char *sector)
+{
+  // both parities cover the header, the data, the EDC and (for Q) the P
+  // parity, i.e. everything after the sync pattern
+  ecc_compute_p(sector + SECTOR_HEADER, sector + SECTOR_ECC_P);
+  ecc_compute_q(sector + SECTOR_HEADER, sector + SECTOR_ECC_Q);
+}
+
+/* Sectors */
+
+static unsigned char
+sector_bcd(int value)
+{
+  return ((value / 10) << 4) | (value % 10);
+}
+
+static void
+sector_header(unsigned char *sector, uint32_t lba, int mode)
+{
+  uint32_t address = lba + SECTOR_MSF_OFFSET;
+
+  memcpy(sector, sector_sync, sizeof(sector_sync));
+  sector[SECTOR_HEADER + 0] = sector_bcd(address / (60 * 75));
+  sector[SECTOR_HEADER + 1] = sector_bcd((address / 75) % 60);
+  sector[SECTOR_HEADER + 2] = sector_bcd(address % 75);
+  sector[SECTOR_HEADER + 3] = mode;
+}
+
+static void
+sector_edc(unsigned char *sector, int start, int end)
+{
+  uint32_t edc = crc32_edc(CRC32_EDC_INIT, sector + start, end - start);
+
+  sector[end + 0] = edc;
+  sector[end + 1] = edc >> 8;
+  sector[end + 2] = edc >> 16;
+  sector[end + 3] = edc >> 24;
+}
+
+void
+sector_encode(sector_format_t format, uint32_t lba, const void *user, void *raw)
+{
+  unsigned char *sector = (unsigned char *) raw;
+  unsigned char header[4];
+
+  pthread_once(&sector_tables_once, sector_tables_initialize);
+
+  switch (format) {
+    case SECTOR_FORMAT_MODE1:
+      sector_header(sector, lba, 1);
+      memcpy(sector + SECTOR_MODE1_DATA, user, SECTOR_USER_SIZE);
+      sector_edc(sector, 0, SECTOR_MODE1_EDC);
+      memset(sector + SECTOR_MODE1_EDC + 4, 0, 8);
+      ecc_generate(sector);
+      break;
+    case SECTOR_FORMAT_MODE2_FORM1:
+      sector_header(sector, lba, 2);
+      memset(sector + SECTOR_MODE2_SUBHEADER, 0, 8);
+      sector[SECTOR_MODE2_SUBHEADER + 2] = SECTOR_SUBMODE_DATA;
+      sector[SECTOR_MODE2_SUBHEADER + 6] = SECTOR_SUBMODE_DATA;
+      memcpy(sector + SECTOR_MODE2_DATA, user, SECTOR_USER_SIZE);
+      sector_edc(sector, SECTOR_MODE2_SUBHEADER, SECTOR_MODE2_EDC);
+
+      // the header isn't protected by the ECC in Mode 2
+      memcpy(header, sector + SECTOR_HEADER, sizeof(header));
+      memset(sector + SECTOR_HEADER, 0, sizeof(header));
+      ecc_generate(sector);
+      memcpy(sector + SECTOR_HEADER, header, sizeof(header));
+      break;
+    case SECTOR_FORMAT_MODE2_2336:
+      {
+        unsigned char full[SECTOR_RAW_SIZE];
+        sector_encode(SECTOR_FORMAT_MODE2_FORM1, lba, user, full);
+        memcpy(sector, full + SECTOR_MODE2_SUBHEADER, SECTOR_MODE2_SIZE);
+      }
+      break;
+    default:
+      memcpy(sector, user, SECTOR_USER_SIZE);
+      break;
+  }
+}
+
+typedef struct sector_range_t {
+  sector_format_t format;
+  uint32_t lba;
+  const unsigned char *user;
+  unsigned char *raw;
+  uint32_t count;
+} sector_range_t;
+
+static void
+sector_encode_job(int index, void *context)
+{
+  sector_range_t *range = (sector_range_t *) context;
+  size_t size = sector_size(range->format);
+  uint32_t first = index * SECTOR_JOB_SIZE;
+  uint32_t last = first + SECTOR_JOB_SIZE;
+
+  if (last > range->count) {
+    last = range->count;
+  }
+
+  for (uint32_t i = first; i < last; i++) {
+    sector_encode(range->format, range->lba + i,
+      range->user + (size_t) i * SECTOR_USER_SIZE, range->raw + (size_t) i * size);
+  }
+}
+
+void
+sector_encode_range(sector_format_t format, uint32_t lba,
+  const void *user, void *raw, uint32_t count)
+{
+  sector_range_t range = {
+    format, lba, (const unsigned char *) user, (unsigned char *) raw, count
+  };
+
+  pool_run((count + SECTOR_JOB_SIZE - 1) / SECTOR_JOB_SIZE, sector_encode_job, &range);
+}
+
+/* Public interface */
+
+int
+sector_format_parse(char *str, sector_format_t *format)
+{
+  if (!strcmp(str, "iso") || !strcmp(str, "2048")) {
+    *format = SECTOR_FORMAT_ISO;
+  } else if (!strcmp(str, "mode1")) {
+    *format = SECTOR_FORMAT_MODE1;
+  } else if (!strcmp(str, "mode2")) {
+    *format = SECTOR_FORMAT_MODE2_FORM1;
+  } else {
+    return 0;
+  }
+  return 1;
+}
+
+size_t
+sector_size(sector_format_t format)
+{
+  switch (format) {
+    case SECTOR_FORMAT_ISO:
+      return SECTOR_USER_SIZE;
+    case SECTOR_FORMAT_MODE2_2336:
+      return SECTOR_MODE2_SIZE;
+    default:
+      return SECTOR_RAW_SIZE;
+  }
+}
+
+int
+sector_file_write(char *filename, sector_format_t format, uint32_t lba,
+  const void *data, size_t size)
+{
+  uint32_t count = size / SECTOR_USER_SIZE;
+  size_t raw_size = count * sector_size(format);
+  char *raw = (char *) malloc(raw_size);
+  int result;
+
+  sector_encode_range(format, lba, data, raw, count);
+
+  result = output_write(filename, raw, raw_size, 0);
+
+  free(raw);
+
+  return result;
+}
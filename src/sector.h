@@ -0,0 +1,72 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SECTOR_H__
+#define __SECTOR_H__
+
+#include <stdint.h>
+
+#include "global.h"
+
+#include "utils.h"
+
+// user data of a Mode 1 or Mode 2 Form 1 sector (i.e. ISO9660 sector)
+#define SECTOR_USER_SIZE 2048
+
+// full sector as stored on the disc (sync, header, data, EDC, ECC)
+#define SECTOR_RAW_SIZE 2352
+
+// Mode 2 sector without the sync pattern and the header
+#define SECTOR_MODE2_SIZE 2336
+
+// sectors before LBA 0 (the 2 seconds pregap of the first track)
+#define SECTOR_MSF_OFFSET 150
+
+typedef enum sector_format_t {
+  SECTOR_FORMAT_ISO = 0,     // 2048 bytes, user data only
+  SECTOR_FORMAT_MODE1,       // 2352 bytes, CD-ROM Mode 1
+  SECTOR_FORMAT_MODE2_FORM1, // 2352 bytes, CD-ROM XA Mode 2 Form 1
+  SECTOR_FORMAT_MODE2_2336   // 2336 bytes, Mode 2 Form 1 without sync/header
+} sector_format_t;
+
+int sector_format_parse(char *str, sector_format_t *format);
+size_t sector_size(sector_format_t format);
+
+void sector_encode(sector_format_t format, uint32_t lba, const void *user, void *raw);
+void sector_encode_range(sector_format_t format, uint32_t lba,
+  const void *user, void *raw, uint32_t count);
+
+int sector_file_write(char *filename, sector_format_t format, uint32_t lba,
+  const void *data, size_t size);
+
+#endif /* __SECTOR_H__ */
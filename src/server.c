@@ -0,0 +1,675 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "server.h"
+
+#include "utils.h"
+#include "field.h"
+#include "ip.h"
+#include "mr.h"
+#include "output.h"
+#include "pool.h"
+#include "stats.h"
+
+// cached templates and logos (least recently used entries are replaced)
+#define SERVER_TEMPLATE_CACHE_SIZE 16
+#define SERVER_LOGO_CACHE_SIZE 64
+
+// idle connections check if the server is stopping at this interval (ms)
+#define SERVER_POLL_INTERVAL 200
+
+// a field value and its terminating null char
+#define SERVER_FIELD_SIZE (IP_FIELDS_SIZE + 1)
+
+typedef struct server_cache_entry_t {
+  uint64_t key;
+  unsigned long used;
+  char *data;
+  size_t size;
+} server_cache_entry_t;
+
+typedef struct server_cache_t {
+  pthread_mutex_t lock;
+  unsigned long clock;
+  server_cache_entry_t entries[SERVER_LOGO_CACHE_SIZE];
+  int count;
+} server_cache_t;
+
+typedef struct server_record_t {
+  const unsigned char *data;
+  size_t size;
+} server_record_t;
+
+typedef struct server_request_t {
+  server_record_t fields[NUM_FIELDS];
+  server_record_t template_name;
+  server_record_t template_file;
+  server_record_t logo;
+  server_record_t logo_file;
+  server_record_t output;
+} server_request_t;
+
+typedef struct server_t {
+  int fd;
+  int stopping;  // set once, when SIGINT/SIGTERM is received
+  ip_template_t *tmpl;
+  mr_output_t *logo;
+  server_cache_t templates;
+  server_cache_t logos;
+} server_t;
+
+/* Caches */
+
+static void
+server_cache_init(server_cache_t *cache, int count)
+{
+  memset(cache, 0, sizeof(server_cache_t));
+  pthread_mutex_init(&cache->lock, NULL);
+  cache->count = count;
+}
+
+// Copies a cached entry to data (capacity bytes), returns its size or 0
+static size_t
+server_cache_get(server_cache_t *cache, uint64_t key, char *data, size_t capacity)
+{
+  size_t size = 0;
+
+  pthread_mutex_lock(&cache->lock);
+  for (int i = 0; i < cache->count; i++) {
+    server_cache_entry_t *entry = &cache->entries[i];
+    if (entry->data != NULL && entry->key == key && entry->size <= capacity) {
+      memcpy(data, entry->data, entry->size);
+      entry->used = ++cache->clock;
+      size = entry->size;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&cache->lock);
+
+  return size;
+}
+
+static void
+server_cache_put(server_cache_t *cache, uint64_t key, const char *data, size_t size)
+{
+  server_cache_entry_t *victim;
+
+  pthread_mutex_lock(&cache->lock);
+  victim = &cache->entries[0];
+  for (int i = 0; i < cache->count; i++) {
+    server_cache_entry_t *entry = &cache->entries[i];
+    if (entry->data != NULL && entry->key == key) {
+      // loaded by another request in the meantime
+      victim = NULL;
+      break;
+    }
+    if (entry->used < victim->used) {
+      victim = entry;
+    }
+  }
+
+  if (victim != NULL) {
+    free(victim->data);
+    victim->key = key;
+    victim->used = ++cache->clock;
+    victim->data = (char *) malloc(size);
+    victim->size = size;
+    memcpy(victim->data, data, size);
+  }
+  pthread_mutex_unlock(&cache->lock);
+}
+
+static void
+server_cache_free(server_cache_t *cache)
+{
+  for (int i = 0; i < cache->count; i++) {
+    free(cache->entries[i].data);
+  }
+  pthread_mutex_destroy(&cache->lock);
+}
+
+// Key of a file: the entry is loaded again when the file is changed
+static int
+server_file_key(const char *path, uint64_t *key)
+{
+  struct stat st;
+
+  if (stat(path, &st)) {
+    return 0;
+  }
+
+  *key = hash_fnv1a(HASH_FNV1A_INIT, path, strlen(path));
+  *key = hash_fnv1a(*key, &st.st_ino, sizeof(st.st_ino));
+  *key = hash_fnv1a(*key, &st.st_size, sizeof(st.st_size));
+  *key = hash_fnv1a(*key, &st.st_mtim, sizeof(st.st_mtim));
+
+  return 1;
+}
+
+/* Requests */
+
+static char *
+server_string(server_record_t *record)
+{
+  return strndup((const char *) record->data, record->size);
+}
+
+static int
+server_parse(const unsigned char *data, size_t size, server_request_t *request)
+{
+  size_t offset = 0;
+
+  memset(request, 0, sizeof(server_request_t));
+
+  while (offset < size) {
+    server_record_t *record = NULL;
+    uint16_t tag;
+    uint32_t length;
+
+    if (size - offset < SERVER_RECORD_HEADER_SIZE) {
+      return 0;
+    }
+    tag = server_get16(data + offset);
+    length = server_get32(data + offset + 2);
+    offset += SERVER_RECORD_HEADER_SIZE;
+    if (length > size - offset) {
+      return 0;
+    }
+
+    if (tag >= SERVER_TAG_FIELD && tag < SERVER_TAG_FIELD + NUM_FIELDS) {
+      record = &request->fields[tag - SERVER_TAG_FIELD];
+    } else {
+      switch (tag) {
+        case SERVER_TAG_TEMPLATE:
+          record = &request->template_name;
+          break;
+        case SERVER_TAG_TEMPLATE_FILE:
+          record = &request->template_file;
+          break;
+        case SERVER_TAG_LOGO:
+          record = &request->logo;
+          break;
+        case SERVER_TAG_LOGO_FILE:
+          record = &request->logo_file;
+          break;
+        case SERVER_TAG_OUTPUT:
+          record = &request->output;
+          break;
+        default:
+          return 0;
+      }
+    }
+
+    record->data = data + offset;
+    record->size = length;
+    offset += length;
+  }
+
+  return 1;
+}
+
+static int
+server_template(server_t *server, server_request_t *request, char *ip,
+  buffer_t *message)
+{
+  char *name = NULL;
+  uint64_t key;
+  int result = 1;
+
+  if (request->template_name.data != NULL) {
+    name = server_string(&request->template_name);
+    key = hash_fnv1a(HASH_FNV1A_INIT, name, strlen(name));
+
+    if (!server_cache_get(&server->templates, key, ip, INITIAL_PROGRAM_SIZE)) {
+      ip_template_t tmpl;
+      if ((result = ip_template_embedded(&tmpl, name))) {
+        memcpy(ip, tmpl.data, INITIAL_PROGRAM_SIZE);
+        ip_template_release(&tmpl);
+        server_cache_put(&server->templates, key, ip, INITIAL_PROGRAM_SIZE);
+      } else {
+        buffer_printf(message, "unknown embedded bootstrap template \"%s\"", name);
+      }
+    }
+  } else if (request->template_file.data != NULL) {
+    name = server_string(&request->template_file);
+
+    if (!server_file_key(name, &key) ||
+        !server_cache_get(&server->templates, key, ip, INITIAL_PROGRAM_SIZE)) {
+      int fd = open(name, O_RDONLY);
+      struct stat st;
+
+      result = fd >= 0 && !fstat(fd, &st) && st.st_size == INITIAL_PROGRAM_SIZE &&
+        file_read_full(fd, ip, INITIAL_PROGRAM_SIZE);
+      if (fd >= 0) {
+        close(fd);
+      }
+
+      if (result) {
+        server_cache_put(&server->templates, key, ip, INITIAL_PROGRAM_SIZE);
+      } else {
+        buffer_printf(message, "can't read bootstrap template \"%s\"", name);
+      }
+    }
+  } else {
+    memcpy(ip, server->tmpl->data, INITIAL_PROGRAM_SIZE);
+  }
+
+  free(name);
+
+  return result;
+}
+
+static int
+server_logo(server_t *server, server_request_t *request, char *ip,
+  buffer_t *message)
+{
+  char logo[MR_MAX_SIZE];
+  mr_output_t output;
+  size_t size = 0;
+  uint64_t key = 0;
+  int cacheable = 1, loaded = 0;
+
+  mr_init(&output);
+
+  // logos are converted once, then copied from the cache
+  if (request->logo.data != NULL) {
+    key = hash_fnv1a(HASH_FNV1A_INIT, request->logo.data, request->logo.size);
+    size = server_cache_get(&server->logos, key, logo, sizeof(logo));
+    if (!size) {
+      loaded = mr_load_data(request->logo.data, request->logo.size, &output);
+    }
+  } else if (request->logo_file.data != NULL) {
+    char *name = server_string(&request->logo_file);
+    cacheable = server_file_key(name, &key);
+    if (cacheable) {
+      size = server_cache_get(&server->logos, key, logo, sizeof(logo));
+    }
+    if (!size) {
+      loaded = mr_load_file(name, &output);
+    }
+    free(name);
+  } else if (server->logo != NULL) {
+    size = server->logo->size;
+    memcpy(logo, server->logo->data, size);
+  } else {
+    // no logo, the one of the template is kept
+    return 1;
+  }
+
+  if (!size) {
+    if (!loaded) {
+      buffer_printf(message, "unable to load the logo");
+    } else if (output.size > MR_MAX_SIZE) {
+      buffer_printf(message, "MR data is larger than %d bytes", MR_MAX_SIZE);
+    } else {
+      size = output.size;
+      memcpy(logo, output.data, size);
+      if (cacheable) {
+        server_cache_put(&server->logos, key, logo, size);
+      }
+    }
+  }
+  mr_destroy(&output);
+
+  if (!size) {
+    return 0;
+  }
+
+  memset(ip + MR_OFFSET, 0, MR_MAX_SIZE);
+  memcpy(ip + MR_OFFSET, logo, size);
+
+  return 1;
+}
+
+static int
+server_fields(server_request_t *request, char *ip, buffer_t *message)
+{
+  char value[SERVER_FIELD_SIZE];
+  uint64_t start = stats_start();
+
+  for (int i = 0; i < NUM_FIELDS; i++) {
+    server_record_t *record = &request->fields[i];
+
+    memset(value, 0, sizeof(value));
+
+    if (record->data != NULL) {
+      if (record->size > field_get_length(i)) {
+        buffer_printf(message, "data for field \"%s\" is too long", field_get_name(i));
+        stats_stop(STATS_FIELDS, start);
+        return 0;
+      }
+      memcpy(value, record->data, record->size);
+      if (!field_check_value(i, value)) {
+        buffer_printf(message, "invalid value for field \"%s\"", field_get_name(i));
+        stats_stop(STATS_FIELDS, start);
+        return 0;
+      }
+    } else if (i == RELEASE_DATE && !field_is_modified(i)) {
+      // the server may run for days
+      field_release_date_today(value);
+    } else {
+      strcpy(value, field_get_value(i));
+    }
+
+    field_write_string(ip, i, value);
+  }
+
+  stats_stop(STATS_FIELDS, start);
+
+  update_crc(ip);
+
+  return 1;
+}
+
+static server_status_t
+server_process(server_t *server, const unsigned char *data, size_t size,
+  buffer_t *response)
+{
+  server_request_t request;
+  buffer_t message;
+  char ip[INITIAL_PROGRAM_SIZE];
+  char *output = NULL;
+  server_status_t status = SERVER_STATUS_OK;
+  unsigned char header[SERVER_RECORD_HEADER_SIZE + 4];
+
+  stats_record_begin();
+
+  buffer_init(&message);
+
+  if (!server_parse(data, size, &request)) {
+    buffer_printf(&message, "malformed request");
+    status = SERVER_STATUS_BAD_REQUEST;
+  } else if (!server_template(server, &request, ip, &message) ||
+             !server_fields(&request, ip, &message) ||
+             !server_logo(server, &request, ip, &message)) {
+    status = SERVER_STATUS_BAD_REQUEST;
+  } else if (request.output.data != NULL) {
+    output = server_string(&request.output);
+
+    // each request is a batch of its own (see --sync)
+    if (!output_write(output, ip, INITIAL_PROGRAM_SIZE, OUTPUT_REPLACE) ||
+        !output_flush()) {
+      buffer_printf(&message, "unable to write \"%s\"", output);
+      status = SERVER_STATUS_ERROR;
+    } else {
+      log_notice("bootstrap written to \"%s\"\n", output);
+    }
+  }
+
+  server_put16(header, SERVER_TAG_STATUS);
+  server_put32(header + 2, 4);
+  server_put32(header + SERVER_RECORD_HEADER_SIZE, status);
+  buffer_append(response, header, sizeof(header));
+
+  if (message.size) {
+    server_put16(header, SERVER_TAG_MESSAGE);
+    server_put32(header + 2, message.size);
+    buffer_append(response, header, SERVER_RECORD_HEADER_SIZE);
+    buffer_append(response, message.data, message.size);
+    log_error("request failed: %.*s\n", (int) message.size, message.data);
+  }
+
+  if (status == SERVER_STATUS_OK && request.output.data == NULL) {
+    server_put16(header, SERVER_TAG_DATA);
+    server_put32(header + 2, INITIAL_PROGRAM_SIZE);
+    buffer_append(response, header, SERVER_RECORD_HEADER_SIZE);
+    buffer_append(response, ip, INITIAL_PROGRAM_SIZE);
+  }
+
+  buffer_free(&message);
+
+  // the bootstrap sent back to the client is named as the standard output
+  stats_record((output != NULL) ? output : STDIO_FILENAME);
+  free(output);
+
+  return status;
+}
+
+/* Connections */
+
+// Waits for the next request of a connection, returns 0 if the server stops
+static int
+server_wait_request(server_t *server, int fd)
+{
+  struct pollfd poller = { fd, POLLIN, 0 };
+
+  while (!__atomic_load_n(&server->stopping, __ATOMIC_ACQUIRE)) {
+    int ready = poll(&poller, 1, SERVER_POLL_INTERVAL);
+    if (ready > 0 || (ready < 0 && errno != EINTR)) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+static void
+server_serve(server_t *server, int fd)
+{
+  unsigned char header[SERVER_MESSAGE_HEADER_SIZE];
+  unsigned char *request = NULL;
+  buffer_t response;
+
+  buffer_init(&response);
+
+  // requests are handled until the client closes the connection or the
+  // server stops; a request being read is always completed
+  while (server_wait_request(server, fd) &&
+         file_read_full(fd, header, sizeof(header))) {
+    uint32_t size = server_get32(header);
+
+    if (size > SERVER_MESSAGE_MAX) {
+      log_error("request too large (%u bytes)\n", size);
+      break;
+    }
+
+    request = (unsigned char *) realloc(request, size ? size : 1);
+    if (!file_read_full(fd, request, size)) {
+      break;
+    }
+
+    // room for the length, set once the response is complete
+    response.size = 0;
+    buffer_append(&response, header, sizeof(header));
+    server_process(server, request, size, &response);
+    server_put32((unsigned char *) response.data, response.size - sizeof(header));
+
+    if (!file_write_full(fd, response.data, response.size)) {
+      break;
+    }
+  }
+
+  free(request);
+  buffer_free(&response);
+}
+
+static void *
+server_worker(void *context)
+{
+  server_t *server = (server_t *) context;
+
+  for (;;) {
+    int fd = accept(server->fd, NULL, NULL);
+
+    // the listening socket is shut down by server_run() to stop the workers
+    if (__atomic_load_n(&server->stopping, __ATOMIC_ACQUIRE)) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      break;
+    }
+
+    if (fd < 0) {
+      if (errno == EMFILE || errno == ENFILE) {
+        usleep(10000);
+      }
+      continue;
+    }
+
+    server_serve(server, fd);
+    close(fd);
+  }
+
+  return NULL;
+}
+
+static int
+server_listen(const char *path)
+{
+  struct sockaddr_un address;
+  int fd;
+
+  if (strlen(path) >= sizeof(address.sun_path)) {
+    log_error("socket path \"%s\" is too long\n", path);
+    return -1;
+  }
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, path);
+
+  fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    log_error("can't create socket: %s\n", strerror(errno));
+    return -1;
+  }
+
+  int bound = !bind(fd, (struct sockaddr *) &address, sizeof(address));
+
+  if (!bound && errno == EADDRINUSE) {
+    // the socket may be left by a server which didn't exit properly
+    int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe >= 0 && connect(probe, (struct sockaddr *) &address, sizeof(address)) &&
+        errno == ECONNREFUSED) {
+      unlink(path);
+      bound = !bind(fd, (struct sockaddr *) &address, sizeof(address));
+    } else {
+      errno = EADDRINUSE;
+    }
+    if (probe >= 0) {
+      close(probe);
+    }
+  }
+
+  if (!bound || listen(fd, SOMAXCONN)) {
+    log_error("can't listen on \"%s\": %s\n", path, strerror(errno));
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+/* Public interface */
+
+// Serves requests on a Unix socket until SIGINT/SIGTERM; the template and the
+// logo (may be NULL) are used by the requests without their own
+int
+server_run(const char *path, struct ip_template_t *tmpl, struct mr_output_t *logo)
+{
+  server_t server;
+  sigset_t signals;
+  pthread_t *threads;
+  char *names, *name, *state;
+  int count = pool_threads_get(), received;
+
+  server.tmpl = tmpl;
+  server.logo = logo;
+  server.stopping = 0;
+  server_cache_init(&server.templates, SERVER_TEMPLATE_CACHE_SIZE);
+  server_cache_init(&server.logos, SERVER_LOGO_CACHE_SIZE);
+
+  // embedded templates are decompressed before the first request
+  names = strdup(ip_template_get_names());
+  for (name = strtok_r(names, ", ", &state); name != NULL;
+       name = strtok_r(NULL, ", ", &state)) {
+    ip_template_t entry;
+    if (ip_template_embedded(&entry, name)) {
+      server_cache_put(&server.templates, hash_fnv1a(HASH_FNV1A_INIT, name,
+        strlen(name)), entry.data, INITIAL_PROGRAM_SIZE);
+      ip_template_release(&entry);
+    }
+  }
+  free(names);
+
+  // errno is set to errors of closed connections instead
+  signal(SIGPIPE, SIG_IGN);
+
+  // workers don't handle the signals, the main thread waits for them
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+  server.fd = server_listen(path);
+  if (server.fd < 0) {
+    server_cache_free(&server.templates);
+    server_cache_free(&server.logos);
+    return 0;
+  }
+
+  threads = (pthread_t *) malloc(count * sizeof(pthread_t));
+  for (int i = 0; i < count; i++) {
+    if (pthread_create(&threads[i], NULL, server_worker, &server)) {
+      halt("unable to create server thread\n");
+    }
+  }
+
+  log_notice("listening on \"%s\" with %d thread(s)\n", path, count);
+
+  sigwait(&signals, &received);
+
+  log_notice("stopping server\n");
+
+  // accept() fails in the workers once the socket is shut down, and the
+  // requests being processed are completed (outputs committed or aborted)
+  __atomic_store_n(&server.stopping, 1, __ATOMIC_RELEASE);
+  shutdown(server.fd, SHUT_RDWR);
+  for (int i = 0; i < count; i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  close(server.fd);
+  unlink(path);
+  free(threads);
+  server_cache_free(&server.templates);
+  server_cache_free(&server.logos);
+
+  return 1;
+}
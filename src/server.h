@@ -0,0 +1,119 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SERVER_H__
+#define __SERVER_H__
+
+#include <stdint.h>
+
+#include "global.h"
+
+/* Protocol
+ *
+ * A client sends requests on the Unix domain socket and gets one response
+ * for each of them, in order, on the same connection. Requests and responses
+ * are messages made of a 32-bit length followed by that many bytes of records.
+ * Each record is a 16-bit tag, a 32-bit length then the value. All the
+ * integers are little-endian.
+ */
+
+// largest message accepted (records included)
+#define SERVER_MESSAGE_MAX (1024 * 1024)
+
+#define SERVER_MESSAGE_HEADER_SIZE 4
+#define SERVER_RECORD_HEADER_SIZE 6
+
+typedef enum server_tag_t {
+  // request: IP field values (SERVER_TAG_FIELD + field index, see global.h),
+  // the fields not given get the defaults of the server
+  SERVER_TAG_FIELD = 0x0100,
+
+  // request: bootstrap template (embedded name or IP.TMPL path on the server)
+  SERVER_TAG_TEMPLATE = 0x0200,
+  SERVER_TAG_TEMPLATE_FILE,
+
+  // request: logo (MR or PNG data, or path on the server)
+  SERVER_TAG_LOGO = 0x0300,
+  SERVER_TAG_LOGO_FILE,
+
+  // request: path of the IP.BIN written by the server; without it, the
+  // bootstrap is returned in the response
+  SERVER_TAG_OUTPUT = 0x0400,
+
+  // response: status (32-bit, SERVER_STATUS_*), error message, bootstrap
+  SERVER_TAG_STATUS = 0x0500,
+  SERVER_TAG_MESSAGE,
+  SERVER_TAG_DATA
+} server_tag_t;
+
+typedef enum server_status_t {
+  SERVER_STATUS_OK = 0,
+  SERVER_STATUS_BAD_REQUEST,
+  SERVER_STATUS_ERROR
+} server_status_t;
+
+static inline void
+server_put16(unsigned char *p, uint16_t value)
+{
+  p[0] = value;
+  p[1] = value >> 8;
+}
+
+static inline void
+server_put32(unsigned char *p, uint32_t value)
+{
+  p[0] = value;
+  p[1] = value >> 8;
+  p[2] = value >> 16;
+  p[3] = value >> 24;
+}
+
+static inline uint16_t
+server_get16(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t
+server_get32(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+// the client only needs the protocol, not the bootstrap types
+struct ip_template_t;
+struct mr_output_t;
+
+int server_run(const char *path, struct ip_template_t *tmpl, struct mr_output_t *logo);
+
+#endif /* __SERVER_H__ */
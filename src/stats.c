@@ -0,0 +1,275 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "stats.h"
+#include "trace.h"
+
+typedef struct stats_values_t {
+  uint64_t time[STATS_TIMER_COUNT]; // nanoseconds
+  uint64_t calls[STATS_TIMER_COUNT];
+  uint64_t counters[STATS_COUNTER_COUNT];
+} stats_values_t;
+
+static const char *g_stats_timer_names[STATS_TIMER_COUNT] = {
+  "template", "fields", "png_decode", "palette", "mr_compress", "crc", "output"
+};
+
+static const char *g_stats_counter_names[STATS_COUNTER_COUNT] = {
+  "pixels", "colors", "compressed_bytes",
+#ifdef STATS_WRAP_ALLOCATIONS
+  "own_allocations"
+#endif
+};
+
+static int g_stats_enabled = 0;
+
+// the phases are timed for the statistics and/or the trace (see trace.c)
+static int g_stats_timing = 0;
+static FILE *g_stats_file = NULL;
+static pthread_mutex_t g_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t g_stats_begin;
+
+// whole run, updated by all the threads
+static stats_values_t g_stats_total;
+
+// current record (see stats_record()) of the thread
+static __thread stats_values_t g_stats_current;
+static __thread uint64_t g_stats_current_start;
+
+static uint64_t
+stats_now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void
+stats_print(const char *scope, const char *name, stats_values_t *values)
+{
+  struct rusage usage;
+  buffer_t buf;
+
+  buffer_init(&buf);
+  buffer_printf(&buf, "{\"scope\":\"%s\"", scope);
+  if (name != NULL) {
+    buffer_append(&buf, ",\"name\":", 8);
+    buffer_append_json_string(&buf, name);
+  } else {
+    buffer_printf(&buf, ",\"wall_ms\":%.3f", (stats_now() - g_stats_begin) / 1e6);
+  }
+
+  buffer_append(&buf, ",\"timers\":{", 11);
+  for (int i = 0; i < STATS_TIMER_COUNT; i++) {
+    buffer_printf(&buf, "%s\"%s\":{\"calls\":%llu,\"ms\":%.3f}", i ? "," : "",
+      g_stats_timer_names[i], (unsigned long long) values->calls[i],
+      values->time[i] / 1e6);
+  }
+
+  buffer_append(&buf, "},\"counters\":{", 14);
+  for (int i = 0; i < STATS_COUNTER_COUNT; i++) {
+    buffer_printf(&buf, "%s\"%s\":%llu", i ? "," : "", g_stats_counter_names[i],
+      (unsigned long long) values->counters[i]);
+  }
+
+  // ru_maxrss is in kilobytes on Linux
+  getrusage(RUSAGE_SELF, &usage);
+  buffer_printf(&buf, "},\"peak_rss_kb\":%ld}\n", usage.ru_maxrss);
+
+  pthread_mutex_lock(&g_stats_lock);
+  fwrite(buf.data, 1, buf.size, g_stats_file);
+  fflush(g_stats_file);
+  pthread_mutex_unlock(&g_stats_lock);
+
+  buffer_free(&buf);
+}
+
+static void
+stats_close(void)
+{
+  stats_values_t total;
+
+  // the workers of the server mode may still be running
+  for (int i = 0; i < STATS_TIMER_COUNT; i++) {
+    total.time[i] = __atomic_load_n(&g_stats_total.time[i], __ATOMIC_RELAXED);
+    total.calls[i] = __atomic_load_n(&g_stats_total.calls[i], __ATOMIC_RELAXED);
+  }
+  for (int i = 0; i < STATS_COUNTER_COUNT; i++) {
+    total.counters[i] = __atomic_load_n(&g_stats_total.counters[i], __ATOMIC_RELAXED);
+  }
+
+  stats_print("total", NULL, &total);
+
+  if (g_stats_file != stdout) {
+    fclose(g_stats_file);
+  }
+}
+
+// Enables the statistics, written to a file ("-" for stdout) as JSON-Lines:
+// one object per record of the batch modes, and the totals at exit
+int
+stats_open(const char *filename)
+{
+  g_stats_file = is_stdio(filename) ? stdout : fopen(filename, "w");
+  if (g_stats_file == NULL) {
+    log_error("can't open statistics file \"%s\": %s\n", filename, strerror(errno));
+    return 0;
+  }
+
+  g_stats_begin = stats_now();
+  g_stats_enabled = 1;
+  g_stats_timing = 1;
+  atexit(stats_close);
+
+  return 1;
+}
+
+void
+stats_timing_enable(void)
+{
+  g_stats_timing = 1;
+}
+
+// Starts timing a phase, ended by stats_stop(); returns 0 when disabled
+uint64_t
+stats_start(void)
+{
+  return g_stats_timing ? stats_now() : 0;
+}
+
+void
+stats_stop(stats_timer_t timer, uint64_t start)
+{
+  if (!g_stats_timing) {
+    return;
+  }
+
+  uint64_t end = stats_now();
+
+  trace_span(g_stats_timer_names[timer], 0, start, end);
+
+  if (!g_stats_enabled) {
+    return;
+  }
+
+  uint64_t elapsed = end - start;
+
+  g_stats_current.time[timer] += elapsed;
+  g_stats_current.calls[timer]++;
+  __atomic_fetch_add(&g_stats_total.time[timer], elapsed, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&g_stats_total.calls[timer], 1, __ATOMIC_RELAXED);
+}
+
+void
+stats_add(stats_counter_t counter, uint64_t value)
+{
+  if (!g_stats_enabled) {
+    return;
+  }
+
+  g_stats_current.counters[counter] += value;
+  __atomic_fetch_add(&g_stats_total.counters[counter], value, __ATOMIC_RELAXED);
+}
+
+// Starts a record of the thread (see stats_record())
+void
+stats_record_begin(void)
+{
+  if (g_stats_timing) {
+    g_stats_current_start = stats_now();
+  }
+}
+
+// Writes the statistics of the thread since its previous record, e.g. for
+// each file of a batch, and traces the record since stats_record_begin()
+void
+stats_record(const char *name)
+{
+  if (!g_stats_timing) {
+    return;
+  }
+
+  if (g_stats_current_start) {
+    trace_span(name, 1, g_stats_current_start, stats_now());
+    g_stats_current_start = 0;
+  }
+
+  if (g_stats_enabled) {
+    stats_print("record", name, &g_stats_current);
+    memset(&g_stats_current, 0, sizeof(stats_values_t));
+  }
+}
+
+/* Allocations, counted through the linker (see STATS_ALLOCATIONS in the
+   Makefile) */
+
+#ifdef STATS_WRAP_ALLOCATIONS
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+int __real_posix_memalign(void **ptr, size_t alignment, size_t size);
+
+void *
+__wrap_malloc(size_t size)
+{
+  stats_add(STATS_OWN_ALLOCATIONS, 1);
+  return __real_malloc(size);
+}
+
+void *
+__wrap_calloc(size_t count, size_t size)
+{
+  stats_add(STATS_OWN_ALLOCATIONS, 1);
+  return __real_calloc(count, size);
+}
+
+void *
+__wrap_realloc(void *ptr, size_t size)
+{
+  stats_add(STATS_OWN_ALLOCATIONS, 1);
+  return __real_realloc(ptr, size);
+}
+
+int
+__wrap_posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+  stats_add(STATS_OWN_ALLOCATIONS, 1);
+  return __real_posix_memalign(ptr, alignment, size);
+}
+
+#endif /* STATS_WRAP_ALLOCATIONS */
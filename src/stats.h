@@ -0,0 +1,75 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include "global.h"
+
+#include <stdint.h>
+
+#include "utils.h"
+
+// timed phases of the generation
+typedef enum stats_timer_t {
+  STATS_TEMPLATE = 0,   // bootstrap template loading
+  STATS_FIELDS,         // fields parsing and checking
+  STATS_PNG_DECODE,     // PNG logo decoding
+  STATS_PALETTE,        // MR palette building
+  STATS_MR_COMPRESS,    // MR run-length compression
+  STATS_CRC,            // Device Info CRC
+  STATS_OUTPUT,         // outputs writing
+  STATS_TIMER_COUNT
+} stats_timer_t;
+
+typedef enum stats_counter_t {
+  STATS_PIXELS = 0,
+  STATS_COLORS,
+  STATS_COMPRESSED_BYTES,
+#ifdef STATS_WRAP_ALLOCATIONS
+  STATS_OWN_ALLOCATIONS,  // made by makeip itself, not by its libraries
+#endif
+  STATS_COUNTER_COUNT
+} stats_counter_t;
+
+int stats_open(const char *filename);
+void stats_timing_enable(void);
+
+uint64_t stats_start(void);
+void stats_stop(stats_timer_t timer, uint64_t start);
+void stats_add(stats_counter_t counter, uint64_t value);
+
+void stats_record_begin(void);
+void stats_record(const char *name);
+
+#endif /* __STATS_H__ */
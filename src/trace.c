@@ -0,0 +1,236 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <time.h>
+
+#include "trace.h"
+#include "stats.h"
+
+typedef struct trace_event_t {
+  const char *name;
+  uint64_t start;
+  uint64_t end;
+} trace_event_t;
+
+typedef struct trace_chunk_t {
+  struct trace_chunk_t *next;
+  int count;
+  trace_event_t events[TRACE_CHUNK_EVENTS];
+} trace_chunk_t;
+
+// events of a thread, only written by it: the events and the chunks are
+// published with release stores, so trace_close() reads them without locks
+typedef struct trace_buffer_t {
+  struct trace_buffer_t *next;
+  pid_t tid;
+  trace_chunk_t *first;
+  trace_chunk_t *last;
+} trace_buffer_t;
+
+static int g_trace_enabled = 0;
+static FILE *g_trace_file = NULL;
+static uint64_t g_trace_begin;
+
+// buffers of all the threads which recorded events (even exited ones)
+static trace_buffer_t *g_trace_buffers = NULL;
+
+static __thread trace_buffer_t *g_trace_buffer = NULL;
+
+static uint64_t
+trace_now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static trace_chunk_t *
+trace_chunk_create(void)
+{
+  trace_chunk_t *chunk = (trace_chunk_t *) malloc(sizeof(trace_chunk_t));
+  if (chunk == NULL) {
+    halt("unable to allocate trace buffer\n");
+  }
+  chunk->next = NULL;
+  chunk->count = 0;
+  return chunk;
+}
+
+static trace_buffer_t *
+trace_buffer_get(void)
+{
+  trace_buffer_t *buffer = g_trace_buffer;
+
+  if (buffer == NULL) {
+    buffer = (trace_buffer_t *) malloc(sizeof(trace_buffer_t));
+    if (buffer == NULL) {
+      halt("unable to allocate trace buffer\n");
+    }
+    buffer->tid = syscall(SYS_gettid);
+    buffer->first = buffer->last = trace_chunk_create();
+
+    // pushed on the list of buffers
+    buffer->next = __atomic_load_n(&g_trace_buffers, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&g_trace_buffers, &buffer->next, buffer,
+        0, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    g_trace_buffer = buffer;
+  }
+
+  return buffer;
+}
+
+static void
+trace_print_event(buffer_t *buf, const char *name, pid_t tid, uint64_t start,
+  uint64_t end)
+{
+  buffer_append(buf, "{\"name\":", 8);
+  buffer_append_json_string(buf, name);
+  buffer_printf(buf, ",\"cat\":\"makeip\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+    "\"pid\":%d,\"tid\":%d},\n", (start - g_trace_begin) / 1e3,
+    (end - start) / 1e3, (int) getpid(), (int) tid);
+}
+
+static void
+trace_close(void)
+{
+  trace_buffer_t *buffer;
+  buffer_t buf;
+  pid_t pid = getpid();
+
+  g_trace_enabled = 0;
+
+  buffer_init(&buf);
+  buffer_append(&buf, "{\"traceEvents\":[\n", 17);
+
+  for (buffer = __atomic_load_n(&g_trace_buffers, __ATOMIC_ACQUIRE);
+       buffer != NULL; buffer = buffer->next) {
+    buffer_printf(&buf, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+      "\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n", (int) pid, (int) buffer->tid,
+      (buffer->tid == pid) ? "main" : "worker");
+
+    for (trace_chunk_t *chunk = buffer->first; chunk != NULL;
+         chunk = __atomic_load_n(&chunk->next, __ATOMIC_ACQUIRE)) {
+      int count = __atomic_load_n(&chunk->count, __ATOMIC_ACQUIRE);
+      for (int i = 0; i < count; i++) {
+        trace_event_t *event = &chunk->events[i];
+        trace_print_event(&buf, event->name, buffer->tid, event->start, event->end);
+      }
+      fwrite(buf.data, 1, buf.size, g_trace_file);
+      buf.size = 0;
+    }
+  }
+
+  // the events are separated by commas, the last one is closed here
+  fprintf(g_trace_file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+    "\"args\":{\"name\":\"%s\"}}\n],\"displayTimeUnit\":\"ms\"}\n", (int) pid,
+    program_name_get());
+
+  buffer_free(&buf);
+
+  if (g_trace_file != stdout) {
+    fclose(g_trace_file);
+  }
+}
+
+// Enables the recording of the spans, written at exit to a file ("-" for
+// stdout) in the Chrome trace-event format (chrome://tracing, Perfetto)
+int
+trace_open(const char *filename)
+{
+  g_trace_file = is_stdio(filename) ? stdout : fopen(filename, "w");
+  if (g_trace_file == NULL) {
+    log_error("can't open trace file \"%s\": %s\n", filename, strerror(errno));
+    return 0;
+  }
+
+  g_trace_begin = trace_now();
+  g_trace_enabled = 1;
+  stats_timing_enable();
+  atexit(trace_close);
+
+  return 1;
+}
+
+int
+trace_enabled(void)
+{
+  return g_trace_enabled;
+}
+
+// Starts a span which isn't a phase of the statistics (see stats_start());
+// returns 0 when disabled
+uint64_t
+trace_start(void)
+{
+  return g_trace_enabled ? trace_now() : 0;
+}
+
+void
+trace_stop(const char *name, uint64_t start)
+{
+  if (g_trace_enabled) {
+    trace_span(name, 0, start, trace_now());
+  }
+}
+
+// Records a span of the current thread; its name is copied when it doesn't
+// last until the exit (e.g. file names)
+void
+trace_span(const char *name, int copy, uint64_t start, uint64_t end)
+{
+  if (!g_trace_enabled) {
+    return;
+  }
+
+  trace_buffer_t *buffer = trace_buffer_get();
+  trace_chunk_t *chunk = buffer->last;
+
+  if (chunk->count == TRACE_CHUNK_EVENTS) {
+    trace_chunk_t *next = trace_chunk_create();
+    __atomic_store_n(&chunk->next, next, __ATOMIC_RELEASE);
+    buffer->last = chunk = next;
+  }
+
+  trace_event_t *event = &chunk->events[chunk->count];
+  event->name = name;
+  if (copy && (event->name = strdup(name)) == NULL) {
+    halt("unable to allocate trace buffer\n");
+  }
+  event->start = start;
+  event->end = end;
+
+  __atomic_store_n(&chunk->count, chunk->count + 1, __ATOMIC_RELEASE);
+}
@@ -33,8 +33,6 @@
 
 #include "utils.h"
 
-int g_verbose = 0;
-
 char *g_program_name;
 
 // Thanks to alk
@@ -94,64 +92,6 @@ program_name_finalize()
   free(g_program_name);	
 }
 
-void
-log_notice(const char *format, ...)
-{
-  if (g_verbose) {
-    va_list args;
-  
-    fprintf(stdout, "%s: ", g_program_name);
-  
-    va_start(args, format);  
-    vfprintf(stdout, format, args);
-    va_end(args);
-  }
-}
-
-void
-log_warn(const char *format, ...)
-{
-  va_list args;
-  
-  fprintf(stdout, "%s: warning: ", g_program_name);
-  
-  va_start(args, format);  
-  vfprintf(stdout, format, args);
-  va_end(args);
-}
-
-void
-log_error(const char *format, ...)
-{
-  va_list args;
-  
-  fprintf(stderr, "%s: error: ", g_program_name);
-  
-  va_start(args, format);  
-  vfprintf(stderr, format, args);
-  va_end(args);
-}
-
-void
-halt(const char *format, ...)
-{
-  va_list args;
-  
-  fprintf(stderr, "%s: fatal: ", g_program_name);
-  
-  va_start(args, format);  
-  vfprintf(stderr, format, args);
-  va_end(args);
-  
-  exit(EXIT_FAILURE);
-}
-
-void
-verbose_enable()
-{
-  g_verbose = 1;	
-}
-
 int
 long_parse(char *str, long *result)
 {	
@@ -237,6 +177,13 @@ is_file_exist(char *filename)
   return (stat(filename, &stats) == 0);
 }
 
+// Tells if a file name stands for the standard input/output, i.e. "-"
+int
+is_stdio(const char *filename)
+{
+  return filename != NULL && !strcmp(filename, STDIO_FILENAME);
+}
+
 int
 is_in_char_array(char needle, char *haystack)
 {
@@ -306,3 +253,251 @@ bwrite(size_t *pos, void *dest, const void *source, size_t num)
   memcpy(dest + *pos, source, num);
   *pos = *pos + num;
 }
+
+int
+file_map(char *filename, file_map_mode_t mode, mapped_file_t *map)
+{
+  struct stat stats;
+  int writable = (mode == FILE_MAP_WRITE);
+
+  map->data = NULL;
+  map->size = 0;
+
+  int fd = open(filename, writable ? O_RDWR : O_RDONLY);
+  if (fd == -1) {
+    log_error("can't open file \"%s\": %s\n", filename, strerror(errno));
+    return 0;
+  }
+
+  if (fstat(fd, &stats) == -1) {
+    log_error("can't stat file \"%s\": %s\n", filename, strerror(errno));
+    close(fd);
+    return 0;
+  }
+
+  map->size = stats.st_size;
+
+  // mmap refuses empty mappings, so empty files are simply left unmapped
+  if (map->size > 0) {
+    void *data = mmap(NULL, map->size,
+      writable ? PROT_READ | PROT_WRITE : PROT_READ,
+      writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+
+    if (data == MAP_FAILED) {
+      log_error("can't map file \"%s\": %s\n", filename, strerror(errno));
+      close(fd);
+      map->size = 0;
+      return 0;
+    }
+
+    map->data = (char *) data;
+  }
+
+  // the mapping stays valid after the descriptor is closed
+  close(fd);
+
+  return 1;
+}
+
+void
+file_unmap(mapped_file_t *map)
+{
+  if (map->data != NULL) {
+    munmap(map->data, map->size);
+  }
+  map->data = NULL;
+  map->size = 0;
+}
+
+int
+file_read_full(int fd, void *data, size_t size)
+{
+  char *p = (char *) data;
+
+  // read() may be interrupted or return less than requested
+  while (size > 0) {
+    ssize_t result = read(fd, p, size);
+    if (result <= 0) {
+      if (result < 0 && errno == EINTR) {
+        continue;
+      }
+      return 0;
+    }
+    p += result;
+    size -= result;
+  }
+
+  return 1;
+}
+
+int
+file_write_full(int fd, const void *data, size_t size)
+{
+  const char *p = (const char *) data;
+
+  // write() may be interrupted or only partially done
+  while (size > 0) {
+    ssize_t result = write(fd, p, size);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return 0;
+    }
+    p += result;
+    size -= result;
+  }
+
+  return 1;
+}
+
+size_t
+page_size_get()
+{
+  static size_t page_size = 0;
+  if (!page_size) {
+    long result = sysconf(_SC_PAGESIZE);
+    page_size = (result > 0) ? result : 4096;
+  }
+  return page_size;
+}
+
+// Content hash (not cryptographic) used to name or cache data; chained by
+// passing the previous result, starting from HASH_FNV1A_INIT
+uint64_t
+hash_fnv1a(uint64_t hash, const void *data, size_t size)
+{
+  const unsigned char *p = (const unsigned char *) data;
+
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ p[i]) * 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+void
+buffer_init(buffer_t *buf)
+{
+  memset(buf, 0, sizeof(buffer_t));
+}
+
+static void
+buffer_reserve(buffer_t *buf, size_t size)
+{
+  if (buf->size + size + 1 > buf->capacity) {
+    size_t capacity = buf->capacity ? buf->capacity : 256;
+    while (buf->size + size + 1 > capacity) {
+      capacity *= 2;
+    }
+    buf->data = (char *) realloc(buf->data, capacity);
+    if (buf->data == NULL) {
+      halt("unable to allocate memory\n");
+    }
+    buf->capacity = capacity;
+  }
+}
+
+void
+buffer_append(buffer_t *buf, const void *data, size_t size)
+{
+  buffer_reserve(buf, size);
+  memcpy(buf->data + buf->size, data, size);
+  buf->size += size;
+  buf->data[buf->size] = '\0';
+}
+
+void
+buffer_printf(buffer_t *buf, const char *format, ...)
+{
+  va_list args;
+
+  va_start(args, format);
+  int length = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+
+  buffer_reserve(buf, length);
+
+  va_start(args, format);
+  vsnprintf(buf->data + buf->size, length + 1, format, args);
+  va_end(args);
+
+  buf->size += length;
+}
+
+void
+buffer_append_json_string(buffer_t *buf, const char *str)
+{
+  buffer_append(buf, "\"", 1);
+  for (; *str; str++) {
+    unsigned char c = *str;
+    if (c == '"' || c == '\\') {
+      buffer_printf(buf, "\\%c", c);
+    } else if (c < 0x20 || c >= 0x7f) {
+      // fields are plain ASCII, anything else is escaped as is
+      buffer_printf(buf, "\\u%04x", c);
+    } else {
+      buffer_append(buf, str, 1);
+    }
+  }
+  buffer_append(buf, "\"", 1);
+}
+
+void
+buffer_free(buffer_t *buf)
+{
+  free(buf->data);
+  buffer_init(buf);
+}
+
+// Appends all the data of a stream (e.g. a pipe) to a buffer
+int
+file_read_stream(int fd, buffer_t *buf)
+{
+  for (;;) {
+    buffer_reserve(buf, 65536);
+    ssize_t result = read(fd, buf->data + buf->size, buf->capacity - buf->size - 1);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return 0;
+    }
+    if (!result) {
+      break;
+    }
+    buf->size += result;
+  }
+
+  buf->data[buf->size] = '\0';
+
+  return 1;
+}
+
+// Reads a list of file names (one per line, "-" for stdin)
+int
+file_list_load(char *filename, void (*add)(char *item))
+{
+  char line[4096];
+  int count = 0;
+
+  FILE *fh = !is_stdio(filename) ? fopen(filename, "r") : stdin;
+  if (fh == NULL) {
+    log_error("can't open file list \"%s\"\n", filename);
+    return -1;
+  }
+
+  while (fgets(line, sizeof(line), fh)) {
+    rtrim(line);
+    if (*line) {
+      add(strdup(line));
+      count++;
+    }
+  }
+
+  if (fh != stdin) {
+    fclose(fh);
+  }
+
+  return count;
+}
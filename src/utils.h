@@ -35,6 +35,7 @@
 #define __UTILS_H__
 
 #include <ctype.h>
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -42,11 +43,19 @@
 #include <libgen.h>
 #include <time.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
+#include "log.h"
+
 #define MAX_YR 9999
 #define MIN_YR 1900
 
+// FNV-1a (64-bit) initial value, see hash_fnv1a()
+#define HASH_FNV1A_INIT 0xcbf29ce484222325ULL
+
 #define MR_FRIENDLY_SUPPORTED_FORMAT "MR; PNG";
 
 typedef enum file_type_t {
@@ -56,6 +65,25 @@ typedef enum file_type_t {
   PNG
 } file_type_t;
 
+typedef enum file_map_mode_t {
+  FILE_MAP_READ = 0,  // private, read-only mapping
+  FILE_MAP_WRITE      // shared mapping, changes go back to the file
+} file_map_mode_t;
+
+typedef struct buffer_t {
+  char *data;
+  size_t size;
+  size_t capacity;
+} buffer_t;
+
+// file name of the standard input/output
+#define STDIO_FILENAME "-"
+
+typedef struct mapped_file_t {
+  char *data;
+  size_t size;
+} mapped_file_t;
+
 void ltrim(char *str);
 void rtrim(char *str);
 void trim(char *str);
@@ -64,14 +92,6 @@ void program_name_initialize(char *argv0);
 char * program_name_get();
 void program_name_finalize();
 
-void verbose_enable();
-
-void log_notice(const char *format, ...);
-void log_warn(const char *format, ...);
-void log_error(const char *format, ...);
-
-void halt(const char *format, ...);
-
 int long_parse(char *str, long *result);
 int substr_long_parse(char *str, int start, int length, long *result);
 
@@ -80,6 +100,7 @@ int is_valid_hex(char *str);
 int is_strict_bool(char c);
 
 int is_file_exist(char *filename);
+int is_stdio(const char *filename);
 
 char * retrieve_parameterized_options(char *opts);
 int is_in_char_array(char needle, char *haystack);
@@ -88,4 +109,22 @@ file_type_t detect_file_type(char *filename);
 
 void bwrite(size_t *pos, void *dest, const void *source, size_t num);
 
+int file_map(char *filename, file_map_mode_t mode, mapped_file_t *map);
+void file_unmap(mapped_file_t *map);
+int file_read_full(int fd, void *data, size_t size);
+int file_write_full(int fd, const void *data, size_t size);
+int file_read_stream(int fd, buffer_t *buf);
+
+size_t page_size_get();
+
+uint64_t hash_fnv1a(uint64_t hash, const void *data, size_t size);
+
+void buffer_init(buffer_t *buf);
+void buffer_append(buffer_t *buf, const void *data, size_t size);
+void buffer_printf(buffer_t *buf, const char *format, ...);
+void buffer_append_json_string(buffer_t *buf, const char *str);
+void buffer_free(buffer_t *buf);
+
+int file_list_load(char *filename, void (*add)(char *item));
+
 #endif /* __UTILS_H__ */
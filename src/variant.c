@@ -0,0 +1,309 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "variant.h"
+
+#include "crc.h"
+#include "field.h"
+#include "ip.h"
+#include "output.h"
+#include "pool.h"
+#include "stats.h"
+
+typedef struct variant_context_t {
+  variant_matrix_t *matrix;
+  const char *ip;
+  const char *pattern;
+  sector_format_t format;
+  uint32_t lba;
+  long total;
+  int slices;
+  int failed;
+} variant_context_t;
+
+void
+variant_init(variant_matrix_t *matrix)
+{
+  memset(matrix, 0, sizeof(variant_matrix_t));
+}
+
+// Adds a field to the matrix with its comma-separated values, returns 0 if
+// a value is invalid
+int
+variant_add(variant_matrix_t *matrix, char key, int index, const char *values)
+{
+  char *copy, *label, *state;
+  variant_field_t *field;
+
+  for (int i = 0; i < matrix->count; i++) {
+    if (matrix->fields[i].index == index) {
+      log_error("field \"%s\" is already varied\n", field_get_name(index));
+      return 0;
+    }
+  }
+
+  field = &matrix->fields[matrix->count];
+  field->key = key;
+  field->index = index;
+  field->count = 0;
+  field->values = NULL;
+  field->labels = NULL;
+
+  copy = strdup(values);
+  for (label = strtok_r(copy, ",", &state); label != NULL;
+       label = strtok_r(NULL, ",", &state)) {
+    // the checks normalize the values (e.g. "CD-ROM1/2" is "0000 CD-ROM1/2")
+    char *value = (char *) calloc(1, IP_FIELDS_SIZE + 1);
+    if (strlen(label) > field_get_length(index)) {
+      log_error("data for field \"%s\" is too long\n", field_get_name(index));
+    } else {
+      strcpy(value, label);
+    }
+    if (!*value || !field_check_value(index, value)) {
+      log_error("invalid value \"%s\" for field \"%s\"\n", label, field_get_name(index));
+      free(value);
+      free(copy);
+      matrix->count++;
+      return 0;
+    }
+    // stored like field_set_value does, so a variant matches a single run
+    field_pretty(index, value);
+
+    field->values =(char **) realloc(field->values, (field->count + 1) * sizeof(char *));
+    field->labels = (char **) realloc(field->labels, (field->count + 1) * sizeof(char *));
+    field->values[field->count] = value;
+    field->labels[field->count] = strdup(label);
+    field->count++;
+  }
+  free(copy);
+
+  // the field is released with the matrix, even on error
+  matrix->count++;
+
+  if (!field->count) {
+    log_error("no value for field \"%s\"\n", field_get_name(index));
+    return 0;
+  }
+
+  return 1;
+}
+
+// Number of bootstraps of the matrix, -1 if there are too many
+long
+variant_total(variant_matrix_t *matrix)
+{
+  long total = 1;
+
+  for (int i = 0; i < matrix->count; i++) {
+    total *= matrix->fields[i].count;
+    if (total > VARIANT_MAX_COUNT) {
+      return -1;
+    }
+  }
+
+  return total;
+}
+
+static variant_field_t *
+variant_find(variant_matrix_t *matrix, char key)
+{
+  for (int i = 0; i < matrix->count; i++) {
+    if (matrix->fields[i].key == key) {
+      return &matrix->fields[i];
+    }
+  }
+
+  return NULL;
+}
+
+// Checks that the pattern names each bootstrap differently
+static int
+variant_check_pattern(variant_matrix_t *matrix, const char *pattern)
+{
+  for (const char *p = pattern; *p; p++) {
+    if (*p == '%') {
+      p++;
+      if (*p != '%' && variant_find(matrix, *p) == NULL) {
+        log_error("unknown placeholder \"%%%c\" in output pattern (fields: %%<switch>"
+          " of a varied field, %%%%)\n", *p ? *p : ' ');
+        return 0;
+      }
+    }
+  }
+
+  for (int i = 0; i < matrix->count; i++) {
+    char placeholder[3] = { '%', matrix->fields[i].key, '\0' };
+    if (strstr(pattern, placeholder) == NULL) {
+      log_error("output pattern has no \"%s\" for the values of field \"%s\"\n",
+        placeholder, field_get_name(matrix->fields[i].index));
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+// Expands the output pattern with the values of a variant
+static void
+variant_name(variant_matrix_t *matrix, const char *pattern, const int *choices,
+  buffer_t *name)
+{
+  name->size = 0;
+
+  for (const char *p = pattern; *p; p++) {
+    if (*p != '%') {
+      buffer_append(name, p, 1);
+    } else if (*++p == '%') {
+      buffer_append(name, "%", 1);
+    } else {
+      variant_field_t *field = variant_find(matrix, *p);
+      const char *label = field->labels[choices[field - matrix->fields]];
+      // values like "CD-ROM1/2" don't make directories
+      for (; *label; label++) {
+        buffer_append(name, (*label == '/') ? "_" : label, 1);
+      }
+    }
+  }
+}
+
+// Generates a slice of the matrix with a single copy of the bootstrap: only
+// the fields changed since the previous variant and the CRC are patched
+static void
+variant_job(int slice, void *context)
+{
+  variant_context_t *ctx = (variant_context_t *) context;
+  variant_matrix_t *matrix = ctx->matrix;
+  long start = ctx->total * slice / ctx->slices;
+  long end = ctx->total * (slice + 1) / ctx->slices;
+  int choices[NUM_FIELDS], written[NUM_FIELDS];
+  buffer_t name;
+  void *ip = NULL;
+
+  // page-aligned, like ip_create(), for the output writers
+  if (posix_memalign(&ip, page_size_get(), INITIAL_PROGRAM_SIZE)) {
+    halt("unable to allocate bootstrap data\n");
+  }
+  memcpy(ip, ctx->ip, INITIAL_PROGRAM_SIZE);
+
+  buffer_init(&name);
+  for (int i = 0; i < matrix->count; i++) {
+    written[i] = -1;
+  }
+
+  for (long variant = start; variant < end; variant++) {
+    long rest = variant;
+
+    stats_record_begin();
+
+    // the last field varies first
+    for (int i = matrix->count - 1; i >= 0; i--) {
+      variant_field_t *field = &matrix->fields[i];
+      choices[i] = rest % field->count;
+      rest /= field->count;
+      if (choices[i] != written[i]) {
+        field_write_string(ip, field->index, field->values[choices[i]]);
+        written[i] = choices[i];
+      }
+    }
+    update_crc(ip);
+
+    variant_name(matrix, ctx->pattern, choices, &name);
+
+    int result = (ctx->format == SECTOR_FORMAT_ISO) ?
+      output_write(name.data, ip, INITIAL_PROGRAM_SIZE, 0) :
+      sector_file_write(name.data, ctx->format, ctx->lba, ip, INITIAL_PROGRAM_SIZE);
+    if (!result) {
+      __atomic_fetch_add(&ctx->failed, 1, __ATOMIC_RELAXED);
+    }
+
+    stats_record(name.data);
+  }
+
+  buffer_free(&name);
+  free(ip);
+}
+
+// Writes a bootstrap for each combination of the values of the matrix,
+// from a generated bootstrap (fields, logo); returns 0 on error
+int
+variant_generate(variant_matrix_t *matrix, const char *ip, const char *pattern,
+  sector_format_t format, uint32_t lba)
+{
+  variant_context_t ctx;
+
+  if (!variant_check_pattern(matrix, pattern)) {
+    return 0;
+  }
+
+  ctx.matrix = matrix;
+  ctx.ip = ip;
+  ctx.pattern = pattern;
+  ctx.format = format;
+  ctx.lba = lba;
+  ctx.total = variant_total(matrix);
+  ctx.failed = 0;
+
+  if (ctx.total < 0) {
+    log_error("too many bootstraps in the matrix (more than %d)\n", VARIANT_MAX_COUNT);
+    return 0;
+  }
+
+  // a slice for each thread, each one with its own copy of the bootstrap
+  ctx.slices = (pool_threads_get() < ctx.total) ? pool_threads_get() : ctx.total;
+
+  pool_run(ctx.slices, variant_job, &ctx);
+
+  if (ctx.failed) {
+    log_error("%d of %ld bootstrap file(s) not written\n", ctx.failed, ctx.total);
+    return 0;
+  }
+
+  log_notice("%ld bootstrap file(s) written\n", ctx.total);
+
+  return 1;
+}
+
+void
+variant_release(variant_matrix_t *matrix)
+{
+  for (int i = 0; i < matrix->count; i++) {
+    variant_field_t *field = &matrix->fields[i];
+    for (int j = 0; j < field->count; j++) {
+      free(field->values[j]);
+      free(field->labels[j]);
+    }
+    free(field->values);
+    free(field->labels);
+  }
+  matrix->count = 0;
+}
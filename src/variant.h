@@ -0,0 +1,66 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __VARIANT_H__
+#define __VARIANT_H__
+
+#include "global.h"
+
+#include "utils.h"
+#include "sector.h"
+
+// largest number of bootstraps of a matrix
+#define VARIANT_MAX_COUNT 1000000
+
+// field whose values make the matrix (--vary)
+typedef struct variant_field_t {
+  char key;       // placeholder of the output pattern, e.g. 'a' for "%a"
+  int index;
+  int count;
+  char **values;  // checked values, as written in the bootstraps
+  char **labels;  // values as given, for the output names
+} variant_field_t;
+
+typedef struct variant_matrix_t {
+  int count;
+  variant_field_t fields[NUM_FIELDS];
+} variant_matrix_t;
+
+void variant_init(variant_matrix_t *matrix);
+int variant_add(variant_matrix_t *matrix, char key, int index, const char *values);
+long variant_total(variant_matrix_t *matrix);
+int variant_generate(variant_matrix_t *matrix, const char *ip, const char *pattern,
+  sector_format_t format, uint32_t lba);
+void variant_release(variant_matrix_t *matrix);
+
+#endif /* __VARIANT_H__ */
@@ -0,0 +1,231 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "verify.h"
+
+#include "ip.h"
+#include "crc.h"
+#include "mr.h"
+#include "field.h"
+#include "output.h"
+#include "pool.h"
+#include "stats.h"
+
+typedef struct verify_result_t {
+  int success;
+  buffer_t errors;  // human readable, "; " separated
+  buffer_t report;  // JSON object
+} verify_result_t;
+
+typedef struct verify_context_t {
+  vector *files;
+  verify_result_t *results;
+} verify_context_t;
+
+static void
+verify_error(verify_result_t *result, const char *format, ...)
+{
+  char message[256];
+  va_list args;
+
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  if (result->errors.size) {
+    buffer_append(&result->errors, "; ", 2);
+  }
+  buffer_append(&result->errors, message, strlen(message));
+  result->success = 0;
+}
+
+static void
+verify_fields(const char *ip, verify_result_t *result)
+{
+  char value[0x100];
+
+  for (int i = 0; i < NUM_FIELDS; i++) {
+    if (!field_read_value(ip, i, value) || !field_check_value(i, value)) {
+      verify_error(result, "invalid field \"%s\"", field_get_name(i));
+    }
+  }
+}
+
+static void
+verify_crc(const char *ip, verify_result_t *result)
+{
+  char computed[5];
+  char stored[5];
+
+  sprintf(computed, "%04X", calc_crc((const unsigned char *) ip + 0x40, 16));
+  memcpy(stored, ip + 0x20, 4);
+  stored[4] = '\0';
+
+  buffer_append(&result->report, ",\"crc\":{\"stored\":", 17);
+  buffer_append_json_string(&result->report, stored);
+  buffer_printf(&result->report, ",\"computed\":\"%s\"}", computed);
+
+  if (strcmp(stored, computed)) {
+    verify_error(result, "bad CRC (stored \"%s\", computed \"%s\")", stored, computed);
+  }
+}
+
+static void
+verify_logo(const char *ip, verify_result_t *result)
+{
+  const unsigned char *slot = (const unsigned char *) ip + MR_OFFSET;
+  size_t avail = INITIAL_PROGRAM_SIZE - MR_OFFSET;
+  const char *error;
+  mr_info_t info;
+
+  if (memcmp(slot, "MR", 2)) {
+    // no logo: the slot must be left blank
+    for (int i = 0; i < MR_MAX_SIZE; i++) {
+      if (slot[i]) {
+        verify_error(result, "logo slot is not blank but contains no MR image");
+        break;
+      }
+    }
+    buffer_append(&result->report, ",\"logo\":null", 12);
+    return;
+  }
+
+  if (!mr_parse(slot, avail, &info, &error)) {
+    verify_error(result, "corrupted logo (%s)", error);
+    buffer_append(&result->report, ",\"logo\":null", 12);
+    return;
+  }
+
+  buffer_printf(&result->report,
+    ",\"logo\":{\"size\":%u,\"width\":%u,\"height\":%u,\"colors\":%u}",
+    info.size, info.width, info.height, info.colors);
+
+  if (info.size > MR_MAX_SIZE) {
+    verify_error(result, "logo is larger than %d bytes (%u bytes)", MR_MAX_SIZE, info.size);
+  }
+}
+
+static void
+verify_job(int index, void *context)
+{
+  verify_context_t *ctx = (verify_context_t *) context;
+  verify_result_t *result = &ctx->results[index];
+  char *filename = VECTOR_GET(*ctx->files, char*, index);
+  mapped_file_t map;
+
+  stats_record_begin();
+
+  result->success = 1;
+  buffer_init(&result->errors);
+  buffer_init(&result->report);
+
+  buffer_append(&result->report, "{\"file\":", 8);
+  buffer_append_json_string(&result->report, filename);
+
+  // the field validators report errors themselves, they are collected here
+  log_silent_set(1);
+
+  if (!file_map(filename, FILE_MAP_READ, &map)) {
+    verify_error(result, "can't map file");
+  } else if (map.size < INITIAL_PROGRAM_SIZE) {
+    verify_error(result, "file is too small to contain a bootstrap");
+  } else if (memcmp(map.data, IP_HARDWARE_ID, strlen(IP_HARDWARE_ID))) {
+    verify_error(result, "bad hardware ID");
+  } else {
+    verify_fields(map.data, result);
+    verify_crc(map.data, result);
+    verify_logo(map.data, result);
+  }
+
+  log_silent_set(0);
+
+  file_unmap(&map);
+
+  buffer_printf(&result->report, ",\"status\":\"%s\",\"errors\":",
+    result->success ? "ok" : "failed");
+  buffer_append_json_string(&result->report,
+    result->errors.size ? result->errors.data : "");
+  buffer_append(&result->report, "}\n", 2);
+
+  stats_record(filename);
+}
+
+int
+verify_files(vector *files, char *fn_report)
+{
+  verify_context_t ctx;
+  int total = vector_total(files);
+  int failed = 0;
+  int to_stdout = (fn_report != NULL) && is_stdio(fn_report);
+  buffer_t report;
+
+  ctx.files = files;
+  ctx.results = (verify_result_t *) calloc(total, sizeof(verify_result_t));
+
+  pool_run(total, verify_job, &ctx);
+
+  buffer_init(&report);
+
+  // results are printed in input order
+  for (int i = 0; i < total; i++) {
+    verify_result_t *result = &ctx.results[i];
+
+    if (!result->success) {
+      failed++;
+      if (!to_stdout) {
+        printf("%s: %s\n", VECTOR_GET(*files, char*, i), result->errors.data);
+      }
+    }
+
+    if (fn_report != NULL) {
+      buffer_append(&report, result->report.data, result->report.size);
+    }
+
+    buffer_free(&result->errors);
+    buffer_free(&result->report);
+  }
+
+  free(ctx.results);
+
+  // output_write() reports the error
+  if (fn_report != NULL && !output_write(fn_report, report.data, report.size,
+      OUTPUT_REPLACE | OUTPUT_TEXT)) {
+    halt("can't write report file \"%s\"\n", fn_report);
+  }
+  buffer_free(&report);
+
+  fprintf(to_stdout ? stderr : stdout,
+    "%d file(s) verified: %d valid, %d invalid\n", total, total - failed, failed);
+
+  return failed;
+}
@@ -0,0 +1,145 @@
+/* IP creator (makeip)
+ *
+ * Copyright (C) 2000, 2001, 2002, 2019, 2020 The KOS Team and contributors.
+ * All rights reserved.
+ *
+ * This code was contributed to KallistiOS (KOS) by Andress Antonio Barajas
+ * (BBHoodsta). It was originally made by Marcus Comstedt (zeldin). Some
+ * portions of code were made by Andrew Kieschnick (ADK/Napalm). Heavily
+ * updated by SiZiOUS. Bootstrap replacement (IP.TMPL) was made by Jacob
+ * Alberty (LiENUS).
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <poll.h>
+#include <sys/inotify.h>
+
+#include "watch.h"
+
+int
+watch_init(watch_t *watch)
+{
+  memset(watch, 0, sizeof(watch_t));
+
+  watch->fd = inotify_init1(IN_CLOEXEC);
+  if (watch->fd == -1) {
+    log_error("can't watch files: %s\n", strerror(errno));
+    return 0;
+  }
+
+  return 1;
+}
+
+// Watches a file; flags are reported by watch_wait() when it's changed
+int
+watch_add(watch_t *watch, const char *filename, int flags)
+{
+  char *copy, *directory;
+  watch_file_t *file;
+
+  if (watch->count == WATCH_MAX_FILES) {
+    log_error("too many files to watch\n");
+    return 0;
+  }
+
+  file = &watch->files[watch->count];
+
+  // the directory is watched instead of the file: most editors save a new
+  // file then rename it over the previous one
+  copy = strdup(filename);
+  directory = dirname(copy);
+  file->wd = inotify_add_watch(watch->fd, directory, IN_CLOSE_WRITE | IN_MOVED_TO);
+  free(copy);
+
+  if (file->wd == -1) {
+    log_error("can't watch \"%s\": %s\n", filename, strerror(errno));
+    return 0;
+  }
+
+  copy = strdup(filename);
+  file->name = strdup(basename(copy));
+  file->flags = flags;
+  free(copy);
+
+  watch->count++;
+
+  return 1;
+}
+
+// Waits for changes on the watched files, returns the flags of the files
+// changed (or 0 on error)
+int
+watch_wait(watch_t *watch)
+{
+  char events[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  struct pollfd pfd = { watch->fd, POLLIN, 0 };
+  int flags = 0;
+
+  // block until the first change, then collect the following ones
+  for (;;) {
+    int ready = poll(&pfd, 1, flags ? WATCH_SETTLE_MS : -1);
+    ssize_t size = -1;
+
+    if (!ready) {
+      break;
+    }
+    if (ready > 0) {
+      size = read(watch->fd, events, sizeof(events));
+    }
+    if (size <= 0) {
+      if (size < 0 && errno == EINTR) {
+        continue;
+      }
+      log_error("can't read file changes: %s\n", strerror(errno));
+      return 0;
+    }
+
+    for (char *p = events; p < events + size; ) {
+      struct inotify_event *event = (struct inotify_event *) p;
+
+      for (int i = 0; i < watch->count; i++) {
+        if (event->wd == watch->files[i].wd && event->len &&
+            !strcmp(event->name, watch->files[i].name)) {
+          flags |= watch->files[i].flags;
+        }
+      }
+
+      p += sizeof(struct inotify_event) + event->len;
+    }
+  }
+
+  return flags;
+}
+
+void
+watch_release(watch_t *watch)
+{
+  for (int i = 0; i < watch->count; i++) {
+    free(watch->files[i].name);
+  }
+  if (watch->fd != -1) {
+    close(watch->fd);
+  }
+  memset(watch, 0, sizeof(watch_t));
+  watch->fd = -1;
+}